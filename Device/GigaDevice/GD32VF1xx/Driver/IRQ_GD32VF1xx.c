@@ -25,6 +25,24 @@
 #include <asm/gd32vf103xx.h>
 #include <Core/Riscv/irq_riscv.h>
 
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+/* ECLIC per interrupt registers: clicintip, clicintie, clicintattr, clicintctl */
+#define ECLIC_INT_BASE            (__ECLIC_BASEADDR + 0x1000UL)
+#define ECLIC_INTIP(irqn)         (*(volatile uint8_t *)(ECLIC_INT_BASE + ((uint32_t)(irqn) << 2U)))
+#define ECLIC_INTIE(irqn)         (*(volatile uint8_t *)(ECLIC_INT_BASE + ((uint32_t)(irqn) << 2U) + 1U))
+
+/* Trap entry in ECLIC mode, non-vectored interrupts share it with exceptions */
+#define CSR_MTVT2                 0x7EC
+#define MTVEC_MODE_ECLIC          0x03UL
+
+/* Exception or interrupt code field of mcause, the upper bits mirror mstatus */
+#define MCAUSE_EXCCODE_Msk        0x00000FFFUL
+
+extern void Trap_Handler(void);
+
 void Default_Handler(void);
 
 /**
@@ -40,7 +58,6 @@ void SAM_Handler(void) __attribute__ ((weak, alias("Default_Handler")));
 void SAF_Handler(void) __attribute__ ((weak, alias("Default_Handler")));
 void ECU_Handler(void) __attribute__ ((weak, alias("Default_Handler")));
 void ECS_Handler(void) __attribute__ ((weak, alias("Default_Handler")));
-void ECM_Handler(void) __attribute__ ((weak, alias("Default_Handler")));
 void IPF_Handler(void) __attribute__ ((weak, alias("Default_Handler")));
 void LPF_Handler(void) __attribute__ ((weak, alias("Default_Handler")));
 void SPF_Handler(void) __attribute__ ((weak, alias("Default_Handler")));
@@ -60,46 +77,168 @@ static const IRQHandler_t exc_vector[EXCn_MAX_NUM] = {
   ECU_Handler,    // Environment call from U-mode
   ECS_Handler,    // Environment call from S-mode
   NULL,           // Reserved
-  ECM_Handler,    // Environment call from M-mode
+  NULL,           // Environment call from M-mode, kernel service call
   IPF_Handler,    // Instruction page fault
   LPF_Handler,    // Load page fault
   NULL,           // Reserved
   SPF_Handler     // Store/AMO page fault
 };
 
+/**
+ * @brief Interrupt Handler Table
+ */
+static IRQHandler_t irq_table[__ECLIC_INTNUM];
+
 /*******************************************************************************
- *  function implementations (scope: module-local)
+ *  function implementations (scope: module-exported)
  ******************************************************************************/
 
 /**
- * @brief
+ * @brief       Initialize interrupt controller.
+ * @return      0 on success, -1 on error.
  */
-static void exc_entry(void)
+int32_t IRQ_Initialize(void)
 {
-  uint32_t mcause_val = CSR_READ(CSR_MCAUSE);
+  /* Set to NULL all interrupt handlers */
+  for (uint32_t i = 0U; i < (uint32_t)__ECLIC_INTNUM; i++) {
+    irq_table[i] = (IRQHandler_t)NULL;
+  }
+
+  /* Exceptions, service calls and interrupts enter the kernel trap handler */
+  CSR_WRITE(CSR_MTVT2, 0U);
+  CSR_WRITE(CSR_MTVEC, (uint32_t)Trap_Handler | MTVEC_MODE_ECLIC);
 
-  if ((mcause_val & MCAUSE_INT_Msk) == 0U) {
-    IRQHandler_t handler = exc_vector[mcause_val & MCAUSE_CODE_Msk];
-    if (handler != NULL) {
-      handler();
-    }
+  return (0);
+}
+
+/**
+ * @brief       Register interrupt handler.
+ * @param[in]   irqn      interrupt ID number
+ * @param[in]   handler   interrupt handler function address
+ * @return      0 on success, -1 on error.
+ */
+int32_t IRQ_SetHandler(IRQn_ID_t irqn, IRQHandler_t handler)
+{
+  if ((irqn < 0) || (irqn >= (IRQn_ID_t)__ECLIC_INTNUM) || (handler == NULL)) {
+    return (-1);
   }
-  else {
 
+  irq_table[irqn] = handler;
+
+  return (0);
+}
+
+/**
+ * @brief       Get the registered interrupt handler.
+ * @param[in]   irqn    interrupt ID number
+ * @return      registered interrupt handler function address.
+ */
+IRQHandler_t IRQ_GetHandler(IRQn_ID_t irqn)
+{
+  if ((irqn < 0) || (irqn >= (IRQn_ID_t)__ECLIC_INTNUM)) {
+    return (NULL);
   }
+
+  return (irq_table[irqn]);
 }
 
-/*******************************************************************************
- *  function implementations (scope: module-exported)
- ******************************************************************************/
+/**
+ * @brief       Get the handler of an exception.
+ * @param[in]   excn    exception code
+ * @return      exception handler function address, Default_Handler if none.
+ */
+IRQHandler_t IRQ_GetExcHandler(IRQn_ID_t excn)
+{
+  IRQHandler_t handler = NULL;
+
+  if ((excn >= 0) && (excn < (IRQn_ID_t)EXCn_MAX_NUM)) {
+    handler = exc_vector[excn];
+  }
+
+  if (handler == NULL) {
+    handler = Default_Handler;
+  }
+
+  return (handler);
+}
 
 /**
- * @brief       Initialize interrupt controller.
+ * @brief       Enable interrupt.
+ * @param[in]   irqn  interrupt ID number
  * @return      0 on success, -1 on error.
  */
-int32_t IRQ_Initialize(void)
+int32_t IRQ_Enable(IRQn_ID_t irqn)
+{
+  if ((irqn < 0) || (irqn >= (IRQn_ID_t)__ECLIC_INTNUM)) {
+    return (-1);
+  }
+
+  ECLIC_INTIE(irqn) = 1U;
+
+  return (0);
+}
+
+/**
+ * @brief       Disable interrupt.
+ * @param[in]   irqn  interrupt ID number
+ * @return      0 on success, -1 on error.
+ */
+int32_t IRQ_Disable(IRQn_ID_t irqn)
+{
+  if ((irqn < 0) || (irqn >= (IRQn_ID_t)__ECLIC_INTNUM)) {
+    return (-1);
+  }
+
+  ECLIC_INTIE(irqn) = 0U;
+
+  return (0);
+}
+
+/**
+ * @brief       Get interrupt enable state.
+ * @param[in]   irqn  interrupt ID number
+ * @return      0 - interrupt is disabled, 1 - interrupt is enabled.
+ */
+uint32_t IRQ_GetEnableState(IRQn_ID_t irqn)
 {
-  CSR_WRITE(CSR_MTVEC, exc_entry);
+  if ((irqn < 0) || (irqn >= (IRQn_ID_t)__ECLIC_INTNUM)) {
+    return (0U);
+  }
+
+  return ((uint32_t)ECLIC_INTIE(irqn) & 1U);
+}
+
+/**
+ * @brief       Get ID number of current interrupt request (IRQ).
+ * @return      interrupt ID number.
+ */
+IRQn_ID_t IRQ_GetActiveIRQ(void)
+{
+  return ((IRQn_ID_t)(CSR_READ(CSR_MCAUSE) & MCAUSE_EXCCODE_Msk));
+}
+
+/**
+ * @brief       Get the code of the current exception.
+ * @return      exception code.
+ */
+IRQn_ID_t IRQ_GetActiveEXC(void)
+{
+  return ((IRQn_ID_t)(CSR_READ(CSR_MCAUSE) & MCAUSE_EXCCODE_Msk));
+}
+
+/**
+ * @brief       Signal end of interrupt processing.
+ * @param[in]   irqn    interrupt ID number
+ * @return      0 on success, -1 on error.
+ */
+int32_t IRQ_EndOfInterrupt(IRQn_ID_t irqn)
+{
+  if ((irqn < 0) || (irqn >= (IRQn_ID_t)__ECLIC_INTNUM)) {
+    return (-1);
+  }
+
+  /* Pending edge triggered interrupt is not cleared in non-vectored mode */
+  ECLIC_INTIP(irqn) = 0U;
 
   return (0);
 }
@@ -0,0 +1,247 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: DMA Driver for STMicroelectronics STM32F0xx
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <device_config.h>
+#include <Driver/DMA_STM32F0xx.h>
+#include <Driver/RCC_STM32F0xx.h>
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#if defined(DMA1_Channel7_BASE)
+  /* Channels 6 and 7 exist on STM32F04x, STM32F07x and STM32F09x devices */
+  #define STM32F0XX_ENABLE_DMA1_CH6_7
+#endif
+
+/*******************************************************************************
+ *  function prototypes (scope: module-local)
+ ******************************************************************************/
+
+/* DMA1 Channel Events */
+__WEAK void DMA1_Channel1_Event(uint32_t event);
+__WEAK void DMA1_Channel2_Event(uint32_t event);
+__WEAK void DMA1_Channel3_Event(uint32_t event);
+__WEAK void DMA1_Channel4_Event(uint32_t event);
+__WEAK void DMA1_Channel5_Event(uint32_t event);
+#if defined(STM32F0XX_ENABLE_DMA1_CH6_7)
+__WEAK void DMA1_Channel6_Event(uint32_t event);
+__WEAK void DMA1_Channel7_Event(uint32_t event);
+#endif
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+/**
+ * @fn          void DMA_ChannelInitialize(DMA_INFO *info)
+ * @brief       Initialize DMA Channel
+ * @param[in]   info  DMA info
+ */
+void DMA_ChannelInitialize(DMA_INFO *info)
+{
+  if (info == NULL)
+    return;
+
+  uint32_t offset = (info->ch_num-1) << 2U;
+
+  RCC_EnablePeriph(RCC_PERIPH_DMA1);
+
+  /* Disable the peripheral */
+  info->instance->CCR = 0U;
+#if defined(DMA_CSELR_C1S)
+  /* Select the channel request */
+  DMA1->CSELR = (DMA1->CSELR & ~(0xFU << offset)) | ((uint32_t)info->request << offset);
+#endif
+  /* Clear all flags */
+  DMA1->IFCR = 0xFU << offset;
+  /* Enable IRQ */
+  NVIC_ClearPendingIRQ(info->irq_num);
+  NVIC_SetPriority(info->irq_num, RTE_DMA_INT_PRIORITY);
+  NVIC_EnableIRQ(info->irq_num);
+}
+
+/**
+ * @fn          void DMA_ChannelUninitialize(DMA_INFO *info)
+ * @brief       Uninitialize DMA Channel
+ * @param[in]   info  DMA info
+ */
+void DMA_ChannelUninitialize(DMA_INFO *info)
+{
+  if (info == NULL)
+    return;
+
+  uint32_t offset = (info->ch_num-1) << 2U;
+
+  /* The IRQ stays enabled, the vector is shared with other channels */
+  /* Disable the peripheral */
+  info->instance->CCR = 0U;
+  /* Clear all flags */
+  DMA1->IFCR = 0xFU << offset;
+}
+
+/**
+ * @fn          void DMA_ChannelConfigure(DMA_Channel_TypeDef *dma_cnl, uint32_t cfg, uint32_t paddr, uint32_t maddr, uint16_t num)
+ * @brief       Configure DMA channel for next transfer
+ * @param[in]   dma_cnl  Pointer to DMA channel peripheral
+ * @param[in]   cfg      Configuration register value
+ * @param[in]   paddr    Peripheral address register value
+ * @param[in]   maddr    Memory address register value
+ * @param[in]   num      Number of data transfer register value (up to 65535)
+ */
+void DMA_ChannelConfigure(DMA_Channel_TypeDef *dma_cnl, uint32_t cfg, uint32_t paddr, uint32_t maddr, uint16_t num)
+{
+  __IO uint32_t ccr = dma_cnl->CCR;
+
+  /* If DMA channel is enable */
+  if (ccr & DMA_CCR_EN_Msk) {
+    /* Disable DMA channel */
+    dma_cnl->CCR = ccr & ~DMA_CCR_EN_Msk;
+  }
+
+  /* Configure DMA channel */
+  dma_cnl->CPAR  = paddr;
+  dma_cnl->CMAR  = maddr;
+  dma_cnl->CNDTR = num;
+  dma_cnl->CCR   = cfg;
+}
+
+void DMA1_Channel1_Event(uint32_t event)
+{
+  __NOP();
+}
+
+void DMA1_Channel2_Event(uint32_t event)
+{
+  __NOP();
+}
+
+void DMA1_Channel3_Event(uint32_t event)
+{
+  __NOP();
+}
+
+void DMA1_Channel4_Event(uint32_t event)
+{
+  __NOP();
+}
+
+void DMA1_Channel5_Event(uint32_t event)
+{
+  __NOP();
+}
+
+#if defined(STM32F0XX_ENABLE_DMA1_CH6_7)
+
+void DMA1_Channel6_Event(uint32_t event)
+{
+  __NOP();
+}
+
+void DMA1_Channel7_Event(uint32_t event)
+{
+  __NOP();
+}
+
+#endif  /* STM32F0XX_ENABLE_DMA1_CH6_7 */
+
+/*******************************************************************************
+ *  Interrupt Handlers
+ ******************************************************************************/
+
+/**
+ \fn          void DMA1_Channel1_IRQHandler (void)
+ \brief       DMA1 Channel1 interrupt handler
+ */
+void DMA1_Channel1_IRQHandler(void)
+{
+  uint32_t events;
+
+  events = (DMA1->ISR >> 0) & DMA_CHANNEL_FLAGS;
+  DMA1->IFCR = events << 0;
+  DMA1_Channel1_Event(events);
+}
+
+/**
+ \fn          void DMA1_Channel2_3_IRQHandler (void)
+ \brief       DMA1 Channel 2 and 3 interrupt handler
+ */
+void DMA1_Channel2_3_IRQHandler(void)
+{
+  uint32_t events;
+
+  events = (DMA1->ISR >> 4) & DMA_CHANNEL_FLAGS;
+  if (events) {
+    /* Channel 2 events */
+    DMA1->IFCR = events << 4;
+    DMA1_Channel2_Event(events);
+  }
+
+  events = (DMA1->ISR >> 8) & DMA_CHANNEL_FLAGS;
+  if (events) {
+    /* Channel 3 events */
+    DMA1->IFCR = events << 8;
+    DMA1_Channel3_Event(events);
+  }
+}
+
+/**
+ \fn          void DMA1_Channel4_5_6_7_IRQHandler (void)
+ \brief       DMA1 Channel 4 to 7 interrupt handler
+ */
+void DMA1_Channel4_5_6_7_IRQHandler(void)
+{
+  uint32_t events;
+
+  events = (DMA1->ISR >> 12) & DMA_CHANNEL_FLAGS;
+  if (events) {
+    /* Channel 4 events */
+    DMA1->IFCR = events << 12;
+    DMA1_Channel4_Event(events);
+  }
+
+  events = (DMA1->ISR >> 16) & DMA_CHANNEL_FLAGS;
+  if (events) {
+    /* Channel 5 events */
+    DMA1->IFCR = events << 16;
+    DMA1_Channel5_Event(events);
+  }
+
+#if defined(STM32F0XX_ENABLE_DMA1_CH6_7)
+  events = (DMA1->ISR >> 20) & DMA_CHANNEL_FLAGS;
+  if (events) {
+    /* Channel 6 events */
+    DMA1->IFCR = events << 20;
+    DMA1_Channel6_Event(events);
+  }
+
+  events = (DMA1->ISR >> 24) & DMA_CHANNEL_FLAGS;
+  if (events) {
+    /* Channel 7 events */
+    DMA1->IFCR = events << 24;
+    DMA1_Channel7_Event(events);
+  }
+#endif
+}
+
+/* ----------------------------- End of file ---------------------------------*/
@@ -76,11 +76,41 @@ static const GPIO_PIN_CFG_t I2C_pin_cfg_analog = {
 /* I2C1 Information (Run-Time) */
 static I2C_INFO I2C1_Info;
 
+#if (RTE_I2C1_RX_DMA == 1)
+/* I2C1 DMA Rx Information */
+static DMA_INFO I2C1_DMA_Rx = {
+  I2C1_RX_DMA_Instance,
+  I2C1_RX_DMA_Channel,
+  I2C1_RX_DMA_Priority,
+  I2C_DMA_REQUEST,
+  I2C1_RX_DMA_IRQn,
+};
+#endif
+
+#if (RTE_I2C1_TX_DMA == 1)
+/* I2C1 DMA Tx Information */
+static DMA_INFO I2C1_DMA_Tx = {
+  I2C1_TX_DMA_Instance,
+  I2C1_TX_DMA_Channel,
+  I2C1_TX_DMA_Priority,
+  I2C_DMA_REQUEST,
+  I2C1_TX_DMA_IRQn,
+};
+#endif
+
 /* I2C1 Resources */
 static I2C_RESOURCES I2C1_Resources = {
   I2C1,
+#if (RTE_I2C1_RX_DMA == 1)
+  &I2C1_DMA_Rx,
+#else
   NULL,
+#endif
+#if (RTE_I2C1_TX_DMA == 1)
+  &I2C1_DMA_Tx,
+#else
   NULL,
+#endif
   {
       RTE_I2C1_SCL_PORT,
       RTE_I2C1_SCL_PIN,
@@ -100,11 +130,41 @@ static I2C_RESOURCES I2C1_Resources = {
 /* I2C2 Information (Run-Time) */
 static I2C_INFO I2C2_Info;
 
+#if (RTE_I2C2_RX_DMA == 1)
+/* I2C2 DMA Rx Information */
+static DMA_INFO I2C2_DMA_Rx = {
+  I2C2_RX_DMA_Instance,
+  I2C2_RX_DMA_Channel,
+  I2C2_RX_DMA_Priority,
+  I2C_DMA_REQUEST,
+  I2C2_RX_DMA_IRQn,
+};
+#endif
+
+#if (RTE_I2C2_TX_DMA == 1)
+/* I2C2 DMA Tx Information */
+static DMA_INFO I2C2_DMA_Tx = {
+  I2C2_TX_DMA_Instance,
+  I2C2_TX_DMA_Channel,
+  I2C2_TX_DMA_Priority,
+  I2C_DMA_REQUEST,
+  I2C2_TX_DMA_IRQn,
+};
+#endif
+
 /* I2C2 Resources */
 static I2C_RESOURCES I2C2_Resources = {
   I2C2,
+#if (RTE_I2C2_RX_DMA == 1)
+  &I2C2_DMA_Rx,
+#else
   NULL,
+#endif
+#if (RTE_I2C2_TX_DMA == 1)
+  &I2C2_DMA_Tx,
+#else
   NULL,
+#endif
   {
       RTE_I2C2_SCL_PORT,
       RTE_I2C2_SCL_PIN,
@@ -141,6 +201,65 @@ uint32_t GetI2CCLK(I2C_RESOURCES *i2c)
   return (clk);
 }
 
+#if defined(I2C_DMA)
+/**
+ * @fn          void I2C_DMA_Start(DMA_INFO *dma, uint32_t dir, uint32_t paddr, I2C_RESOURCES *i2c)
+ * @brief       Start the DMA channel for the current transfer buffer.
+ * @param[in]   dma     DMA channel information
+ * @param[in]   dir     DMA_MEMORY_TO_PERIPHERAL or DMA_PERIPHERAL_TO_MEMORY
+ * @param[in]   paddr   Address of the I2C data register
+ * @param[in]   i2c     Pointer to I2C resources
+ */
+static
+void I2C_DMA_Start(DMA_INFO *dma, uint32_t dir, uint32_t paddr, I2C_RESOURCES *i2c)
+{
+  I2C_TRANSFER_INFO *xfer = &i2c->info->xfer;
+
+  /* The transfer end is signaled by the I2C TC/STOPF interrupts */
+  DMA_ChannelConfigure(dma->instance,
+                       DMA_PRIORITY(dma->priority) | DMA_MEMORY_INCREMENT | dir,
+                       paddr, (uint32_t)xfer->data, (uint16_t)xfer->num);
+  DMA_ChannelEnable(dma->instance);
+
+  if (dir == DMA_MEMORY_TO_PERIPHERAL) {
+    xfer->ctrl |= XFER_CTRL_DMA_TX;
+  }
+  else {
+    xfer->ctrl |= XFER_CTRL_DMA_RX;
+  }
+}
+
+/**
+ * @fn          void I2C_DMA_Stop(I2C_RESOURCES *i2c)
+ * @brief       Update the transfer counter from the DMA channel and disable it.
+ * @param[in]   i2c   Pointer to I2C resources
+ */
+static
+void I2C_DMA_Stop(I2C_RESOURCES *i2c)
+{
+  I2C_TRANSFER_INFO *xfer = &i2c->info->xfer;
+  DMA_INFO *dma;
+
+  if (xfer->ctrl & XFER_CTRL_DMA_TX) {
+    dma = i2c->dma_tx;
+  }
+  else if (xfer->ctrl & XFER_CTRL_DMA_RX) {
+    dma = i2c->dma_rx;
+  }
+  else {
+    return;
+  }
+
+  DMA_ChannelDisable(dma->instance);
+
+  if (xfer->cnt >= 0) {
+    xfer->cnt = (int32_t)(xfer->num - DMA_ChannelTransferItemCount(dma->instance));
+  }
+
+  xfer->ctrl &= ~(XFER_CTRL_DMA_TX | XFER_CTRL_DMA_RX);
+}
+#endif
+
 /**
  * @fn      ARM_DRIVER_VERSION I2C_GetVersion(void)
  * @brief   Get driver version.
@@ -244,6 +363,12 @@ int32_t I2Cx_PowerControl(ARM_POWER_STATE state, I2C_RESOURCES *i2c)
       /* Disable I2C IRQ */
       NVIC_DisableIRQ(i2c->irq_num);
 
+#if defined(I2C_DMA)
+      /* Disable DMA channels */
+      DMA_ChannelUninitialize(i2c->dma_rx);
+      DMA_ChannelUninitialize(i2c->dma_tx);
+#endif
+
       /* Disable peripheral clock */
       RCC->APB1ENR &= ~i2c->rcc_mask;
 
@@ -278,6 +403,12 @@ int32_t I2Cx_PowerControl(ARM_POWER_STATE state, I2C_RESOURCES *i2c)
       __NOP(); __NOP(); __NOP(); __NOP();
       RCC->APB1RSTR &= ~i2c->rcc_mask;
 
+#if defined(I2C_DMA)
+      /* Initialize DMA channels */
+      DMA_ChannelInitialize(i2c->dma_rx);
+      DMA_ChannelInitialize(i2c->dma_tx);
+#endif
+
       /* Initial peripheral setup */
       cr1 = I2C_CR1_SBC    | /* Slave byte control enabled          */
             I2C_CR1_ERRIE  | /* Error interrupts enabled            */
@@ -428,6 +559,11 @@ int32_t I2Cx_MasterTransmit(uint32_t addr, const uint8_t *data, uint32_t num,
     return (ARM_DRIVER_ERROR_PARAMETER);
   }
 
+  if ((i2c->dma_tx != NULL) && (num > 0xFFFFU)) {
+    /* DMA transfers up to 65535 bytes */
+    return (ARM_DRIVER_ERROR_PARAMETER);
+  }
+
   if ((addr & ~(ARM_I2C_ADDRESS_10BIT | ARM_I2C_ADDRESS_GC)) > 0x3FFU) {
     return (ARM_DRIVER_ERROR_PARAMETER);
   }
@@ -487,6 +623,12 @@ int32_t I2Cx_MasterTransmit(uint32_t addr, const uint8_t *data, uint32_t num,
     cr2 |= I2C_CR2_RELOAD;
   }
 
+#if defined(I2C_DMA)
+  if (i2c->dma_tx != NULL) {
+    I2C_DMA_Start(i2c->dma_tx, DMA_MEMORY_TO_PERIPHERAL, (uint32_t)&i2c_reg->TXDR, i2c);
+  }
+#endif
+
   /* Apply transfer setup */
   i2c_reg->CR2 = (cnt << 16) | cr2;
 
@@ -521,6 +663,11 @@ int32_t I2Cx_MasterReceive(uint32_t addr, uint8_t *data, uint32_t num,
     return (ARM_DRIVER_ERROR_PARAMETER);
   }
 
+  if ((i2c->dma_rx != NULL) && (num > 0xFFFFU)) {
+    /* DMA transfers up to 65535 bytes */
+    return (ARM_DRIVER_ERROR_PARAMETER);
+  }
+
   if ((addr & ~(ARM_I2C_ADDRESS_10BIT | ARM_I2C_ADDRESS_GC)) > 0x3FFU) {
     return (ARM_DRIVER_ERROR_PARAMETER);
   }
@@ -580,6 +727,12 @@ int32_t I2Cx_MasterReceive(uint32_t addr, uint8_t *data, uint32_t num,
     cr2 |= I2C_CR2_RELOAD;
   }
 
+#if defined(I2C_DMA)
+  if (i2c->dma_rx != NULL) {
+    I2C_DMA_Start(i2c->dma_rx, DMA_PERIPHERAL_TO_MEMORY, (uint32_t)&i2c_reg->RXDR, i2c);
+  }
+#endif
+
   /* Apply transfer setup */
   i2c_reg->CR2 = (cnt << 16) | cr2;
 
@@ -611,6 +764,11 @@ int32_t I2Cx_SlaveTransmit(const uint8_t *data, uint32_t num, I2C_RESOURCES *i2c
     return (ARM_DRIVER_ERROR_PARAMETER);
   }
 
+  if ((i2c->dma_tx != NULL) && (num > 0xFFFFU)) {
+    /* DMA transfers up to 65535 bytes */
+    return (ARM_DRIVER_ERROR_PARAMETER);
+  }
+
   if (info->status.busy) {
     return (ARM_DRIVER_ERROR_BUSY);
   }
@@ -623,6 +781,12 @@ int32_t I2Cx_SlaveTransmit(const uint8_t *data, uint32_t num, I2C_RESOURCES *i2c
   info->xfer.data = (uint8_t *)data;
   info->xfer.ctrl = 0U;
 
+#if defined(I2C_DMA)
+  if (i2c->dma_tx != NULL) {
+    I2C_DMA_Start(i2c->dma_tx, DMA_MEMORY_TO_PERIPHERAL, (uint32_t)&i2c_reg->TXDR, i2c);
+  }
+#endif
+
   /* Set number of bytes to transfer */
   if (num < 256) {
     i2c_reg->CR2 = (num << 16);
@@ -655,6 +819,11 @@ int32_t I2Cx_SlaveReceive(uint8_t *data, uint32_t num, I2C_RESOURCES *i2c)
     return (ARM_DRIVER_ERROR_PARAMETER);
   }
 
+  if ((i2c->dma_rx != NULL) && (num > 0xFFFFU)) {
+    /* DMA transfers up to 65535 bytes */
+    return (ARM_DRIVER_ERROR_PARAMETER);
+  }
+
   if (info->status.busy) {
     return (ARM_DRIVER_ERROR_BUSY);
   }
@@ -667,6 +836,12 @@ int32_t I2Cx_SlaveReceive(uint8_t *data, uint32_t num, I2C_RESOURCES *i2c)
   info->xfer.data = data;
   info->xfer.ctrl = 0U;
 
+#if defined(I2C_DMA)
+  if (i2c->dma_rx != NULL) {
+    I2C_DMA_Start(i2c->dma_rx, DMA_PERIPHERAL_TO_MEMORY, (uint32_t)&i2c_reg->RXDR, i2c);
+  }
+#endif
+
   /* Set number of bytes to transfer */
   if (num < 256) {
     i2c_reg->CR2 = (num << 16);
@@ -688,7 +863,20 @@ int32_t I2Cx_SlaveReceive(uint8_t *data, uint32_t num, I2C_RESOURCES *i2c)
 static
 int32_t I2Cx_GetDataCount(I2C_RESOURCES *i2c)
 {
-  return (i2c->info->xfer.cnt);
+  I2C_TRANSFER_INFO *xfer = &i2c->info->xfer;
+
+#if defined(I2C_DMA)
+  if (xfer->cnt >= 0) {
+    if (xfer->ctrl & XFER_CTRL_DMA_TX) {
+      return ((int32_t)(xfer->num - DMA_ChannelTransferItemCount(i2c->dma_tx->instance)));
+    }
+    if (xfer->ctrl & XFER_CTRL_DMA_RX) {
+      return ((int32_t)(xfer->num - DMA_ChannelTransferItemCount(i2c->dma_rx->instance)));
+    }
+  }
+#endif
+
+  return (xfer->cnt);
 }
 
 /**
@@ -732,6 +920,14 @@ void I2Cx_IRQHandler(I2C_RESOURCES *i2c)
       /* Transfer Complete */
       info->status.busy = 0U;
 
+#if defined(I2C_DMA)
+      if (xfer->ctrl & (XFER_CTRL_DMA_TX | XFER_CTRL_DMA_RX)) {
+        /* All bytes are on the bus, the channel completes by itself */
+        xfer->cnt   = (int32_t)xfer->num;
+        xfer->ctrl &= ~(XFER_CTRL_DMA_TX | XFER_CTRL_DMA_RX);
+      }
+#endif
+
       if (xfer->ctrl & XFER_CTRL_RESTART) {
         /* Wait for pending transfer */
         reg->CR1 &= ~I2C_CR1_TCIE;
@@ -747,6 +943,13 @@ void I2Cx_IRQHandler(I2C_RESOURCES *i2c)
       /* Transfer Complete Reload */
       uint32_t cr = reg->CR2;
 
+#if defined(I2C_DMA)
+      if (xfer->ctrl & (XFER_CTRL_DMA_TX | XFER_CTRL_DMA_RX)) {
+        /* The DMA may still be reading the last byte, count the reloaded ones */
+        xfer->cnt += (int32_t)((cr & I2C_CR2_NBYTES) >> 16);
+      }
+#endif
+
       cr &= ~(I2C_CR2_RELOAD | I2C_CR2_NBYTES);
 
       uint32_t cnt = xfer->num - xfer->cnt;
@@ -771,6 +974,10 @@ void I2Cx_IRQHandler(I2C_RESOURCES *i2c)
       /* Stop detection flag */
       icr |= I2C_ICR_STOPCF;
 
+#if defined(I2C_DMA)
+      I2C_DMA_Stop(i2c);
+#endif
+
       if (xfer->ctrl & XFER_CTRL_ADDR_NACK) {
         /* Slave address not acknowledged */
         event = ARM_I2C_EVENT_TRANSFER_DONE | ARM_I2C_EVENT_ADDRESS_NACK;
@@ -836,6 +1043,9 @@ void I2Cx_IRQHandler(I2C_RESOURCES *i2c)
       /* Master sends STOP after slave NACK */
       /* Slave already released the lines   */
       if (info->status.mode) {
+#if defined(I2C_DMA)
+        I2C_DMA_Stop(i2c);
+#endif
         if (xfer->cnt == 0) {
           xfer->ctrl |= XFER_CTRL_ADDR_NACK;
         }
@@ -853,6 +1063,10 @@ void I2Cx_IRQHandler(I2C_RESOURCES *i2c)
       /* Arbitration lost */
       icr |= I2C_ICR_ARLOCF;
 
+#if defined(I2C_DMA)
+      I2C_DMA_Stop(i2c);
+#endif
+
       /* Switch to slave mode */
       info->status.busy             = 0U;
       info->status.mode             = 0U;
@@ -873,6 +1087,10 @@ void I2Cx_IRQHandler(I2C_RESOURCES *i2c)
         /* Lines are released in slave mode */
         info->status.busy = 0U;
 
+#if defined(I2C_DMA)
+        I2C_DMA_Stop(i2c);
+#endif
+
         xfer->data = NULL;
         xfer->ctrl = 0U;
       }
@@ -27,6 +27,7 @@
 #include <stdbool.h>
 
 #include <Driver/Driver_I2C.h>
+#include <Driver/DMA_STM32F0xx.h>
 #include <device_config.h>
 
 /*******************************************************************************
@@ -50,6 +51,22 @@
   #define I2C1_SDA_GPIO_PORT        RTE_I2C1_SDA_PORT
   #define I2C1_SDA_GPIO_PIN         RTE_I2C1_SDA_PIN
   #define I2C1_SDA_GPIO_FUNC        RTE_I2C1_SDA_FUNC
+
+  #if (RTE_I2C1_RX_DMA == 1)
+    #define I2C1_RX_DMA_Instance    DMAx_CHANNELy(RTE_I2C1_RX_DMA_NUMBER, RTE_I2C1_RX_DMA_CHANNEL)
+    #define I2C1_RX_DMA_Number      RTE_I2C1_RX_DMA_NUMBER
+    #define I2C1_RX_DMA_Channel     RTE_I2C1_RX_DMA_CHANNEL
+    #define I2C1_RX_DMA_Priority    RTE_I2C1_RX_DMA_PRIORITY
+    #define I2C1_RX_DMA_IRQn        DMA1_CHANNELy_IRQn(RTE_I2C1_RX_DMA_CHANNEL)
+  #endif
+
+  #if (RTE_I2C1_TX_DMA == 1)
+    #define I2C1_TX_DMA_Instance    DMAx_CHANNELy(RTE_I2C1_TX_DMA_NUMBER, RTE_I2C1_TX_DMA_CHANNEL)
+    #define I2C1_TX_DMA_Number      RTE_I2C1_TX_DMA_NUMBER
+    #define I2C1_TX_DMA_Channel     RTE_I2C1_TX_DMA_CHANNEL
+    #define I2C1_TX_DMA_Priority    RTE_I2C1_TX_DMA_PRIORITY
+    #define I2C1_TX_DMA_IRQn        DMA1_CHANNELy_IRQn(RTE_I2C1_TX_DMA_CHANNEL)
+  #endif
 #endif
 
 /* I2C2 configuration definitions */
@@ -67,8 +84,32 @@
   #define I2C2_SDA_GPIO_PORT        RTE_I2C2_SDA_PORT
   #define I2C2_SDA_GPIO_PIN         RTE_I2C2_SDA_PIN
   #define I2C2_SDA_GPIO_FUNC        RTE_I2C2_SDA_FUNC
+
+  #if (RTE_I2C2_RX_DMA == 1)
+    #define I2C2_RX_DMA_Instance    DMAx_CHANNELy(RTE_I2C2_RX_DMA_NUMBER, RTE_I2C2_RX_DMA_CHANNEL)
+    #define I2C2_RX_DMA_Number      RTE_I2C2_RX_DMA_NUMBER
+    #define I2C2_RX_DMA_Channel     RTE_I2C2_RX_DMA_CHANNEL
+    #define I2C2_RX_DMA_Priority    RTE_I2C2_RX_DMA_PRIORITY
+    #define I2C2_RX_DMA_IRQn        DMA1_CHANNELy_IRQn(RTE_I2C2_RX_DMA_CHANNEL)
+  #endif
+
+  #if (RTE_I2C2_TX_DMA == 1)
+    #define I2C2_TX_DMA_Instance    DMAx_CHANNELy(RTE_I2C2_TX_DMA_NUMBER, RTE_I2C2_TX_DMA_CHANNEL)
+    #define I2C2_TX_DMA_Number      RTE_I2C2_TX_DMA_NUMBER
+    #define I2C2_TX_DMA_Channel     RTE_I2C2_TX_DMA_CHANNEL
+    #define I2C2_TX_DMA_Priority    RTE_I2C2_TX_DMA_PRIORITY
+    #define I2C2_TX_DMA_IRQn        DMA1_CHANNELy_IRQn(RTE_I2C2_TX_DMA_CHANNEL)
+  #endif
+#endif
+
+#if (defined(USE_I2C1) && ((RTE_I2C1_RX_DMA == 1) || (RTE_I2C1_TX_DMA == 1))) || \
+    (defined(USE_I2C2) && ((RTE_I2C2_RX_DMA == 1) || (RTE_I2C2_TX_DMA == 1)))
+  #define I2C_DMA
 #endif
 
+/* DMA request selection of the I2C channels (devices with DMA1->CSELR) */
+#define I2C_DMA_REQUEST     2U
+
 /* Current driver status flag definition */
 #define I2C_FLAG_INIT       ((uint8_t)0x01)   // I2C initialized
 #define I2C_FLAG_POWER      ((uint8_t)0x02)   // I2C powered on
@@ -79,13 +120,13 @@
 #define XFER_CTRL_STOP      ((uint8_t)0x02)   // Generate repeated start and readdress
 #define XFER_CTRL_ADDR_NACK ((uint8_t)0x04)   // Slave address not acknowledged
 #define XFER_CTRL_ADDR_DONE ((uint8_t)0x08)   // Addressing done
+#define XFER_CTRL_DMA_TX    ((uint8_t)0x10)   // Data transmitted by the DMA
+#define XFER_CTRL_DMA_RX    ((uint8_t)0x20)   // Data received by the DMA
 
 /*******************************************************************************
  *  typedefs and structures (scope: module-local)
  ******************************************************************************/
 
-typedef void* I2C_DMA;
-
 /* I2C Input/Output Configuration */
 typedef const struct _I2C_IO {
   GPIO_PORT_t           scl_port;           // SCL IO port
@@ -115,8 +156,8 @@ typedef struct _I2C_INFO {
 /* I2C Resource Configuration */
 typedef struct {
   I2C_TypeDef          *reg;                // I2C peripheral register interface
-  I2C_DMA              *dma_rx;             // I2C DMA Configuration
-  I2C_DMA              *dma_tx;             // I2C DMA Configuration
+  DMA_INFO             *dma_rx;             // I2C DMA Rx Configuration
+  DMA_INFO             *dma_tx;             // I2C DMA Tx Configuration
   I2C_IO                io;                 // I2C Input/Output pins
   IRQn_Type             irq_num;            // I2C IRQ Number
   uint32_t              rcc_mask;           // RCC Clock/Reset register mask
@@ -149,6 +149,7 @@ typedef enum {
 
 typedef enum {
   /* AHB */
+  RCC_PERIPH_DMA1  = (int32_t)(RCC_AHBENR_DMAEN   | RCC_PERIPH_AHB_MASK),
   RCC_PERIPH_GPIOA = (int32_t)(RCC_AHBENR_GPIOAEN | RCC_PERIPH_AHB_MASK),
   RCC_PERIPH_GPIOB = (int32_t)(RCC_AHBENR_GPIOBEN | RCC_PERIPH_AHB_MASK),
   RCC_PERIPH_GPIOC = (int32_t)(RCC_AHBENR_GPIOCEN | RCC_PERIPH_AHB_MASK),
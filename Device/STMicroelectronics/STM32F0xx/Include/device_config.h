@@ -43,6 +43,7 @@
 /* Interrupt Priority */
 #define RTE_I2C_INT_PRIORITY            (1U)
 #define RTE_USART_INT_PRIORITY          (1U)
+#define RTE_DMA_INT_PRIORITY            (1U)
 
 
 // <e> USART1 (Universal synchronous asynchronous receiver transmitter) [Driver_USART1]
@@ -223,6 +224,32 @@
 #else
   #error "Invalid I2C1_SDA Pin Configuration!"
 #endif
+
+//   <e> DMA Rx
+//     <o1> Number <1=>1
+//     <i>  Selects DMA Number (only DMA1 can be used)
+//     <o2> Channel <3=>3
+//     <i>  Selects DMA Channel (only Channel 3 can be used)
+//     <o3> Priority <0=>Low <1=>Medium <2=>High <3=>Very High
+//     <i>  Selects DMA Priority
+//   </e>
+#define   RTE_I2C1_RX_DMA               0
+#define   RTE_I2C1_RX_DMA_NUMBER        1
+#define   RTE_I2C1_RX_DMA_CHANNEL       3
+#define   RTE_I2C1_RX_DMA_PRIORITY      0
+
+//   <e> DMA Tx
+//     <o1> Number <1=>1
+//     <i>  Selects DMA Number (only DMA1 can be used)
+//     <o2> Channel <2=>2
+//     <i>  Selects DMA Channel (only Channel 2 can be used)
+//     <o3> Priority <0=>Low <1=>Medium <2=>High <3=>Very High
+//     <i>  Selects DMA Priority
+//   </e>
+#define   RTE_I2C1_TX_DMA               0
+#define   RTE_I2C1_TX_DMA_NUMBER        1
+#define   RTE_I2C1_TX_DMA_CHANNEL       2
+#define   RTE_I2C1_TX_DMA_PRIORITY      0
 // </e> I2C1 (Inter-integrated Circuit Interface 1) [Driver_I2C1]
 
 // <e> I2C2 (Inter-integrated Circuit Interface 2) [Driver_I2C2]
@@ -255,6 +282,32 @@
 #else
   #error "Invalid I2C2_SDA Pin Configuration!"
 #endif
+
+//   <e> DMA Rx
+//     <o1> Number <1=>1
+//     <i>  Selects DMA Number (only DMA1 can be used)
+//     <o2> Channel <5=>5
+//     <i>  Selects DMA Channel (only Channel 5 can be used)
+//     <o3> Priority <0=>Low <1=>Medium <2=>High <3=>Very High
+//     <i>  Selects DMA Priority
+//   </e>
+#define   RTE_I2C2_RX_DMA               0
+#define   RTE_I2C2_RX_DMA_NUMBER        1
+#define   RTE_I2C2_RX_DMA_CHANNEL       5
+#define   RTE_I2C2_RX_DMA_PRIORITY      0
+
+//   <e> DMA Tx
+//     <o1> Number <1=>1
+//     <i>  Selects DMA Number (only DMA1 can be used)
+//     <o2> Channel <4=>4
+//     <i>  Selects DMA Channel (only Channel 4 can be used)
+//     <o3> Priority <0=>Low <1=>Medium <2=>High <3=>Very High
+//     <i>  Selects DMA Priority
+//   </e>
+#define   RTE_I2C2_TX_DMA               0
+#define   RTE_I2C2_TX_DMA_NUMBER        1
+#define   RTE_I2C2_TX_DMA_CHANNEL       4
+#define   RTE_I2C2_TX_DMA_PRIORITY      0
 // </e> I2C2 (Inter-integrated Circuit Interface 2) [Driver_I2C2]
 
 #endif /* DEVICE_CONFIG_H_ */
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: CRC unit port for STMicroelectronics STM32F1xx
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "asm/stm32f1xx.h"
+#include "asm/RCC_STM32F1xx.h"
+#include <CRC/crc.h>
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+/* The unit has a fixed polynomial and starts from all ones */
+#define CRC_UNIT_POLY                 (0x04C11DB7UL)
+#define CRC_UNIT_INIT                 (0xFFFFFFFFUL)
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static volatile uint32_t busy;
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+/**
+ * @fn          bool UnitAcquire(void)
+ * @brief       Take the CRC unit without blocking, also from interrupts.
+ * @return      true - unit taken, false - unit in use.
+ */
+static bool UnitAcquire(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  bool     ret     = false;
+
+  __disable_irq();
+  if (busy == 0U) {
+    busy = 1U;
+    ret  = true;
+  }
+  __set_PRIMASK(primask);
+
+  return (ret);
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+/**
+ * @fn          int32_t CRC_PortInitialize(void)
+ * @brief       Initialize the CRC unit.
+ * @return      CRC_OK
+ */
+int32_t CRC_PortInitialize(void)
+{
+  RCC_EnablePeriph(RCC_PERIPH_CRC);
+  busy = 0U;
+
+  return (CRC_OK);
+}
+
+/**
+ * @fn          int32_t CRC_PortCalc(const CRC_Param_t *param, uint32_t *reg, const void *data, uint32_t len, CRC_PortCallback_t cb)
+ * @brief       Run a block through the CRC unit. The unit only implements the
+ *              32-bit polynomial 0x04C11DB7 and is fed by the CPU.
+ * @param[in]   param  CRC algorithm
+ * @param[in,out] reg  Register value
+ * @param[in]   data   Pointer to the data, word aligned
+ * @param[in]   len    Data length in bytes, multiple of four
+ * @param[in]   cb     Not used, no DMA
+ * @return      CRC_OK, CRC_ERROR_BUSY or CRC_ERROR_UNSUPPORTED.
+ */
+int32_t CRC_PortCalc(const CRC_Param_t *param, uint32_t *reg, const void *data, uint32_t len, CRC_PortCallback_t cb)
+{
+  const uint32_t *p = data;
+  uint32_t        n = len / 4U;
+
+  (void)cb;
+
+  if ((param->width != 32U) || (param->poly != CRC_UNIT_POLY)) {
+    return (CRC_ERROR_UNSUPPORTED);
+  }
+
+  if (n == 0U) {
+    return (CRC_OK);
+  }
+
+  if (!UnitAcquire()) {
+    return (CRC_ERROR_BUSY);
+  }
+
+  CRC->CR = CRC_CR_RESET;
+
+  /*
+   * The unit shifts words in MSB first. Reflected data is bit reversed, other
+   * data byte swapped. The register value is merged into the first word, as
+   * the unit can not be loaded with it.
+   */
+  if (param->reflect != 0U) {
+    CRC->DR = __RBIT(*p++ ^ *reg) ^ CRC_UNIT_INIT;
+    while (--n != 0U) {
+      CRC->DR = __RBIT(*p++);
+    }
+    *reg = __RBIT(CRC->DR);
+  }
+  else {
+    CRC->DR = __REV(*p++) ^ *reg ^ CRC_UNIT_INIT;
+    while (--n != 0U) {
+      CRC->DR = __REV(*p++);
+    }
+    *reg = CRC->DR;
+  }
+
+  busy = 0U;
+
+  return (CRC_OK);
+}
+
+/**
+ * @fn          int32_t CRC_PortFinish(uint32_t *reg)
+ * @brief       No DMA fed blocks on this device.
+ * @return      CRC_ERROR
+ */
+int32_t CRC_PortFinish(uint32_t *reg)
+{
+  (void)reg;
+
+  return (CRC_ERROR);
+}
+
+/* ----------------------------- End of file ---------------------------------*/
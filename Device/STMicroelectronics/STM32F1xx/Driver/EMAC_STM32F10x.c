@@ -19,7 +19,7 @@
  *
  *
  * $Date:        20. October 2015
- * $Revision:    V2.1
+ * $Revision:    V2.2
  *
  * Driver:       Driver_ETH_MAC0
  * Configured:   via RTE_Device.h configuration file
@@ -34,6 +34,11 @@
  * -------------------------------------------------------------------------- */
 
 /* History:
+ *  Version 2.2
+ *    Added zero-copy receive/transmit and scatter-gather transmit
+ *    Added polled receive mode and receive statistics
+ *    Configurable number of DMA descriptors
+ *    Multicast hash calculated by the shared CRC module
  *  Version 2.1
  *    Added checking of EMAC_FLAG_POWER to the functions 
  *  Version 2.0
@@ -62,14 +67,30 @@
 
 #include "EMAC_STM32F10x.h"
 #include <asm/GPIO_STM32F10x.h>
+#include <CRC/crc.h>
 
-#define ARM_ETH_MAC_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(2,1) /* driver version */
+#define ARM_ETH_MAC_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(2,2) /* driver version */
 
 
 /* ETH Memory Buffer configuration */
+#ifndef NUM_RX_BUF
 #define NUM_RX_BUF          4U          /* 0x1800 for Rx (4*1536=6K)          */
+#endif
+#ifndef NUM_TX_BUF
 #define NUM_TX_BUF          2U          /* 0x0C00 for Tx (2*1536=3K)          */
+#endif
 #define ETH_BUF_SIZE        1536U       /* ETH Receive/Transmit buffer size   */
+#ifndef NUM_RX_RESERVE
+#define NUM_RX_RESERVE      1U          /* Rx buffers never lent by BORROW    */
+#endif
+
+#if ((NUM_RX_BUF < 2U) || (NUM_RX_BUF > 255U) || (NUM_TX_BUF < 2U) || (NUM_TX_BUF > 255U))
+#error "EMAC: number of DMA descriptors must be in the range 2..255!"
+#endif
+
+#if ((NUM_RX_RESERVE < 1U) || (NUM_RX_RESERVE >= NUM_RX_BUF))
+#error "EMAC: number of reserved Rx buffers must be in the range 1..NUM_RX_BUF-1!"
+#endif
 
 /* Interrupt Handler Prototype */
 void ETH_IRQHandler (void);
@@ -163,6 +184,7 @@ static void init_rx_desc (void) {
 
   ETH->DMARDLAR = (uint32_t)&rx_desc[0];
   Emac.rx_index = 0U;
+  Emac.rx_lent  = 0U;
 }
 
 /**
@@ -182,47 +204,134 @@ static void init_tx_desc (void) {
   }
   ETH->DMATDLAR = (uint32_t)&tx_desc[0];
   Emac.tx_index = 0U;
+  Emac.tx_clean = 0U;
+  Emac.tx_used  = 0U;
+  Emac.tx_asm   = 0U;
+  Emac.tx_done  = 0U;
+}
+
+/**
+  \fn          void rx_desc_return (uint32_t idx)
+  \brief       Return Rx DMA descriptor to ETH-DMA.
+  \param[in]   idx  Descriptor index
+  \return      none.
+*/
+static void rx_desc_return (uint32_t idx) {
+  rx_desc[idx].Stat = DMA_RX_OWN;
+
+  if (ETH->DMASR & ETH_DMASR_RBUS) {
+    /* Receive buffer unavailable, resume DMA */
+    ETH->DMASR   = ETH_DMASR_RBUS;
+    ETH->DMARPDR = 0;
+    Emac.rx_stats.rbus++;
+  }
+}
+
+/**
+  \fn          void rx_frame_count (uint32_t stat)
+  \brief       Update receive statistics with a frame taken from the ring.
+  \param[in]   stat  Rx DMA descriptor status
+  \return      none.
+*/
+static void rx_frame_count (uint32_t stat) {
+  if (((stat & DMA_RX_ES) != 0) ||
+      ((stat & DMA_RX_FS) == 0) ||
+      ((stat & DMA_RX_LS) == 0)) {
+    Emac.rx_stats.errors++;
+  }
+  else {
+    Emac.rx_stats.frames++;
+  }
+  Emac.rx_batch++;
 }
 
 /**
-  \fn          uint32_t crc32_8bit_rev (uint32_t crc32, uint8_t val)
-  \brief       Calculate 32-bit CRC (Polynomial: 0x04C11DB7, data bit-reversed).
-  \param[in]   crc32  CRC initial value
-  \param[in]   val    Input value
-  \return      Calculated CRC value
+  \fn          void tx_reclaim (void)
+  \brief       Release Tx DMA descriptors of transmitted frames.
+  \return      none.
 */
-static uint32_t crc32_8bit_rev (uint32_t crc32, uint8_t val) {
-  uint32_t n;
-
-  crc32 ^= __RBIT (val);
-  for (n = 8; n; n--) {
-    if (crc32 & 0x80000000U) {
-      crc32 <<= 1;
-      crc32  ^= 0x04C11DB7U;
-    } else {
-      crc32 <<= 1;
+static void tx_reclaim (void) {
+  uint32_t stat;
+
+  while (Emac.tx_used != 0U) {
+    stat = tx_desc[Emac.tx_clean].CtrlStat;
+    if (stat & DMA_TX_OWN) {
+      break;
     }
+    if (stat & DMA_TX_LS) {
+      Emac.tx_done++;
+    }
+    Emac.tx_clean++;
+    if (Emac.tx_clean == NUM_TX_BUF) { Emac.tx_clean = 0U; }
+    Emac.tx_used--;
   }
-  return (crc32);
 }
 
 /**
-  \fn          uint32_t crc32_data (const uint8_t *data, uint32_t len)
-  \brief       Calculate standard 32-bit Ethernet CRC.
-  \param[in]   data  Pointer to buffer containing the data
-  \param[in]   len   Data length in bytes
-  \return      Calculated CRC value
+  \fn          uint32_t tx_desc_free (void)
+  \brief       Get number of free Tx DMA descriptors.
+  \return      number of free descriptors.
+*/
+static uint32_t tx_desc_free (void) {
+  return (NUM_TX_BUF - Emac.tx_used - Emac.tx_asm);
+}
+
+/**
+  \fn          void tx_desc_close (uint32_t ctrl)
+  \brief       Add current Tx DMA descriptor to the frame being assembled.
+  \param[in]   ctrl  Additional control bits (DMA_TX_LS, DMA_TX_IC for the last segment)
+  \return      none.
 */
-static uint32_t crc32_data (const uint8_t *data, uint32_t len) {
-  uint32_t cnt, crc;
+static void tx_desc_close (uint32_t ctrl) {
+  ctrl |= DMA_TX_TCH;
+
+  if (Emac.tx_asm == 0U) {
+    /* First segment, handed to DMA when the frame is complete */
+    Emac.tx_first = Emac.tx_index;
+    ctrl |= DMA_TX_FS;
+  }
+  else {
+    /* DMA stops at the first segment until the frame is complete */
+    ctrl |= DMA_TX_OWN;
+  }
+  tx_desc[Emac.tx_index].CtrlStat = ctrl;
 
-  crc = 0xFFFFFFFFU;
-  for (cnt = len; cnt; cnt--) {
-    crc = crc32_8bit_rev (crc, *data++);
+  Emac.tx_asm++;
+  Emac.tx_index++;
+  if (Emac.tx_index == NUM_TX_BUF) { Emac.tx_index = 0U; }
+}
+
+/**
+  \fn          void tx_frame_abort (void)
+  \brief       Drop the Tx DMA descriptors of the frame being assembled.
+  \return      none.
+*/
+static void tx_frame_abort (void) {
+  /* DMA stops at the first descriptor, none of them was handed over */
+  while (Emac.tx_asm != 0U) {
+    if (Emac.tx_index == 0U) { Emac.tx_index = NUM_TX_BUF; }
+    Emac.tx_index--;
+    tx_desc[Emac.tx_index].CtrlStat = DMA_TX_TCH;
+    Emac.tx_asm--;
   }
-  return (crc ^ 0xFFFFFFFFU);
+  Emac.frame_end = NULL;
 }
 
+/**
+  \fn          int32_t tx_desc_wait (void)
+  \brief       Check why no Tx DMA descriptor is free.
+  \return      ARM_DRIVER_ERROR_BUSY when transmitted frames release descriptors,
+               ARM_DRIVER_ERROR when the frame being assembled needs more than
+               NUM_TX_BUF descriptors, the frame is dropped.
+*/
+static int32_t tx_desc_wait (void) {
+  if (Emac.tx_used != 0U) {
+    /* Transmitter is busy, wait */
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+  tx_frame_abort ();
+  return ARM_DRIVER_ERROR;
+}
 
 /* Ethernet Driver functions */
 
@@ -427,6 +536,9 @@ static int32_t PowerControl (ARM_POWER_STATE state) {
       NVIC_EnableIRQ (ETH_IRQn);
 
       Emac.frame_end = NULL;
+      Emac.rx_batch  = 0U;
+      memset (&Emac.rx_stats, 0, sizeof (ETH_MAC_RX_STATS));
+      Emac.flags    &= ~EMAC_FLAG_RX_POLL;
       Emac.flags    |= EMAC_FLAG_POWER;
       break;
 
@@ -552,7 +664,7 @@ static int32_t SetAddressFilter (const ARM_ETH_MAC_ADDR *ptr_addr, uint32_t num_
 
   /* Calculate 64-bit Hash table for remaining MAC addresses */
   for ( ; num_addr; ptr_addr++, num_addr--) {
-    crc = crc32_data (&ptr_addr->b[0], 6U) >> 26;
+    crc = __RBIT (CRC_Calc (CRC_TYPE_32, &ptr_addr->b[0], 6U)) >> 26;
     if (crc & 0x20U) {
       ETH->MACHTHR |= (1U << (crc & 0x1FU));
     }
@@ -575,6 +687,7 @@ static int32_t SetAddressFilter (const ARM_ETH_MAC_ADDR *ptr_addr, uint32_t num_
   \return      \ref execution_status
 */
 static int32_t SendFrame (const uint8_t *frame, uint32_t len, uint32_t flags) {
+  TX_Desc *txd;
   uint8_t *dst = Emac.frame_end;
   uint32_t ctrl;
 
@@ -586,18 +699,42 @@ static int32_t SendFrame (const uint8_t *frame, uint32_t len, uint32_t flags) {
     return ARM_DRIVER_ERROR;
   }
 
-  if (dst == NULL) {
-    /* Start of a new transmit frame */
-    if (tx_desc[Emac.tx_index].CtrlStat & DMA_TX_OWN) {
-      /* Transmitter is busy, wait */
-      return ARM_DRIVER_ERROR_BUSY;
+  tx_reclaim ();
+
+  if (flags & ETH_MAC_TX_FRAME_NOCOPY) {
+    /* Fragment read in place, chain a descriptor of its own */
+    if (dst != NULL) {
+      /* Close the descriptor holding the copied fragments */
+      tx_desc_close (0U);
+      Emac.frame_end = NULL;
+    }
+    if (tx_desc_free () == 0U) {
+      return tx_desc_wait ();
+    }
+    txd = &tx_desc[Emac.tx_index];
+    txd->Addr = (uint8_t *)frame;
+    txd->Size = len;
+    len = 0U;
+  }
+  else if (dst == NULL) {
+    /* Start of a new transmit descriptor */
+    if (tx_desc_free () == 0U) {
+      return tx_desc_wait ();
+    }
+    txd = &tx_desc[Emac.tx_index];
+    txd->Addr = (uint8_t *)&tx_buf[Emac.tx_index];
+    txd->Size = len;
+    dst = txd->Addr;
+    if (frame == dst) {
+      /* Filled in place (ETH_MAC_TX_BUFFER_GET), nothing to copy */
+      dst += len;
+      len  = 0U;
     }
-    dst = tx_desc[Emac.tx_index].Addr;
-    tx_desc[Emac.tx_index].Size = len;
   }
   else {
     /* Sending data fragments in progress */
-    tx_desc[Emac.tx_index].Size += len;
+    txd = &tx_desc[Emac.tx_index];
+    txd->Size += len;
   }
   /* Fast-copy data fragments to ETH-DMA buffer */
   for ( ; len > 7U; dst += 8, frame += 8, len -= 8U) {
@@ -611,26 +748,37 @@ static int32_t SendFrame (const uint8_t *frame, uint32_t len, uint32_t flags) {
   if (len > 0U) { dst++[0] = frame++[0]; }
 
   if (flags & ARM_ETH_MAC_TX_FRAME_FRAGMENT) {
-    /* More data to come, remember current write position */
-    Emac.frame_end = dst;
+    if (flags & ETH_MAC_TX_FRAME_NOCOPY) {
+      /* Next fragment goes to the next descriptor */
+      tx_desc_close (0U);
+    }
+    else {
+      /* More data to come, remember current write position */
+      Emac.frame_end = dst;
+    }
     return ARM_DRIVER_OK;
   }
 
+  /* Last segment of the frame */
+  ctrl = DMA_TX_LS;
+  if (flags & ARM_ETH_MAC_TX_FRAME_EVENT) { ctrl |= DMA_TX_IC; }
+#if (EMAC_TIME_STAMP != 0)
+  Emac.tx_ts_index = Emac.tx_index;
+#endif
+  tx_desc_close (ctrl);
+
   /* Frame is now ready, send it to DMA */
-  ctrl = tx_desc[Emac.tx_index].CtrlStat & ~DMA_TX_CIC;
+  ctrl = tx_desc[Emac.tx_first].CtrlStat;
 #if (EMAC_CHECKSUM_OFFLOAD != 0)
   if (Emac.tx_cks_offload) { ctrl |= DMA_TX_CIC; }
 #endif
-  ctrl &= ~(DMA_TX_IC | DMA_TX_TTSE);
-  if (flags & ARM_ETH_MAC_TX_FRAME_EVENT)     { ctrl |= DMA_TX_IC; }
 #if (EMAC_TIME_STAMP != 0)
   if (flags & ARM_ETH_MAC_TX_FRAME_TIMESTAMP) { ctrl |= DMA_TX_TTSE; }
-  Emac.tx_ts_index = Emac.tx_index;
 #endif
-  tx_desc[Emac.tx_index].CtrlStat = ctrl | DMA_TX_OWN;
+  tx_desc[Emac.tx_first].CtrlStat = ctrl | DMA_TX_OWN;
 
-  Emac.tx_index++;
-  if (Emac.tx_index == NUM_TX_BUF) { Emac.tx_index = 0U; }
+  Emac.tx_used += Emac.tx_asm;
+  Emac.tx_asm   = 0U;
   Emac.frame_end = NULL;
 
   /* Start frame transmission */
@@ -673,16 +821,12 @@ static int32_t ReadFrame (uint8_t *frame, uint32_t len) {
   if (len > 0U) { frame[0] = src[0]; }
 
   /* Return this block back to ETH-DMA */
-  rx_desc[Emac.rx_index].Stat = DMA_RX_OWN;
+  rx_frame_count (rx_desc[Emac.rx_index].Stat);
+  rx_desc_return (Emac.rx_index);
 
   Emac.rx_index++;
   if (Emac.rx_index == NUM_RX_BUF) { Emac.rx_index = 0; }
 
-  if (ETH->DMASR & ETH_DMASR_RBUS) {
-    /* Receive buffer unavailable, resume DMA */
-    ETH->DMASR   = ETH_DMASR_RBUS;
-    ETH->DMARPDR = 0;
-  }
   return (cnt);
 }
 
@@ -698,8 +842,8 @@ static uint32_t GetRxFrameSize (void) {
     return (0U);
   }
 
-  if (stat & DMA_RX_OWN) {
-    /* Owned by DMA */
+  if ((stat & DMA_RX_OWN) || (stat == 0U)) {
+    /* Owned by DMA or borrowed by the application */
     return (0U);
   }
   if (((stat & DMA_RX_ES) != 0) ||
@@ -846,9 +990,11 @@ static int32_t ControlTimer (uint32_t control, ARM_ETH_MAC_TIME *time) {
   \return      \ref execution_status
 */
 static int32_t Control (uint32_t control, uint32_t arg) {
+  ETH_MAC_FRAME_BUF *buf;
   uint32_t maccr;
   uint32_t dmaomr;
   uint32_t macffr;
+  uint32_t i;
 
   if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
     return ARM_DRIVER_ERROR;
@@ -964,6 +1110,8 @@ static int32_t Control (uint32_t control, uint32_t arg) {
       }
       if (arg & ARM_ETH_MAC_FLUSH_TX) {
         ETH->DMAOMR |= ETH_DMAOMR_FTF;
+        /* Drop the frame being assembled */
+        tx_frame_abort ();
       }
       break;
 
@@ -972,6 +1120,121 @@ static int32_t Control (uint32_t control, uint32_t arg) {
       ETH->MACVLANTR = arg;
       break;
 
+    case ETH_MAC_RX_FRAME_BORROW:
+      /* Hand out the DMA buffer of the received frame */
+      buf = (ETH_MAC_FRAME_BUF *)arg;
+      if (buf == NULL) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+      }
+      i = GetRxFrameSize ();
+      if (i == 0U) {
+        return ARM_DRIVER_ERROR_BUSY;
+      }
+      if (i == 0xFFFFFFFFU) {
+        /* Frame with errors, discard it with ReadFrame */
+        return ARM_DRIVER_ERROR;
+      }
+      if (Emac.rx_lent >= (NUM_RX_BUF - NUM_RX_RESERVE)) {
+        /* Keep the reserve with ETH-DMA, the frame is read with ReadFrame */
+        return ARM_DRIVER_ERROR_BUSY;
+      }
+      buf->data = (uint8_t *)rx_desc[Emac.rx_index].Addr;
+      buf->len  = i;
+      rx_frame_count (rx_desc[Emac.rx_index].Stat);
+      /* Cleared status marks the descriptor as borrowed */
+      rx_desc[Emac.rx_index].Stat = 0U;
+      Emac.rx_lent++;
+
+      Emac.rx_index++;
+      if (Emac.rx_index == NUM_RX_BUF) { Emac.rx_index = 0; }
+      break;
+
+    case ETH_MAC_RX_FRAME_RETURN:
+      /* Give the borrowed buffer back to ETH-DMA */
+      for (i = 0U; i < NUM_RX_BUF; i++) {
+        if (rx_desc[i].Addr == (uint8_t *)arg) {
+          break;
+        }
+      }
+      if ((i == NUM_RX_BUF) || (rx_desc[i].Stat != 0U)) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+      }
+      rx_desc_return (i);
+      Emac.rx_lent--;
+      break;
+
+    case ETH_MAC_TX_BUFFER_GET:
+      /* Hand out the DMA buffer of the next transmit descriptor */
+      buf = (ETH_MAC_FRAME_BUF *)arg;
+      if (buf == NULL) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+      }
+      if ((Emac.frame_end != NULL) || (Emac.tx_asm != 0U)) {
+        /* Frame assembly in progress */
+        return ARM_DRIVER_ERROR;
+      }
+      tx_reclaim ();
+      if (tx_desc_free () == 0U) {
+        return ARM_DRIVER_ERROR_BUSY;
+      }
+      buf->data = (uint8_t *)&tx_buf[Emac.tx_index];
+      buf->len  = ETH_BUF_SIZE;
+      break;
+
+    case ETH_MAC_TX_RECLAIM:
+      /* Report frames transmitted since the last call */
+      tx_reclaim ();
+      i = Emac.tx_done;
+      Emac.tx_done = 0U;
+      return ((int32_t)i);
+
+    case ETH_MAC_CONTROL_RX_POLL:
+      /* Enable/disable polled receive mode */
+      if (arg != 0U) {
+        Emac.flags |= EMAC_FLAG_RX_POLL;
+      }
+      else {
+        Emac.flags &= ~EMAC_FLAG_RX_POLL;
+        ETH->DMAIER |= ETH_DMAIER_RIE;
+      }
+      Emac.rx_batch = 0U;
+      break;
+
+    case ETH_MAC_RX_POLL_COMPLETE:
+      /* Ring drained, unmask receive interrupt */
+      ETH->DMASR = ETH_DMASR_RS;
+      i = rx_desc[Emac.rx_index].Stat;
+      if (((i & DMA_RX_OWN) == 0U) && (i != 0U)) {
+        /* Frame arrived in the meantime, keep polling */
+        return ARM_DRIVER_ERROR_BUSY;
+      }
+      if (Emac.rx_batch != 0U) {
+        Emac.rx_stats.batches++;
+        if (Emac.rx_batch > Emac.rx_stats.batch_max) {
+          Emac.rx_stats.batch_max = Emac.rx_batch;
+        }
+        Emac.rx_batch = 0U;
+      }
+      /* Frames completed from here on raise the interrupt again */
+      ETH->DMAIER |= ETH_DMAIER_RIE;
+      break;
+
+    case ETH_MAC_GET_RX_STATS:
+      /* Read receive statistics */
+      if (arg == 0U) {
+        return ARM_DRIVER_ERROR_PARAMETER;
+      }
+      /* Missed frame counters are cleared on read */
+      i = ETH->DMAMFBOCR;
+      Emac.rx_stats.missed += (i & ETH_DMAMFBOCR_MFC) +
+                              ((i & ETH_DMAMFBOCR_MFA) >> 17);
+      memcpy ((void *)arg, &Emac.rx_stats, sizeof (ETH_MAC_RX_STATS));
+      break;
+
+    case ETH_MAC_GET_TX_DESC_NUM:
+      /* Descriptors a frame may use */
+      return ((int32_t)NUM_TX_BUF);
+
     default:
       return ARM_DRIVER_ERROR_UNSUPPORTED;
   }
@@ -1052,7 +1315,14 @@ void ETH_IRQHandler (void) {
   dmasr = ETH->DMASR;
   ETH->DMASR = dmasr & (ETH_DMASR_NIS | ETH_DMASR_RS | ETH_DMASR_TS);
   if (dmasr & ETH_DMASR_TS)   { event |= ARM_ETH_MAC_EVENT_TX_FRAME; }
-  if (dmasr & ETH_DMASR_RS)   { event |= ARM_ETH_MAC_EVENT_RX_FRAME; }
+  if (dmasr & ETH_DMASR_RS)   {
+    event |= ARM_ETH_MAC_EVENT_RX_FRAME;
+    Emac.rx_stats.interrupts++;
+    if (Emac.flags & EMAC_FLAG_RX_POLL) {
+      /* Mask receive interrupt until the ring is drained */
+      ETH->DMAIER &= ~ETH_DMAIER_RIE;
+    }
+  }
   macsr = ETH->MACSR;
 #if (EMAC_TIME_STAMP != 0)
   if (macsr & ETH_MACSR_TSTS) { event |= ARM_ETH_MAC_EVENT_TIMER_ALARM; }
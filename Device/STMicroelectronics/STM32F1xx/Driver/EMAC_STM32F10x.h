@@ -30,6 +30,7 @@
 #include <string.h>
 
 #include "Driver_ETH_MAC.h"
+#include "Driver/Driver_ETH_MAC_Ext.h"
 #include "stm32f10x.h"
 
 #include "RTE_Components.h"
@@ -116,6 +117,7 @@
 /* EMAC Driver state flags */
 #define EMAC_FLAG_INIT      (1 << 0)    // Driver initialized
 #define EMAC_FLAG_POWER     (1 << 1)    // Driver power on
+#define EMAC_FLAG_RX_POLL   (1 << 2)    // Polled receive mode
 
 /* PTP subsecond increment value */
 #define PTPSSIR_Val(hclk)     ((0x7FFFFFFFU + (hclk)/2U) / (hclk))
@@ -217,7 +219,13 @@ typedef struct {
   ARM_ETH_MAC_SignalEvent_t cb_event;   // Event callback
   uint8_t       flags;                  // Control and state flags
   uint8_t       tx_index;               // Transmit descriptor index
+  uint8_t       tx_clean;               // Oldest transmit descriptor owned by DMA
+  uint8_t       tx_used;                // Transmit descriptors of submitted frames
+  uint8_t       tx_asm;                 // Transmit descriptors of the frame being assembled
+  uint8_t       tx_first;               // First descriptor of the frame being assembled
   uint8_t       rx_index;               // Receive descriptor index
+  uint8_t       rx_lent;                // Receive descriptors borrowed by the application
+  uint32_t      tx_done;                // Transmitted frames not yet reclaimed
 #if (EMAC_CHECKSUM_OFFLOAD)
   bool          tx_cks_offload;         // Checksum offload enabled/disabled
 #endif
@@ -225,6 +233,8 @@ typedef struct {
   uint8_t       tx_ts_index;            // Transmit Timestamp descriptor index
 #endif
   uint8_t      *frame_end;              // End of assembled frame fragments
+  uint32_t      rx_batch;               // Frames read in the current poll batch
+  ETH_MAC_RX_STATS rx_stats;            // Receive statistics
 } EMAC_CTRL;
 
 #endif /* __EMAC_STM32F10X_H */
@@ -1010,6 +1010,13 @@ int32_t USART_Receive(void *data, uint32_t num, const USART_RESOURCES *usart)
     return (ARM_DRIVER_ERROR_BUSY);
   }
 
+  if ((info->flags & USART_FLAG_RX_CONTINUOUS) != 0U) {
+    if ((info->mode == ARM_USART_MODE_SYNCHRONOUS_MASTER) || (num > 0xFFFFU)) {
+      /* No continuous receive in synchronous mode, ring is limited by the DMA counter */
+      return (ARM_DRIVER_ERROR);
+    }
+  }
+
   /* Disable RXNE Interrupt */
   reg->CR1 &= ~USART_CR1_RXNEIE;
 
@@ -1053,6 +1060,16 @@ int32_t USART_Receive(void *data, uint32_t num, const USART_RESOURCES *usart)
       cfg |= DMA_PERIPHERAL_DATA_16BIT | DMA_MEMORY_DATA_16BIT;
     }
 
+    if ((info->flags & USART_FLAG_RX_CONTINUOUS) != 0U) {
+      /* Receive into the ring until aborted */
+      cfg |= DMA_CIRCULAR_MODE | DMA_HALF_TRANSFER_INTERRUPT;
+
+      xfer->rx_rd     = 0U;
+      xfer->rx_wr     = 0U;
+      xfer->rx_rd_cnt = 0U;
+      xfer->rx_wr_cnt = 0U;
+    }
+
     DMA_ChannelConfigure(usart->dma_rx->instance, cfg, (uint32_t)(&reg->DR), (uint32_t)data, num);
     DMA_ChannelEnable(usart->dma_rx->instance);
 
@@ -1133,6 +1150,152 @@ int32_t USART_Transfer(const void *data_out, void *data_in, uint32_t num, const
   return (ARM_DRIVER_OK);
 }
 
+#ifdef __USART_DMA_RX
+/**
+ * @fn          uint32_t USART_RxRingWrite(const USART_RESOURCES *usart)
+ * @brief       Get the current write index of the continuous receive ring.
+ * @param[in]   usart     Pointer to USART resources
+ * @return      write index
+ */
+static
+uint32_t USART_RxRingWrite(const USART_RESOURCES *usart)
+{
+  uint32_t wr = usart->xfer->rx_num - DMA_ChannelTransferItemCount(usart->dma_rx->instance);
+
+  /* Counter is reloaded at the end of the ring */
+  if (wr == usart->xfer->rx_num) {
+    wr = 0U;
+  }
+
+  return (wr);
+}
+
+/**
+ * @fn          uint32_t USART_RxRingDelta(const USART_RESOURCES *usart)
+ * @brief       Get number of data written to the ring since the last event.
+ * @param[in]   usart     Pointer to USART resources
+ * @return      number of data items
+ */
+static
+uint32_t USART_RxRingDelta(const USART_RESOURCES *usart)
+{
+  USART_TRANSFER_INFO *xfer = usart->xfer;
+
+  return ((USART_RxRingWrite(usart) + xfer->rx_num - xfer->rx_wr) % xfer->rx_num);
+}
+
+/**
+ * @fn          uint32_t USART_RxRingUpdate(const USART_RESOURCES *usart)
+ * @brief       Account data written to the ring, called on the ring events.
+ * @param[in]   usart     Pointer to USART resources
+ * @return      ARM_USART_EVENT_RX_OVERFLOW when unread data was overwritten, 0 otherwise
+ */
+static
+uint32_t USART_RxRingUpdate(const USART_RESOURCES *usart)
+{
+  USART_TRANSFER_INFO *xfer = usart->xfer;
+
+  /* Half and full ring events keep the delta below the ring size */
+  xfer->rx_wr_cnt += USART_RxRingDelta(usart);
+  xfer->rx_wr      = USART_RxRingWrite(usart);
+
+  if ((xfer->rx_wr_cnt - xfer->rx_rd_cnt) >= xfer->rx_num) {
+    usart->info->status.rx_overflow = 1U;
+    return (ARM_USART_EVENT_RX_OVERFLOW);
+  }
+
+  return (0U);
+}
+
+/**
+ * @fn          uint32_t USART_RxRingAvailable(const USART_RESOURCES *usart)
+ * @brief       Get number of unread data in the ring.
+ * @note        Called with interrupts disabled, the ring events update the
+ *              write position from the USART and DMA interrupt handlers.
+ * @param[in]   usart     Pointer to USART resources
+ * @return      number of data items
+ */
+static
+uint32_t USART_RxRingAvailable(const USART_RESOURCES *usart)
+{
+  USART_TRANSFER_INFO *xfer = usart->xfer;
+
+  if ((xfer->rx_wr_cnt - xfer->rx_rd_cnt) >= xfer->rx_num) {
+    /* Unread data was overwritten, continue with the new data */
+    xfer->rx_rd     = xfer->rx_wr;
+    xfer->rx_rd_cnt = xfer->rx_wr_cnt;
+  }
+
+  return ((USART_RxRingWrite(usart) + xfer->rx_num - xfer->rx_rd) % xfer->rx_num);
+}
+
+/**
+ * @fn          void USART_RxRingSpans(USART_RX_SPANS *spans, const USART_RESOURCES *usart)
+ * @brief       Get unread data of the ring as up to two contiguous spans.
+ * @param[out]  spans     Pointer to spans
+ * @param[in]   usart     Pointer to USART resources
+ */
+static
+void USART_RxRingSpans(USART_RX_SPANS *spans, const USART_RESOURCES *usart)
+{
+  USART_TRANSFER_INFO *xfer    = usart->xfer;
+  uint32_t             cr1     = usart->reg->CR1;
+  uint32_t             size    = 1U;
+  uint32_t             primask = __get_PRIMASK();
+  uint32_t             num;
+
+  if (((cr1 & USART_CR1_M) != 0U) && ((cr1 & USART_CR1_PCE) == 0U)) {
+    /* 9-bit data frame, no parity */
+    size = 2U;
+  }
+
+  __disable_irq();
+  num = USART_RxRingAvailable(usart);
+
+  spans->data[0] = &xfer->rx_buf[xfer->rx_rd * size];
+
+  if ((xfer->rx_rd + num) > xfer->rx_num) {
+    /* Unread data wraps around the end of the ring */
+    spans->num[0]  = xfer->rx_num - xfer->rx_rd;
+    spans->data[1] = xfer->rx_buf;
+    spans->num[1]  = num - spans->num[0];
+  }
+  else {
+    spans->num[0]  = num;
+    spans->data[1] = NULL;
+    spans->num[1]  = 0U;
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+ * @fn          int32_t USART_RxRingRelease(uint32_t num, const USART_RESOURCES *usart)
+ * @brief       Release data read from the ring.
+ * @param[in]   num       Number of data items
+ * @param[in]   usart     Pointer to USART resources
+ * @return      \ref execution_status
+ */
+static
+int32_t USART_RxRingRelease(uint32_t num, const USART_RESOURCES *usart)
+{
+  USART_TRANSFER_INFO *xfer    = usart->xfer;
+  uint32_t             primask = __get_PRIMASK();
+  int32_t              status  = ARM_DRIVER_OK;
+
+  __disable_irq();
+  if (num > USART_RxRingAvailable(usart)) {
+    status = ARM_DRIVER_ERROR_PARAMETER;
+  }
+  else {
+    xfer->rx_rd      = (xfer->rx_rd + num) % xfer->rx_num;
+    xfer->rx_rd_cnt += num;
+  }
+  __set_PRIMASK(primask);
+
+  return (status);
+}
+#endif
+
 /**
  * @fn          uint32_t USART_GetTxCount(const USART_RESOURCES *usart)
  * @brief       Get transmitted data count.
@@ -1164,6 +1327,16 @@ uint32_t USART_GetRxCount(const USART_RESOURCES *usart)
 {
 #ifdef __USART_DMA_RX
   if (usart->dma_rx) {
+    if (((usart->info->flags & USART_FLAG_RX_CONTINUOUS) != 0U) && (usart->info->status.rx_busy != 0U)) {
+      uint32_t primask = __get_PRIMASK();
+      uint32_t cnt;
+
+      __disable_irq();
+      cnt = usart->xfer->rx_wr_cnt + USART_RxRingDelta(usart);
+      __set_PRIMASK(primask);
+
+      return (cnt);
+    }
     return (usart->xfer->rx_num - DMA_ChannelTransferItemCount(usart->dma_rx->instance));
   }
   else
@@ -1361,6 +1534,52 @@ int32_t USART_Control(uint32_t control, uint32_t arg, const USART_RESOURCES *usa
       }
       return (ARM_DRIVER_OK);
 
+    /* Receiver timeout */
+    case USART_CONTROL_RX_TIMEOUT:
+      /* Not available on this device, the IDLE line is signaled instead */
+      return (ARM_DRIVER_ERROR_UNSUPPORTED);
+
+#ifdef __USART_DMA_RX
+    /* Continuous receive */
+    case USART_CONTROL_RX_CONTINUOUS:
+      if (usart->dma_rx == NULL) {
+        return (ARM_DRIVER_ERROR_UNSUPPORTED);
+      }
+
+      if (info->status.rx_busy != 0U) {
+        return (ARM_DRIVER_ERROR_BUSY);
+      }
+
+      if (arg != 0U) {
+        info->flags |= USART_FLAG_RX_CONTINUOUS;
+      }
+      else {
+        info->flags &= ~USART_FLAG_RX_CONTINUOUS;
+      }
+      return (ARM_DRIVER_OK);
+
+    /* Get unread data of the ring */
+    case USART_GET_RX_SPANS:
+      if (arg == 0U) {
+        return (ARM_DRIVER_ERROR_PARAMETER);
+      }
+
+      if (((info->flags & USART_FLAG_RX_CONTINUOUS) == 0U) || (info->status.rx_busy == 0U)) {
+        return (ARM_DRIVER_ERROR);
+      }
+
+      USART_RxRingSpans((USART_RX_SPANS *)arg, usart);
+      return (ARM_DRIVER_OK);
+
+    /* Release data read from the ring */
+    case USART_RELEASE_RX_DATA:
+      if (((info->flags & USART_FLAG_RX_CONTINUOUS) == 0U) || (info->status.rx_busy == 0U)) {
+        return (ARM_DRIVER_ERROR);
+      }
+
+      return (USART_RxRingRelease(arg, usart));
+#endif
+
     default:
       break;
   }
@@ -1941,6 +2160,13 @@ void USART_IRQHandler(const USART_RESOURCES *usart)
     /* Dummy read to clear IDLE interrupt */
     reg->DR;
     event |= ARM_USART_EVENT_RX_TIMEOUT;
+
+#ifdef __USART_DMA_RX
+    /* Continuous receive: account data received before the line went idle */
+    if (((info->flags & USART_FLAG_RX_CONTINUOUS) != 0U) && (info->status.rx_busy != 0U)) {
+      event |= USART_RxRingUpdate(usart);
+    }
+#endif
   }
 
   /* Transmit data register empty */
@@ -2076,12 +2302,24 @@ void USART_TX_DMA_Complete(const USART_RESOURCES *usart)
 #endif
 
 #ifdef __USART_DMA_RX
-void USART_RX_DMA_Complete(const USART_RESOURCES *usart)
+void USART_RX_DMA_Complete(uint32_t events, const USART_RESOURCES *usart)
 {
   USART_INFO *info = usart->info;
   USART_TRANSFER_INFO *xfer = usart->xfer;
   uint32_t val, event;
 
+  if ((info->flags & USART_FLAG_RX_CONTINUOUS) != 0U) {
+    /* Continuous receive: half and full ring */
+    if ((events & (DMA_CHANNEL_HALF_TRANSFER | DMA_CHANNEL_TRANSFER_COMPLETE)) != 0U) {
+      event = USART_RxRingUpdate(usart) | USART_EVENT_RX_DATA;
+
+      if (info->cb_event) {
+        info->cb_event(event);
+      }
+    }
+    return;
+  }
+
   if ((DMA_ChannelTransferItemCount(usart->dma_rx->instance) != 0U) && (xfer->rx_num != 0U)) {
     /* RX DMA Complete caused by receive/transfer abort */
     return;
@@ -2146,7 +2384,7 @@ static ARM_USART_MODEM_STATUS  USART1_GetModemStatus  (void)
        void                    USART1_TX_DMA_Handler  (uint32_t events)                                     {        USART_TX_DMA_Complete(&USART1_Resources); }
 #endif
 #ifdef USART1_RX_DMA_Instance
-       void                    USART1_RX_DMA_Handler  (uint32_t events)                                     {        USART_RX_DMA_Complete(&USART1_Resources); }
+       void                    USART1_RX_DMA_Handler  (uint32_t events)                                     {        USART_RX_DMA_Complete(events, &USART1_Resources); }
 #endif
 
 /* USART1 Driver Control Block */
@@ -2189,7 +2427,7 @@ static ARM_USART_MODEM_STATUS  USART2_GetModemStatus  (void)
        void                    USART2_TX_DMA_Handler  (uint32_t events)                                     {        USART_TX_DMA_Complete(&USART2_Resources); }
 #endif
 #ifdef USART2_RX_DMA_Instance
-       void                    USART2_RX_DMA_Handler  (uint32_t events)                                     {        USART_RX_DMA_Complete(&USART2_Resources); }
+       void                    USART2_RX_DMA_Handler  (uint32_t events)                                     {        USART_RX_DMA_Complete(events, &USART2_Resources); }
 #endif
 
 /* USART2 Driver Control Block */
@@ -2232,7 +2470,7 @@ static ARM_USART_MODEM_STATUS  USART3_GetModemStatus  (void)
        void                    USART3_TX_DMA_Handler  (uint32_t events)                                     {        USART_TX_DMA_Complete(&USART3_Resources); }
 #endif
 #ifdef USART3_RX_DMA_Instance
-       void                    USART3_RX_DMA_Handler  (uint32_t events)                                     {        USART_RX_DMA_Complete(&USART3_Resources); }
+       void                    USART3_RX_DMA_Handler  (uint32_t events)                                     {        USART_RX_DMA_Complete(events, &USART3_Resources); }
 #endif
 
 /* USART3 Driver Control Block */
@@ -2275,7 +2513,7 @@ static ARM_USART_MODEM_STATUS  USART4_GetModemStatus  (void)
        void                    UART4_TX_DMA_Handler   (uint32_t events)                                     {        USART_TX_DMA_Complete(&USART4_Resources); }
 #endif
 #ifdef UART4_RX_DMA_Instance
-       void                    UART4_RX_DMA_Handler   (uint32_t events)                                     {        USART_RX_DMA_Complete(&USART4_Resources); }
+       void                    UART4_RX_DMA_Handler   (uint32_t events)                                     {        USART_RX_DMA_Complete(events, &USART4_Resources); }
 #endif
 
 /* USART4 Driver Control Block */
@@ -2318,7 +2556,7 @@ static ARM_USART_MODEM_STATUS  USART5_GetModemStatus  (void)
        void                    UART5_TX_DMA_Handler   (uint32_t events)                                     {        USART_TX_DMA_Complete(&USART5_Resources); }
 #endif
 #ifdef UART5_RX_DMA_Instance
-       void                    UART5_RX_DMA_Handler   (uint32_t events)                                     {        USART_RX_DMA_Complete(&USART5_Resources); }
+       void                    UART5_RX_DMA_Handler   (uint32_t events)                                     {        USART_RX_DMA_Complete(events, &USART5_Resources); }
 #endif
 
 /* USART5 Driver Control Block */
@@ -34,7 +34,7 @@
 #include "asm/RCC_STM32F1xx.h"
 #include "asm/stm32f1xx.h"
 
-#include "Driver/Driver_USART.h"
+#include "Driver/Driver_USART_Ext.h"
 
 
 /*******************************************************************************
@@ -380,6 +380,7 @@
 #define USART_FLAG_CONFIGURED       ((uint8_t)(1U << 2U))
 #define USART_FLAG_TX_ENABLED       ((uint8_t)(1U << 3U))
 #define USART_FLAG_RX_ENABLED       ((uint8_t)(1U << 4U))
+#define USART_FLAG_RX_CONTINUOUS    ((uint8_t)(1U << 5U))
 
 /* USART synchronous transfer modes */
 #define USART_SYNC_MODE_TX           (1UL)
@@ -423,6 +424,10 @@ typedef struct _USART_TRANSFER_INFO {
   uint32_t              sync_mode;      // Synchronous mode flag
   uint8_t               break_flag;     // Transmit break flag
   uint8_t               send_active;    // Send active flag
+  uint32_t              rx_rd;          // Continuous receive: read index
+  uint32_t              rx_wr;          // Continuous receive: write index at last event
+  uint32_t              rx_rd_cnt;      // Continuous receive: number of data released
+  uint32_t              rx_wr_cnt;      // Continuous receive: number of data written
 } USART_TRANSFER_INFO;
 
 typedef struct _USART_STATUS {
@@ -267,6 +267,27 @@ void EXTI_SoftwareRequest(EXTI_Line_t line)
   EXTI->SWIER |= (1UL << (uint32_t)line);
 }
 
+/**
+ * @fn          void EXTI_InterruptMask(EXTI_Line_t line)
+ * @brief       Mask the interrupt request of a single line, other lines of a
+ *              shared vector stay enabled.
+ * @param[in]   line
+ */
+void EXTI_InterruptMask(EXTI_Line_t line)
+{
+  EXTI->IMR &= ~(1UL << (uint32_t)line);
+}
+
+/**
+ * @fn          void EXTI_InterruptUnmask(EXTI_Line_t line)
+ * @brief       Unmask the interrupt request of a single line.
+ * @param[in]   line
+ */
+void EXTI_InterruptUnmask(EXTI_Line_t line)
+{
+  EXTI->IMR |= (1UL << (uint32_t)line);
+}
+
 /*******************************************************************************
  *  Interrupt Handlers
  ******************************************************************************/
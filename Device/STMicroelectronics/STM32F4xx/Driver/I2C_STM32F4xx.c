@@ -66,11 +66,49 @@ static const GPIO_PIN_CFG_t I2C_pin_cfg_open_drain = {
 /* I2C1 Information (Run-Time) */
 static I2C_INFO I2C1_Info;
 
+#ifdef I2C1_RX_DMA_Stream
+static void I2C1_RX_DMA_Complete(uint32_t event);
+
+static DMA_Handle_t I2C1_RX_DMA_Handle;
+static DMA_Resources_t I2C1_RX_DMA = {
+  &I2C1_RX_DMA_Handle,
+  I2C1_RX_DMA_Stream,
+  I2C1_RX_DMA_Channel,
+  I2C1_RX_DMA_Priority,
+  I2C1_RX_DMA_Complete,
+  RTE_I2C_DMA_INT_PRIORITY,
+  I2C1_RX_DMA_IRQn,
+};
+#endif
+
+#ifdef I2C1_TX_DMA_Stream
+static void I2C1_TX_DMA_Complete(uint32_t event);
+
+static DMA_Handle_t I2C1_TX_DMA_Handle;
+static DMA_Resources_t I2C1_TX_DMA = {
+  &I2C1_TX_DMA_Handle,
+  I2C1_TX_DMA_Stream,
+  I2C1_TX_DMA_Channel,
+  I2C1_TX_DMA_Priority,
+  I2C1_TX_DMA_Complete,
+  RTE_I2C_DMA_INT_PRIORITY,
+  I2C1_TX_DMA_IRQn,
+};
+#endif
+
 /* I2C1 Resources */
 static I2C_RESOURCES I2C1_Resources = {
   I2C1,
+#ifdef I2C1_RX_DMA_Stream
+  &I2C1_RX_DMA,
+#else
   NULL,
+#endif
+#ifdef I2C1_TX_DMA_Stream
+  &I2C1_TX_DMA,
+#else
   NULL,
+#endif
   {
       I2C1_SCL_GPIO_PORT,
       I2C1_SCL_GPIO_PIN,
@@ -92,11 +130,49 @@ static I2C_RESOURCES I2C1_Resources = {
 /* I2C2 Information (Run-Time) */
 static I2C_INFO I2C2_Info;
 
+#ifdef I2C2_RX_DMA_Stream
+static void I2C2_RX_DMA_Complete(uint32_t event);
+
+static DMA_Handle_t I2C2_RX_DMA_Handle;
+static DMA_Resources_t I2C2_RX_DMA = {
+  &I2C2_RX_DMA_Handle,
+  I2C2_RX_DMA_Stream,
+  I2C2_RX_DMA_Channel,
+  I2C2_RX_DMA_Priority,
+  I2C2_RX_DMA_Complete,
+  RTE_I2C_DMA_INT_PRIORITY,
+  I2C2_RX_DMA_IRQn,
+};
+#endif
+
+#ifdef I2C2_TX_DMA_Stream
+static void I2C2_TX_DMA_Complete(uint32_t event);
+
+static DMA_Handle_t I2C2_TX_DMA_Handle;
+static DMA_Resources_t I2C2_TX_DMA = {
+  &I2C2_TX_DMA_Handle,
+  I2C2_TX_DMA_Stream,
+  I2C2_TX_DMA_Channel,
+  I2C2_TX_DMA_Priority,
+  I2C2_TX_DMA_Complete,
+  RTE_I2C_DMA_INT_PRIORITY,
+  I2C2_TX_DMA_IRQn,
+};
+#endif
+
 /* I2C2 Resources */
 static I2C_RESOURCES I2C2_Resources = {
   I2C2,
+#ifdef I2C2_RX_DMA_Stream
+  &I2C2_RX_DMA,
+#else
   NULL,
+#endif
+#ifdef I2C2_TX_DMA_Stream
+  &I2C2_TX_DMA,
+#else
   NULL,
+#endif
   {
       I2C2_SCL_GPIO_PORT,
       I2C2_SCL_GPIO_PIN,
@@ -117,11 +193,49 @@ static I2C_RESOURCES I2C2_Resources = {
 /* I2C3 Information (Run-Time) */
 static I2C_INFO I2C3_Info;
 
+#ifdef I2C3_RX_DMA_Stream
+static void I2C3_RX_DMA_Complete(uint32_t event);
+
+static DMA_Handle_t I2C3_RX_DMA_Handle;
+static DMA_Resources_t I2C3_RX_DMA = {
+  &I2C3_RX_DMA_Handle,
+  I2C3_RX_DMA_Stream,
+  I2C3_RX_DMA_Channel,
+  I2C3_RX_DMA_Priority,
+  I2C3_RX_DMA_Complete,
+  RTE_I2C_DMA_INT_PRIORITY,
+  I2C3_RX_DMA_IRQn,
+};
+#endif
+
+#ifdef I2C3_TX_DMA_Stream
+static void I2C3_TX_DMA_Complete(uint32_t event);
+
+static DMA_Handle_t I2C3_TX_DMA_Handle;
+static DMA_Resources_t I2C3_TX_DMA = {
+  &I2C3_TX_DMA_Handle,
+  I2C3_TX_DMA_Stream,
+  I2C3_TX_DMA_Channel,
+  I2C3_TX_DMA_Priority,
+  I2C3_TX_DMA_Complete,
+  RTE_I2C_DMA_INT_PRIORITY,
+  I2C3_TX_DMA_IRQn,
+};
+#endif
+
 /* I2C3 Resources */
 static I2C_RESOURCES I2C3_Resources = {
   I2C3,
+#ifdef I2C3_RX_DMA_Stream
+  &I2C3_RX_DMA,
+#else
   NULL,
+#endif
+#ifdef I2C3_TX_DMA_Stream
+  &I2C3_TX_DMA,
+#else
   NULL,
+#endif
   {
       I2C3_SCL_GPIO_PORT,
       I2C3_SCL_GPIO_PIN,
@@ -174,6 +288,70 @@ void SoftwareReset(I2C_TypeDef *reg)
   reg->TRISE = _TRISE;
 }
 
+/**
+ * @fn          bool I2C_DMA_Armed(const I2C_INFO volatile *info)
+ * @brief       Check if a DMA stream is armed for the current transfer direction.
+ * @param[in]   info  Pointer to I2C run-time information
+ * @return      true when the data is moved by DMA
+ */
+static
+bool I2C_DMA_Armed(const I2C_INFO volatile *info)
+{
+  if (info->status.direction != 0U) {
+    return ((info->xfer.ctrl & XFER_CTRL_DMA_RX) != 0U);
+  }
+
+  return ((info->xfer.ctrl & XFER_CTRL_DMA_TX) != 0U);
+}
+
+#ifdef I2C_DMA
+/**
+ * @fn          void I2C_DMA_Start(DMA_Resources_t *dma, I2C_RESOURCES *i2c)
+ * @brief       Arm the DMA stream for the current transfer. Requests are
+ *              enabled with DMAEN after the addressing phase.
+ * @param[in]   dma   Pointer to DMA resources
+ * @param[in]   i2c   Pointer to I2C resources
+ */
+static
+void I2C_DMA_Start(DMA_Resources_t *dma, I2C_RESOURCES *i2c)
+{
+  I2C_TRANSFER_INFO *tr = &i2c->info->xfer;
+
+  DMA_StreamConfig(dma);
+  DMA_StreamEnable(dma, (uint32_t)&i2c->reg->DR, (uint32_t)tr->data, tr->num);
+
+  tr->ctrl |= (dma == i2c->dma_rx) ? XFER_CTRL_DMA_RX : XFER_CTRL_DMA_TX;
+}
+
+/**
+ * @fn          void I2C_DMA_Stop(I2C_RESOURCES *i2c)
+ * @brief       Stop the armed DMA stream and update the transfer counter.
+ * @param[in]   i2c   Pointer to I2C resources
+ */
+static
+void I2C_DMA_Stop(I2C_RESOURCES *i2c)
+{
+  I2C_TRANSFER_INFO *tr = &i2c->info->xfer;
+  DMA_Resources_t *dma;
+
+  if (tr->ctrl & XFER_CTRL_DMA_RX) {
+    dma = i2c->dma_rx;
+  }
+  else if (tr->ctrl & XFER_CTRL_DMA_TX) {
+    dma = i2c->dma_tx;
+  }
+  else {
+    return;
+  }
+
+  i2c->reg->CR2 &= ~(I2C_CR2_DMAEN | I2C_CR2_LAST);
+  DMA_StreamDisable(dma);
+
+  tr->cnt   = tr->num - dma->stream->NDTR;
+  tr->ctrl &= ~(XFER_CTRL_DMA_RX | XFER_CTRL_DMA_TX);
+}
+#endif
+
 /**
  * @fn      ARM_DRIVER_VERSION I2C_GetVersion(void)
  * @brief   Get driver version.
@@ -277,6 +455,18 @@ int32_t I2C_PowerControl(ARM_POWER_STATE state, I2C_RESOURCES *i2c)
       NVIC_DisableIRQ(i2c->ev_irq_num);
       NVIC_DisableIRQ(i2c->er_irq_num);
 
+#ifdef I2C_DMA
+      /* Uninitialize DMA */
+      if ((info->flags & I2C_FLAG_POWER) != 0U) {
+        if (i2c->dma_rx != NULL) {
+          DMA_Uninitialize(i2c->dma_rx);
+        }
+        if (i2c->dma_tx != NULL) {
+          DMA_Uninitialize(i2c->dma_tx);
+        }
+      }
+#endif
+
       /* Disable peripheral clock */
       RCC_DisablePeriph(i2c->rcc);
 
@@ -310,6 +500,41 @@ int32_t I2C_PowerControl(ARM_POWER_STATE state, I2C_RESOURCES *i2c)
       NVIC_EnableIRQ(i2c->ev_irq_num);
       NVIC_EnableIRQ(i2c->er_irq_num);
 
+#ifdef I2C_DMA
+      /* Initialize DMA */
+      if (i2c->dma_rx != NULL) {
+        DMA_StreamConfig_t *cfg = &i2c->dma_rx->handle->config;
+
+        cfg->Direction    = DMA_DIR_PER_TO_MEM;
+        cfg->PerInc       = DMA_PINC_DISABLE;
+        cfg->MemInc       = DMA_MINC_ENABLE;
+        cfg->PerDataAlign = DMA_PDATAALIGN_BYTE;
+        cfg->MemDataAlign = DMA_MDATAALIGN_BYTE;
+        cfg->Mode         = DMA_MODE_NORMAL;
+        cfg->FIFOMode     = DMA_FIFOMODE_DISABLE;
+        cfg->MemBurst     = DMA_MBURST_SINGLE;
+        cfg->PerBurst     = DMA_PBURST_SINGLE;
+
+        DMA_Initialize(i2c->dma_rx);
+      }
+
+      if (i2c->dma_tx != NULL) {
+        DMA_StreamConfig_t *cfg = &i2c->dma_tx->handle->config;
+
+        cfg->Direction    = DMA_DIR_MEM_TO_PER;
+        cfg->PerInc       = DMA_PINC_DISABLE;
+        cfg->MemInc       = DMA_MINC_ENABLE;
+        cfg->PerDataAlign = DMA_PDATAALIGN_BYTE;
+        cfg->MemDataAlign = DMA_MDATAALIGN_BYTE;
+        cfg->Mode         = DMA_MODE_NORMAL;
+        cfg->FIFOMode     = DMA_FIFOMODE_DISABLE;
+        cfg->MemBurst     = DMA_MBURST_SINGLE;
+        cfg->PerBurst     = DMA_PBURST_SINGLE;
+
+        DMA_Initialize(i2c->dma_tx);
+      }
+#endif
+
       /* Reset the peripheral */
       RCC_ResetPeriph(i2c->rcc);
 
@@ -475,6 +700,10 @@ int32_t I2C_Control(uint32_t control, uint32_t arg, I2C_RESOURCES *i2c)
     case ARM_I2C_ABORT_TRANSFER:
       /* Disable I2C interrupts */
       reg->CR2 &= ~I2C_CR2_ITEVTEN;
+#ifdef I2C_DMA
+      /* Stop DMA transfer */
+      I2C_DMA_Stop(i2c);
+#endif
       /* Generate stop */
       /* Master generates stop after the current byte transfer */
       /* Slave releases SCL and SDA after the current byte transfer */
@@ -545,6 +774,11 @@ int32_t I2C_MasterTransmit(uint32_t addr, const uint8_t *data, uint32_t num,
     return (ARM_DRIVER_ERROR_BUSY);
   }
 
+#ifdef I2C_DMA
+  /* Release a stream armed for a previous slave transfer */
+  I2C_DMA_Stop(i2c);
+#endif
+
   info->status.busy             = 1U;
   info->status.mode             = 1U;
   info->status.direction        = 0U;
@@ -561,6 +795,12 @@ int32_t I2C_MasterTransmit(uint32_t addr, const uint8_t *data, uint32_t num,
     info->xfer.ctrl |= XFER_CTRL_XPENDING;
   }
 
+#ifdef I2C_DMA
+  if (i2c->dma_tx != NULL) {
+    I2C_DMA_Start(i2c->dma_tx, i2c);
+  }
+#endif
+
   /* Generate start and enable event interrupts */
   reg->CR2 &= ~I2C_CR2_ITEVTEN;
   reg->CR1 |=  I2C_CR1_START;
@@ -607,6 +847,11 @@ int32_t I2C_MasterReceive(uint32_t addr, uint8_t *data, uint32_t num,
     return (ARM_DRIVER_ERROR_BUSY);
   }
 
+#ifdef I2C_DMA
+  /* Release a stream armed for a previous slave transfer */
+  I2C_DMA_Stop(i2c);
+#endif
+
   info->status.busy             = 1U;
   info->status.mode             = 1U;
   info->status.direction        = 1U;
@@ -626,6 +871,14 @@ int32_t I2C_MasterReceive(uint32_t addr, uint8_t *data, uint32_t num,
   /* Enable acknowledge generation */
   reg->CR1 |= I2C_CR1_ACK;
 
+#ifdef I2C_DMA
+  if ((i2c->dma_rx != NULL) && (num > 1U)) {
+    /* NACK the byte following the last DMA transfer */
+    reg->CR2 |= I2C_CR2_LAST;
+    I2C_DMA_Start(i2c->dma_rx, i2c);
+  }
+#endif
+
   /* Generate start and enable event interrupts */
   reg->CR2 &= ~I2C_CR2_ITEVTEN;
   reg->CR1 |=  I2C_CR1_START;
@@ -658,6 +911,11 @@ int32_t I2C_SlaveTransmit(const uint8_t *data, uint32_t num, I2C_RESOURCES *i2c)
     return (ARM_DRIVER_ERROR_BUSY);
   }
 
+#ifdef I2C_DMA
+  /* Release a stream armed for a previous slave transfer */
+  I2C_DMA_Stop(i2c);
+#endif
+
   info->status.bus_error    = 0U;
   info->status.general_call = 0U;
 
@@ -666,6 +924,12 @@ int32_t I2C_SlaveTransmit(const uint8_t *data, uint32_t num, I2C_RESOURCES *i2c)
   info->xfer.data = (uint8_t *)data;
   info->xfer.ctrl = 0U;
 
+#ifdef I2C_DMA
+  if (i2c->dma_tx != NULL) {
+    I2C_DMA_Start(i2c->dma_tx, i2c);
+  }
+#endif
+
   /* Enable acknowledge */
   reg->CR1 |= I2C_CR1_ACK;
 
@@ -699,6 +963,11 @@ int32_t I2C_SlaveReceive(uint8_t *data, uint32_t num, I2C_RESOURCES *i2c)
     return (ARM_DRIVER_ERROR_BUSY);
   }
 
+#ifdef I2C_DMA
+  /* Release a stream armed for a previous slave transfer */
+  I2C_DMA_Stop(i2c);
+#endif
+
   info->status.bus_error    = 0U;
   info->status.general_call = 0U;
 
@@ -707,6 +976,12 @@ int32_t I2C_SlaveReceive(uint8_t *data, uint32_t num, I2C_RESOURCES *i2c)
   info->xfer.data = data;
   info->xfer.ctrl = 0U;
 
+#ifdef I2C_DMA
+  if (i2c->dma_rx != NULL) {
+    I2C_DMA_Start(i2c->dma_rx, i2c);
+  }
+#endif
+
   /* Enable acknowledge generation */
   reg->CR2 |= I2C_CR2_LAST;
   /* Enable acknowledge */
@@ -733,6 +1008,14 @@ int32_t I2C_GetDataCount(I2C_RESOURCES *i2c)
     /* Slave is not addressed */
     val = -1;
   }
+#ifdef I2C_DMA
+  else if (info->xfer.ctrl & XFER_CTRL_DMA_RX) {
+    val = (int32_t)(info->xfer.num - i2c->dma_rx->stream->NDTR);
+  }
+  else if (info->xfer.ctrl & XFER_CTRL_DMA_TX) {
+    val = (int32_t)(info->xfer.num - i2c->dma_tx->stream->NDTR);
+  }
+#endif
   else {
     val = (int32_t)info->xfer.cnt;
   }
@@ -834,6 +1117,9 @@ void I2C_EV_IRQHandler(I2C_RESOURCES *i2c)
             reg->CR1 |= I2C_CR1_STOP;
           }
         }
+        else if (tr->ctrl & XFER_CTRL_DMA_RX) {
+          /* DMA reads the data, the LAST bit NACKs the final byte */
+        }
         else if (tr->num == 2U) {
           reg->CR1 &= ~I2C_CR1_ACK;
           reg->CR1 |= I2C_CR1_POS;
@@ -893,12 +1179,21 @@ void I2C_EV_IRQHandler(I2C_RESOURCES *i2c)
 
     tr->ctrl |= XFER_CTRL_ADDR_DONE | XFER_CTRL_XACTIVE;
 
-    /* Enable IRQ data transfer */
-    reg->CR2 |= I2C_CR2_ITBUFEN;
+    if (I2C_DMA_Armed(info)) {
+      /* Enable DMA data transfer */
+      reg->CR2 |= I2C_CR2_DMAEN;
+    }
+    else {
+      /* Enable IRQ data transfer */
+      reg->CR2 |= I2C_CR2_ITBUFEN;
+    }
 
   }
   else if (sr1 & I2C_SR1_STOPF) {
     /* STOP condition detected */
+#ifdef I2C_DMA
+    I2C_DMA_Stop(i2c);
+#endif
     tr->data = NULL;
     tr->ctrl = 0U;
 
@@ -943,6 +1238,9 @@ void I2C_EV_IRQHandler(I2C_RESOURCES *i2c)
         }
       }
     }
+    else if (reg->CR2 & I2C_CR2_DMAEN) {
+      /* BTF while DMA moves the data, it is cleared by the next DMA access */
+    }
     else if (sr1 & I2C_SR1_TXE) {
       if (info->status.mode) {
         /* Master transmitter */
@@ -1110,6 +1408,10 @@ void I2C_ER_IRQHandler(I2C_RESOURCES *i2c)
   sr1 = reg->SR1 & (0xDFU << 8);
   event = ARM_I2C_EVENT_TRANSFER_DONE;
 
+#ifdef I2C_DMA
+  I2C_DMA_Stop(i2c);
+#endif
+
   if (sr1 & I2C_SR1_AF) {
     /* Acknowledge failure */
     /* Reset the communication */
@@ -1161,6 +1463,163 @@ void I2C_ER_IRQHandler(I2C_RESOURCES *i2c)
   }
 }
 
+#ifdef I2C_DMA
+/**
+ * @fn          void I2C_TX_DMA_Complete(uint32_t event, I2C_RESOURCES *i2c)
+ * @brief       Transmit DMA stream event handler.
+ * @param[in]   event   DMA stream events
+ * @param[in]   i2c     Pointer to I2C resources
+ */
+static
+void I2C_TX_DMA_Complete(uint32_t event, I2C_RESOURCES *i2c)
+{
+  I2C_INFO volatile *info = i2c->info;
+  I2C_TRANSFER_INFO volatile *tr = &info->xfer;
+
+  if ((event & DMA_EVENT_TRANSFER_COMPLETE) != 0U) {
+    tr->cnt = tr->num;
+
+    if (info->status.mode != 0U) {
+      /* Master transmitter: stop when BTF signals the last byte is sent */
+      tr->ctrl = (tr->ctrl & ~XFER_CTRL_DMA_TX) | XFER_CTRL_DMA_DONE;
+    }
+    else {
+      /* Slave transmitter: further master reads get 0xFF */
+      tr->data  =  NULL;
+      tr->ctrl &= ~XFER_CTRL_DMA_TX;
+    }
+
+    /* Disable DMA requests */
+    i2c->reg->CR2 &= ~I2C_CR2_DMAEN;
+  }
+}
+
+/**
+ * @fn          void I2C_RX_DMA_Complete(uint32_t event, I2C_RESOURCES *i2c)
+ * @brief       Receive DMA stream event handler.
+ * @param[in]   event   DMA stream events
+ * @param[in]   i2c     Pointer to I2C resources
+ */
+static
+void I2C_RX_DMA_Complete(uint32_t event, I2C_RESOURCES *i2c)
+{
+  I2C_INFO volatile *info = i2c->info;
+  I2C_TRANSFER_INFO volatile *tr = &info->xfer;
+  I2C_TypeDef *reg = i2c->reg;
+
+  if ((event & DMA_EVENT_TRANSFER_COMPLETE) != 0U) {
+    tr->cnt   =  tr->num;
+    tr->data  =  NULL;
+    tr->ctrl &= ~XFER_CTRL_DMA_RX;
+
+    if (info->status.mode != 0U) {
+      /* Master receiver: the last byte was NACKed due to the LAST bit */
+      tr->ctrl &= ~XFER_CTRL_XACTIVE;
+      reg->CR2 &= ~(I2C_CR2_DMAEN | I2C_CR2_LAST);
+
+      if (tr->ctrl & XFER_CTRL_XPENDING) {
+        reg->CR2 &= ~I2C_CR2_ITEVTEN;
+      }
+      else {
+        reg->CR1 |= I2C_CR1_STOP;
+      }
+
+      info->status.busy = 0U;
+      info->status.mode = 0U;
+
+      if (info->cb_event) {
+        info->cb_event(ARM_I2C_EVENT_TRANSFER_DONE);
+      }
+    }
+    else {
+      /* Slave receiver: further bytes are NACKed, STOP ends the transfer */
+      reg->CR2 &= ~I2C_CR2_DMAEN;
+    }
+  }
+}
+#endif
+
+#if defined(USE_I2C1)
+#ifdef I2C1_RX_DMA_Stream
+void I2C1_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&I2C1_RX_DMA);
+}
+
+static
+void I2C1_RX_DMA_Complete(uint32_t event)
+{
+  I2C_RX_DMA_Complete(event, &I2C1_Resources);
+}
+#endif
+#ifdef I2C1_TX_DMA_Stream
+void I2C1_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&I2C1_TX_DMA);
+}
+
+static
+void I2C1_TX_DMA_Complete(uint32_t event)
+{
+  I2C_TX_DMA_Complete(event, &I2C1_Resources);
+}
+#endif
+#endif /* USE_I2C1 */
+
+#if defined(USE_I2C2)
+#ifdef I2C2_RX_DMA_Stream
+void I2C2_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&I2C2_RX_DMA);
+}
+
+static
+void I2C2_RX_DMA_Complete(uint32_t event)
+{
+  I2C_RX_DMA_Complete(event, &I2C2_Resources);
+}
+#endif
+#ifdef I2C2_TX_DMA_Stream
+void I2C2_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&I2C2_TX_DMA);
+}
+
+static
+void I2C2_TX_DMA_Complete(uint32_t event)
+{
+  I2C_TX_DMA_Complete(event, &I2C2_Resources);
+}
+#endif
+#endif /* USE_I2C2 */
+
+#if defined(USE_I2C3)
+#ifdef I2C3_RX_DMA_Stream
+void I2C3_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&I2C3_RX_DMA);
+}
+
+static
+void I2C3_RX_DMA_Complete(uint32_t event)
+{
+  I2C_RX_DMA_Complete(event, &I2C3_Resources);
+}
+#endif
+#ifdef I2C3_TX_DMA_Stream
+void I2C3_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&I2C3_TX_DMA);
+}
+
+static
+void I2C3_TX_DMA_Complete(uint32_t event)
+{
+  I2C_TX_DMA_Complete(event, &I2C3_Resources);
+}
+#endif
+#endif /* USE_I2C3 */
+
 /*******************************************************************************
  *  global variable definitions  (scope: module-exported)
  ******************************************************************************/
@@ -30,6 +30,7 @@
 #include <asm/stm32f4xx.h>
 #include <Driver/RCC_STM32F4xx.h>
 #include <Driver/GPIO_STM32F4xx.h>
+#include <Driver/DMA_STM32F4xx.h>
 
 #include <Driver/Driver_I2C.h>
 
@@ -51,6 +52,22 @@
   #define I2C1_SDA_GPIO_PORT        RTE_I2C1_SDA_PORT
   #define I2C1_SDA_GPIO_PIN         RTE_I2C1_SDA_PIN
   #define I2C1_SDA_GPIO_FUNC        RTE_I2C1_SDA_FUNC
+
+  #if (RTE_I2C1_RX_DMA == 1)
+    #define I2C1_RX_DMA_Stream      DMAx_STREAMy(RTE_I2C1_RX_DMA_NUMBER, RTE_I2C1_RX_DMA_STREAM)
+    #define I2C1_RX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_I2C1_RX_DMA_NUMBER, RTE_I2C1_RX_DMA_STREAM)
+    #define I2C1_RX_DMA_Channel     DMA_CHANNEL_x(RTE_I2C1_RX_DMA_CHANNEL)
+    #define I2C1_RX_DMA_Priority    DMA_PRIORITY(RTE_I2C1_RX_DMA_PRIORITY)
+    #define I2C1_RX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_I2C1_RX_DMA_NUMBER, RTE_I2C1_RX_DMA_STREAM)
+  #endif
+
+  #if (RTE_I2C1_TX_DMA == 1)
+    #define I2C1_TX_DMA_Stream      DMAx_STREAMy(RTE_I2C1_TX_DMA_NUMBER, RTE_I2C1_TX_DMA_STREAM)
+    #define I2C1_TX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_I2C1_TX_DMA_NUMBER, RTE_I2C1_TX_DMA_STREAM)
+    #define I2C1_TX_DMA_Channel     DMA_CHANNEL_x(RTE_I2C1_TX_DMA_CHANNEL)
+    #define I2C1_TX_DMA_Priority    DMA_PRIORITY(RTE_I2C1_TX_DMA_PRIORITY)
+    #define I2C1_TX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_I2C1_TX_DMA_NUMBER, RTE_I2C1_TX_DMA_STREAM)
+  #endif
 #endif
 
 /* I2C2 configuration definitions */
@@ -68,6 +85,22 @@
   #define I2C2_SDA_GPIO_PORT        RTE_I2C2_SDA_PORT
   #define I2C2_SDA_GPIO_PIN         RTE_I2C2_SDA_PIN
   #define I2C2_SDA_GPIO_FUNC        RTE_I2C2_SDA_FUNC
+
+  #if (RTE_I2C2_RX_DMA == 1)
+    #define I2C2_RX_DMA_Stream      DMAx_STREAMy(RTE_I2C2_RX_DMA_NUMBER, RTE_I2C2_RX_DMA_STREAM)
+    #define I2C2_RX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_I2C2_RX_DMA_NUMBER, RTE_I2C2_RX_DMA_STREAM)
+    #define I2C2_RX_DMA_Channel     DMA_CHANNEL_x(RTE_I2C2_RX_DMA_CHANNEL)
+    #define I2C2_RX_DMA_Priority    DMA_PRIORITY(RTE_I2C2_RX_DMA_PRIORITY)
+    #define I2C2_RX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_I2C2_RX_DMA_NUMBER, RTE_I2C2_RX_DMA_STREAM)
+  #endif
+
+  #if (RTE_I2C2_TX_DMA == 1)
+    #define I2C2_TX_DMA_Stream      DMAx_STREAMy(RTE_I2C2_TX_DMA_NUMBER, RTE_I2C2_TX_DMA_STREAM)
+    #define I2C2_TX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_I2C2_TX_DMA_NUMBER, RTE_I2C2_TX_DMA_STREAM)
+    #define I2C2_TX_DMA_Channel     DMA_CHANNEL_x(RTE_I2C2_TX_DMA_CHANNEL)
+    #define I2C2_TX_DMA_Priority    DMA_PRIORITY(RTE_I2C2_TX_DMA_PRIORITY)
+    #define I2C2_TX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_I2C2_TX_DMA_NUMBER, RTE_I2C2_TX_DMA_STREAM)
+  #endif
 #endif
 
 /* I2C3 configuration definitions */
@@ -85,6 +118,29 @@
   #define I2C3_SDA_GPIO_PORT        RTE_I2C3_SDA_PORT
   #define I2C3_SDA_GPIO_PIN         RTE_I2C3_SDA_PIN
   #define I2C3_SDA_GPIO_FUNC        RTE_I2C3_SDA_FUNC
+
+  #if (RTE_I2C3_RX_DMA == 1)
+    #define I2C3_RX_DMA_Stream      DMAx_STREAMy(RTE_I2C3_RX_DMA_NUMBER, RTE_I2C3_RX_DMA_STREAM)
+    #define I2C3_RX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_I2C3_RX_DMA_NUMBER, RTE_I2C3_RX_DMA_STREAM)
+    #define I2C3_RX_DMA_Channel     DMA_CHANNEL_x(RTE_I2C3_RX_DMA_CHANNEL)
+    #define I2C3_RX_DMA_Priority    DMA_PRIORITY(RTE_I2C3_RX_DMA_PRIORITY)
+    #define I2C3_RX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_I2C3_RX_DMA_NUMBER, RTE_I2C3_RX_DMA_STREAM)
+  #endif
+
+  #if (RTE_I2C3_TX_DMA == 1)
+    #define I2C3_TX_DMA_Stream      DMAx_STREAMy(RTE_I2C3_TX_DMA_NUMBER, RTE_I2C3_TX_DMA_STREAM)
+    #define I2C3_TX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_I2C3_TX_DMA_NUMBER, RTE_I2C3_TX_DMA_STREAM)
+    #define I2C3_TX_DMA_Channel     DMA_CHANNEL_x(RTE_I2C3_TX_DMA_CHANNEL)
+    #define I2C3_TX_DMA_Priority    DMA_PRIORITY(RTE_I2C3_TX_DMA_PRIORITY)
+    #define I2C3_TX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_I2C3_TX_DMA_NUMBER, RTE_I2C3_TX_DMA_STREAM)
+  #endif
+#endif
+
+/* I2C DMA usage */
+#if ((defined(USE_I2C1) && (defined(I2C1_RX_DMA_Stream) || defined(I2C1_TX_DMA_Stream))) || \
+     (defined(USE_I2C2) && (defined(I2C2_RX_DMA_Stream) || defined(I2C2_TX_DMA_Stream))) || \
+     (defined(USE_I2C3) && (defined(I2C3_RX_DMA_Stream) || defined(I2C3_TX_DMA_Stream))))
+  #define I2C_DMA
 #endif
 
 #define I2Cx_EXPORT_DRIVER(x)                                                                                                                                                                                 \
@@ -132,13 +188,13 @@ ARM_DRIVER_I2C Driver_I2C##x = {  \
 #define XFER_CTRL_DMA_DONE  (1UL << 3)      // DMA transfer done
 #define XFER_CTRL_WAIT_BTF  (1UL << 4)      // Wait for byte transfer finished
 #define XFER_CTRL_XACTIVE   (1UL << 5)      // Transfer active
+#define XFER_CTRL_DMA_TX    (1UL << 6)      // Transmit DMA stream armed
+#define XFER_CTRL_DMA_RX    (1UL << 7)      // Receive DMA stream armed
 
 /*******************************************************************************
  *  typedefs and structures (scope: module-local)
  ******************************************************************************/
 
-typedef void* I2C_DMA;
-
 /* I2C Input/Output Configuration */
 typedef const struct _I2C_IO {
   GPIO_PORT_t           scl_port;           // SCL IO port
@@ -169,8 +225,8 @@ typedef struct _I2C_INFO {
 /* I2C Resource Configuration */
 typedef struct {
   I2C_TypeDef          *reg;                // I2C peripheral register interface
-  I2C_DMA              *dma_rx;             // I2C DMA Configuration
-  I2C_DMA              *dma_tx;             // I2C DMA Configuration
+  DMA_Resources_t      *dma_rx;             // I2C receive DMA stream
+  DMA_Resources_t      *dma_tx;             // I2C transmit DMA stream
   I2C_IO                io;                 // I2C Input/Output pins
   I2C_INFO             *info;               // Run-Time information
   RCC_Periph_t          rcc;                // RCC Clock/Reset registers
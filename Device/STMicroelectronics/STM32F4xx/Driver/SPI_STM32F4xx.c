@@ -735,6 +735,127 @@ int32_t CalcPrescalerValue(SPI_RESOURCES *spi, uint32_t freq)
   return (val);
 }
 
+/**
+ * @fn          void SPI_SegmentStart(SPI_RESOURCES *spi)
+ * @brief       Start the current segment of a transfer list.
+ * @param[in]   spi  Pointer to SPI resources
+ */
+static
+void SPI_SegmentStart(SPI_RESOURCES *spi)
+{
+  SPI_TRANSFER_INFO *xfer = spi->xfer;
+  const SPI_SEGMENT *seg  = xfer->segment;
+  SPI_TypeDef       *reg  = spi->reg;
+  uint32_t           cr2;
+
+  if ((seg->cs & SPI_SEGMENT_CS_ASSERT) != 0U) {
+    GPIO_PinWrite((GPIO_PORT_t)seg->cs_port, (GPIO_PIN_t)seg->cs_pin, GPIO_PIN_OUT_LOW);
+  }
+
+  /* Save transfer info */
+  xfer->rx_buf = (uint8_t *)seg->data_in;
+  xfer->tx_buf = (uint8_t *)((uint32_t)seg->data_out);
+  xfer->num    = seg->num;
+  xfer->rx_cnt = 0U;
+  xfer->tx_cnt = 0U;
+
+  cr2 = reg->CR2;
+
+#ifdef SPI_DMA
+  if ((spi->rx_dma != NULL) && (spi->tx_dma != NULL)) {
+    /* DMA mode */
+    DMA_StreamConfig_t *rx_cfg = &spi->rx_dma->handle->config;
+    DMA_StreamConfig_t *tx_cfg = &spi->tx_dma->handle->config;
+
+    rx_cfg->PerInc = DMA_PINC_DISABLE;
+    tx_cfg->PerInc = DMA_PINC_DISABLE;
+
+    if ((reg->CR1 & SPI_CR1_DFF) != 0U) {
+      /* 16 - bit data frame */
+      rx_cfg->MemDataAlign = DMA_MDATAALIGN_HALFWORD;
+      rx_cfg->PerDataAlign = DMA_PDATAALIGN_HALFWORD;
+      tx_cfg->MemDataAlign = DMA_MDATAALIGN_HALFWORD;
+      tx_cfg->PerDataAlign = DMA_PDATAALIGN_HALFWORD;
+    }
+    else {
+      /* 8 - bit data frame */
+      rx_cfg->MemDataAlign = DMA_MDATAALIGN_BYTE;
+      rx_cfg->PerDataAlign = DMA_PDATAALIGN_BYTE;
+      tx_cfg->MemDataAlign = DMA_MDATAALIGN_BYTE;
+      tx_cfg->PerDataAlign = DMA_PDATAALIGN_BYTE;
+    }
+
+    /* Receive into the buffer or dump the data */
+    if (seg->data_in != NULL) {
+      rx_cfg->MemInc = DMA_MINC_ENABLE;
+      DMA_StreamConfig(spi->rx_dma);
+      DMA_StreamEnable(spi->rx_dma, (uint32_t)&reg->DR, (uint32_t)seg->data_in, seg->num);
+    }
+    else {
+      rx_cfg->MemInc = DMA_MINC_DISABLE;
+      DMA_StreamConfig(spi->rx_dma);
+      DMA_StreamEnable(spi->rx_dma, (uint32_t)&reg->DR, (uint32_t)&xfer->dump_val, seg->num);
+    }
+
+    /* Send the buffer or the default value */
+    if (seg->data_out != NULL) {
+      tx_cfg->MemInc = DMA_MINC_ENABLE;
+      DMA_StreamConfig(spi->tx_dma);
+      DMA_StreamEnable(spi->tx_dma, (uint32_t)&reg->DR, (uint32_t)seg->data_out, seg->num);
+    }
+    else {
+      tx_cfg->MemInc = DMA_MINC_DISABLE;
+      DMA_StreamConfig(spi->tx_dma);
+      DMA_StreamEnable(spi->tx_dma, (uint32_t)&reg->DR, (uint32_t)&xfer->def_val, seg->num);
+    }
+
+    /* RX and TX Buffer DMA enable */
+    cr2 |= SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN;
+  }
+  else
+#endif
+  {
+    /* Interrupt mode, the first data is written on TX Buffer empty */
+    cr2 |= SPI_CR2_RXNEIE | SPI_CR2_TXEIE;
+  }
+
+  reg->CR2 = cr2;
+}
+
+/**
+ * @fn          bool SPI_SegmentNext(SPI_RESOURCES *spi)
+ * @brief       Finish the current segment of a transfer list and start the next one.
+ * @param[in]   spi  Pointer to SPI resources
+ * @return      true - next segment started, false - transfer list completed or
+ *              paused (the current segment is not NULL)
+ */
+static
+bool SPI_SegmentNext(SPI_RESOURCES *spi)
+{
+  SPI_TRANSFER_INFO *xfer = spi->xfer;
+  const SPI_SEGMENT *seg  = xfer->segment;
+
+  if ((seg->cs & SPI_SEGMENT_CS_RELEASE) != 0U) {
+    GPIO_PinWrite((GPIO_PORT_t)seg->cs_port, (GPIO_PIN_t)seg->cs_pin, GPIO_PIN_OUT_HIGH);
+  }
+
+  if (--xfer->segment_num == 0U) {
+    xfer->segment = NULL;
+    return (false);
+  }
+
+  xfer->segment++;
+
+  /* Pause only between segments, the application continues the list */
+  if ((seg->flags & SPI_SEGMENT_PAUSE) != 0U) {
+    return (false);
+  }
+
+  SPI_SegmentStart(spi);
+
+  return (true);
+}
+
 /**
  * @fn          ARM_DRIVER_VERSION SPIx_GetVersion(void)
  * @brief       Get driver version.
@@ -1292,6 +1413,68 @@ int32_t SPI_Transfer(const void *data_out, void *data_in, uint32_t num, SPI_RESO
   return ARM_DRIVER_OK;
 }
 
+/**
+ * @fn          int32_t SPI_TransferList(const SPI_TRANSFER_LIST *list, SPI_RESOURCES *spi)
+ * @brief       Start a transfer list, the segments are chained in the driver.
+ * @param[in]   list  Pointer to transfer list
+ * @param[in]   spi   Pointer to SPI resources
+ * @return      \ref execution_status
+ */
+static
+int32_t SPI_TransferList(const SPI_TRANSFER_LIST *list, SPI_RESOURCES *spi)
+{
+  SPI_INFO *info = spi->info;
+  SPI_TRANSFER_INFO *xfer = spi->xfer;
+  uint32_t i;
+
+  if ((list == NULL) || (list->segment == NULL) || (list->num == 0U)) {
+    return (ARM_DRIVER_ERROR_PARAMETER);
+  }
+
+  for (i = 0U; i < list->num; i++) {
+    if (list->segment[i].num == 0U) {
+      return (ARM_DRIVER_ERROR_PARAMETER);
+    }
+  }
+
+  if ((info->state & SPI_CONFIGURED) == 0U) {
+    return (ARM_DRIVER_ERROR);
+  }
+
+  /* Update SPI statuses */
+  info->status.busy       = 1U;
+  info->status.data_lost  = 0U;
+  info->status.mode_fault = 0U;
+
+  xfer->segment     = list->segment;
+  xfer->segment_num = list->num;
+
+  SPI_SegmentStart(spi);
+
+  return (ARM_DRIVER_OK);
+}
+
+/**
+ * @fn          int32_t SPI_TransferResume(SPI_RESOURCES *spi)
+ * @brief       Continue a transfer list paused after a segment.
+ * @param[in]   spi   Pointer to SPI resources
+ * @return      \ref execution_status
+ */
+static
+int32_t SPI_TransferResume(SPI_RESOURCES *spi)
+{
+  SPI_TRANSFER_INFO *xfer = spi->xfer;
+
+  /* Paused list: the next segment is set, the data of the previous one is done */
+  if ((xfer->segment == NULL) || (xfer->rx_cnt != xfer->num)) {
+    return (ARM_DRIVER_ERROR);
+  }
+
+  SPI_SegmentStart(spi);
+
+  return (ARM_DRIVER_OK);
+}
+
 /**
  * @fn          uint32_t SPI_GetDataCount(SPI_RESOURCES *spi)
  * @brief       Get transferred data count.
@@ -1364,12 +1547,22 @@ int32_t SPI_Control(uint32_t control, uint32_t arg, SPI_RESOURCES *spi)
 
     reg->CR2 = cr2;
 
+    /* Release chip select of the transfer list */
+    if ((spi->xfer->segment != NULL) && (spi->xfer->segment->cs != 0U)) {
+      GPIO_PinWrite((GPIO_PORT_t)spi->xfer->segment->cs_port, (GPIO_PIN_t)spi->xfer->segment->cs_pin, GPIO_PIN_OUT_HIGH);
+    }
+
     memset((void *)spi->xfer, 0, sizeof(SPI_TRANSFER_INFO));
     info->status.busy = 0U;
 
     return ARM_DRIVER_OK;
   }
 
+  /* Paused transfer list stays busy until it is continued */
+  if ((control & ARM_SPI_CONTROL_Msk) == SPI_CONTROL_TRANSFER_RESUME) {
+    return SPI_TransferResume(spi);
+  }
+
   // Check for busy flag
   if (info->status.busy)
     return ARM_DRIVER_ERROR_BUSY;
@@ -1414,6 +1607,9 @@ int32_t SPI_Control(uint32_t control, uint32_t arg, SPI_RESOURCES *spi)
       spi->xfer->def_val = (uint16_t)(arg & 0xFFFFU);
       return ARM_DRIVER_OK;
 
+    case SPI_CONTROL_TRANSFER_LIST:
+      return SPI_TransferList((const SPI_TRANSFER_LIST *)arg, spi);
+
     case ARM_SPI_CONTROL_SS:
       val = (info->mode & ARM_SPI_CONTROL_Msk);
       // Master modes
@@ -1705,10 +1901,25 @@ void SPI_IRQHandler(SPI_RESOURCES *spi)
       if (xfer->rx_cnt == xfer->num) {
         /* Disable RX Buffer Not Empty Interrupt */
         cr2 &= ~SPI_CR2_RXNEIE;
-        /* Clear busy flag */
-        info->status.busy = 0U;
-        /* Transfer completed */
-        event |= ARM_SPI_EVENT_TRANSFER_COMPLETE;
+
+        if (xfer->segment != NULL) {
+          /* Transfer list: continue with the next segment */
+          reg->CR2 = cr2;
+          if (SPI_SegmentNext(spi)) {
+            cr2 = reg->CR2;
+          }
+          else if (xfer->segment != NULL) {
+            /* Paused, the application continues the list */
+            event |= SPI_EVENT_SEGMENT_PAUSE;
+          }
+        }
+
+        if (xfer->segment == NULL) {
+          /* Clear busy flag */
+          info->status.busy = 0U;
+          /* Transfer completed */
+          event |= ARM_SPI_EVENT_TRANSFER_COMPLETE;
+        }
       }
     }
     else {
@@ -1772,9 +1983,23 @@ void SPI_RX_DMA_Complete(uint32_t event, SPI_RESOURCES *spi)
 
   if (event & DMA_EVENT_TRANSFER_COMPLETE) {
     /* RX Buffer DMA disable */
-    spi->reg->CR2 |= SPI_CR2_RXDMAEN;
+    spi->reg->CR2 &= ~SPI_CR2_RXDMAEN;
 
     spi->xfer->rx_cnt = spi->xfer->num;
+
+    if (spi->xfer->segment != NULL) {
+      if (SPI_SegmentNext(spi)) {
+        /* Transfer list continues with the next segment */
+        return;
+      }
+      if (spi->xfer->segment != NULL) {
+        /* Paused, the application continues the list */
+        if (info->cb_event != NULL)
+          info->cb_event(SPI_EVENT_SEGMENT_PAUSE);
+        return;
+      }
+    }
+
     info->status.busy = 0U;
 
     if (info->cb_event != NULL)
@@ -32,7 +32,7 @@
 #include <Driver/GPIO_STM32F4xx.h>
 #include <Driver/DMA_STM32F4xx.h>
 
-#include <Driver/Driver_SPI.h>
+#include <Driver/Driver_SPI_Ext.h>
 
 #include <device_config.h>
 
@@ -761,6 +761,8 @@ typedef struct _SPI_TRANSFER_INFO {
   uint32_t              dump_val;           // Variable for dumping DMA data
   uint16_t              def_val;            // Default transfer value
   uint16_t              reserved;           // Reserved
+  const SPI_SEGMENT    *segment;            // Transfer list: current segment
+  uint32_t              segment_num;        // Transfer list: number of segments left
 } SPI_TRANSFER_INFO;
 
 /* SPI Resource Configuration */
@@ -38,6 +38,93 @@
  *  typedefs and structures (scope: module-local)
  ******************************************************************************/
 
+/*******************************************************************************
+ *  function prototypes (scope: module-local)
+ ******************************************************************************/
+
+static
+int32_t USART_Receive(void *data, uint32_t num, USART_RESOURCES *usart);
+
+#ifdef USART1_TX_DMA_Stream
+static void USART1_TX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef USART1_RX_DMA_Stream
+static void USART1_RX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef USART2_TX_DMA_Stream
+static void USART2_TX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef USART2_RX_DMA_Stream
+static void USART2_RX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef USART3_TX_DMA_Stream
+static void USART3_TX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef USART3_RX_DMA_Stream
+static void USART3_RX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART4_TX_DMA_Stream
+static void UART4_TX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART4_RX_DMA_Stream
+static void UART4_RX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART5_TX_DMA_Stream
+static void UART5_TX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART5_RX_DMA_Stream
+static void UART5_RX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef USART6_TX_DMA_Stream
+static void USART6_TX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef USART6_RX_DMA_Stream
+static void USART6_RX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART7_TX_DMA_Stream
+static void UART7_TX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART7_RX_DMA_Stream
+static void UART7_RX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART8_TX_DMA_Stream
+static void UART8_TX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART8_RX_DMA_Stream
+static void UART8_RX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART9_TX_DMA_Stream
+static void UART9_TX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART9_RX_DMA_Stream
+static void UART9_RX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART10_TX_DMA_Stream
+static void UART10_TX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART10_RX_DMA_Stream
+static void UART10_RX_DMA_Complete(uint32_t event);
+#endif
+
 /*******************************************************************************
  *  global variable definitions (scope: module-local)
  ******************************************************************************/
@@ -107,6 +194,32 @@ static const USART_PIN USART1_cts = {
 };
 #endif
 
+#ifdef USART1_TX_DMA_Stream
+static DMA_Handle_t USART1_TX_DMA_Handle;
+static DMA_Resources_t USART1_TX_DMA = {
+  &USART1_TX_DMA_Handle,
+  USART1_TX_DMA_Stream,
+  USART1_TX_DMA_Channel,
+  USART1_TX_DMA_Priority,
+  USART1_TX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  USART1_TX_DMA_IRQn,
+};
+#endif
+
+#ifdef USART1_RX_DMA_Stream
+static DMA_Handle_t USART1_RX_DMA_Handle;
+static DMA_Resources_t USART1_RX_DMA = {
+  &USART1_RX_DMA_Handle,
+  USART1_RX_DMA_Stream,
+  USART1_RX_DMA_Channel,
+  USART1_RX_DMA_Priority,
+  USART1_RX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  USART1_RX_DMA_IRQn,
+};
+#endif
+
 // USART1 Resources
 static const USART_RESOURCES USART1_Resources = {
   {     // Capabilities
@@ -190,6 +303,16 @@ static const USART_RESOURCES USART1_Resources = {
 
   USART1_IRQn,
   RCC_PERIPH_USART1,
+#ifdef USART1_TX_DMA_Stream
+  &USART1_TX_DMA,
+#else
+  NULL,
+#endif
+#ifdef USART1_RX_DMA_Stream
+  &USART1_RX_DMA,
+#else
+  NULL,
+#endif
   &USART1_Info,
   &USART1_TransferInfo,
 };
@@ -242,6 +365,32 @@ static const USART_PIN USART2_cts = {
 };
 #endif
 
+#ifdef USART2_TX_DMA_Stream
+static DMA_Handle_t USART2_TX_DMA_Handle;
+static DMA_Resources_t USART2_TX_DMA = {
+  &USART2_TX_DMA_Handle,
+  USART2_TX_DMA_Stream,
+  USART2_TX_DMA_Channel,
+  USART2_TX_DMA_Priority,
+  USART2_TX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  USART2_TX_DMA_IRQn,
+};
+#endif
+
+#ifdef USART2_RX_DMA_Stream
+static DMA_Handle_t USART2_RX_DMA_Handle;
+static DMA_Resources_t USART2_RX_DMA = {
+  &USART2_RX_DMA_Handle,
+  USART2_RX_DMA_Stream,
+  USART2_RX_DMA_Channel,
+  USART2_RX_DMA_Priority,
+  USART2_RX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  USART2_RX_DMA_IRQn,
+};
+#endif
+
 // USART2 Resources
 static const USART_RESOURCES USART2_Resources = {
   {     // Capabilities
@@ -325,6 +474,16 @@ static const USART_RESOURCES USART2_Resources = {
 
   USART2_IRQn,
   RCC_PERIPH_USART2,
+#ifdef USART2_TX_DMA_Stream
+  &USART2_TX_DMA,
+#else
+  NULL,
+#endif
+#ifdef USART2_RX_DMA_Stream
+  &USART2_RX_DMA,
+#else
+  NULL,
+#endif
   &USART2_Info,
   &USART2_TransferInfo,
 };
@@ -377,6 +536,32 @@ static const USART_PIN USART3_cts = {
 };
 #endif
 
+#ifdef USART3_TX_DMA_Stream
+static DMA_Handle_t USART3_TX_DMA_Handle;
+static DMA_Resources_t USART3_TX_DMA = {
+  &USART3_TX_DMA_Handle,
+  USART3_TX_DMA_Stream,
+  USART3_TX_DMA_Channel,
+  USART3_TX_DMA_Priority,
+  USART3_TX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  USART3_TX_DMA_IRQn,
+};
+#endif
+
+#ifdef USART3_RX_DMA_Stream
+static DMA_Handle_t USART3_RX_DMA_Handle;
+static DMA_Resources_t USART3_RX_DMA = {
+  &USART3_RX_DMA_Handle,
+  USART3_RX_DMA_Stream,
+  USART3_RX_DMA_Channel,
+  USART3_RX_DMA_Priority,
+  USART3_RX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  USART3_RX_DMA_IRQn,
+};
+#endif
+
 // USART3 Resources
 static const USART_RESOURCES USART3_Resources = {
   {     // Capabilities
@@ -460,6 +645,16 @@ static const USART_RESOURCES USART3_Resources = {
 
   USART3_IRQn,
   RCC_PERIPH_USART3,
+#ifdef USART3_TX_DMA_Stream
+  &USART3_TX_DMA,
+#else
+  NULL,
+#endif
+#ifdef USART3_RX_DMA_Stream
+  &USART3_RX_DMA,
+#else
+  NULL,
+#endif
   &USART3_Info,
   &USART3_TransferInfo,
 };
@@ -488,6 +683,32 @@ static const USART_PIN UART4_rx = {
 };
 #endif
 
+#ifdef UART4_TX_DMA_Stream
+static DMA_Handle_t UART4_TX_DMA_Handle;
+static DMA_Resources_t UART4_TX_DMA = {
+  &UART4_TX_DMA_Handle,
+  UART4_TX_DMA_Stream,
+  UART4_TX_DMA_Channel,
+  UART4_TX_DMA_Priority,
+  UART4_TX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART4_TX_DMA_IRQn,
+};
+#endif
+
+#ifdef UART4_RX_DMA_Stream
+static DMA_Handle_t UART4_RX_DMA_Handle;
+static DMA_Resources_t UART4_RX_DMA = {
+  &UART4_RX_DMA_Handle,
+  UART4_RX_DMA_Stream,
+  UART4_RX_DMA_Channel,
+  UART4_RX_DMA_Priority,
+  UART4_RX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART4_RX_DMA_IRQn,
+};
+#endif
+
 // UART4 Resources
 static const USART_RESOURCES USART4_Resources = {
   {     // Capabilities
@@ -535,6 +756,16 @@ static const USART_RESOURCES USART4_Resources = {
 
   UART4_IRQn,
   RCC_PERIPH_UART4,
+#ifdef UART4_TX_DMA_Stream
+  &UART4_TX_DMA,
+#else
+  NULL,
+#endif
+#ifdef UART4_RX_DMA_Stream
+  &UART4_RX_DMA,
+#else
+  NULL,
+#endif
   &UART4_Info,
   &UART4_TransferInfo
 };
@@ -563,6 +794,32 @@ static const USART_PIN UART5_rx = {
 };
 #endif
 
+#ifdef UART5_TX_DMA_Stream
+static DMA_Handle_t UART5_TX_DMA_Handle;
+static DMA_Resources_t UART5_TX_DMA = {
+  &UART5_TX_DMA_Handle,
+  UART5_TX_DMA_Stream,
+  UART5_TX_DMA_Channel,
+  UART5_TX_DMA_Priority,
+  UART5_TX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART5_TX_DMA_IRQn,
+};
+#endif
+
+#ifdef UART5_RX_DMA_Stream
+static DMA_Handle_t UART5_RX_DMA_Handle;
+static DMA_Resources_t UART5_RX_DMA = {
+  &UART5_RX_DMA_Handle,
+  UART5_RX_DMA_Stream,
+  UART5_RX_DMA_Channel,
+  UART5_RX_DMA_Priority,
+  UART5_RX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART5_RX_DMA_IRQn,
+};
+#endif
+
 // UART5 Resources
 static const USART_RESOURCES USART5_Resources = {
   {     // Capabilities
@@ -610,6 +867,16 @@ static const USART_RESOURCES USART5_Resources = {
 
   UART5_IRQn,
   RCC_PERIPH_UART5,
+#ifdef UART5_TX_DMA_Stream
+  &UART5_TX_DMA,
+#else
+  NULL,
+#endif
+#ifdef UART5_RX_DMA_Stream
+  &UART5_RX_DMA,
+#else
+  NULL,
+#endif
   &UART5_Info,
   &UART5_TransferInfo
 };
@@ -662,6 +929,32 @@ static const USART_PIN USART6_cts = {
 };
 #endif
 
+#ifdef USART6_TX_DMA_Stream
+static DMA_Handle_t USART6_TX_DMA_Handle;
+static DMA_Resources_t USART6_TX_DMA = {
+  &USART6_TX_DMA_Handle,
+  USART6_TX_DMA_Stream,
+  USART6_TX_DMA_Channel,
+  USART6_TX_DMA_Priority,
+  USART6_TX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  USART6_TX_DMA_IRQn,
+};
+#endif
+
+#ifdef USART6_RX_DMA_Stream
+static DMA_Handle_t USART6_RX_DMA_Handle;
+static DMA_Resources_t USART6_RX_DMA = {
+  &USART6_RX_DMA_Handle,
+  USART6_RX_DMA_Stream,
+  USART6_RX_DMA_Channel,
+  USART6_RX_DMA_Priority,
+  USART6_RX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  USART6_RX_DMA_IRQn,
+};
+#endif
+
 // USART6 Resources
 static const USART_RESOURCES USART6_Resources = {
   {     // Capabilities
@@ -745,6 +1038,16 @@ static const USART_RESOURCES USART6_Resources = {
 
   USART6_IRQn,
   RCC_PERIPH_USART6,
+#ifdef USART6_TX_DMA_Stream
+  &USART6_TX_DMA,
+#else
+  NULL,
+#endif
+#ifdef USART6_RX_DMA_Stream
+  &USART6_RX_DMA,
+#else
+  NULL,
+#endif
   &USART6_Info,
   &USART6_TransferInfo
 };
@@ -773,6 +1076,32 @@ static const USART_PIN UART7_rx = {
 };
 #endif
 
+#ifdef UART7_TX_DMA_Stream
+static DMA_Handle_t UART7_TX_DMA_Handle;
+static DMA_Resources_t UART7_TX_DMA = {
+  &UART7_TX_DMA_Handle,
+  UART7_TX_DMA_Stream,
+  UART7_TX_DMA_Channel,
+  UART7_TX_DMA_Priority,
+  UART7_TX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART7_TX_DMA_IRQn,
+};
+#endif
+
+#ifdef UART7_RX_DMA_Stream
+static DMA_Handle_t UART7_RX_DMA_Handle;
+static DMA_Resources_t UART7_RX_DMA = {
+  &UART7_RX_DMA_Handle,
+  UART7_RX_DMA_Stream,
+  UART7_RX_DMA_Channel,
+  UART7_RX_DMA_Priority,
+  UART7_RX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART7_RX_DMA_IRQn,
+};
+#endif
+
 // UART7 Resources
 static const USART_RESOURCES USART7_Resources = {
   {     // Capabilities
@@ -820,6 +1149,16 @@ static const USART_RESOURCES USART7_Resources = {
 
   UART7_IRQn,
   RCC_PERIPH_UART7,
+#ifdef UART7_TX_DMA_Stream
+  &UART7_TX_DMA,
+#else
+  NULL,
+#endif
+#ifdef UART7_RX_DMA_Stream
+  &UART7_RX_DMA,
+#else
+  NULL,
+#endif
   &UART7_Info,
   &UART7_TransferInfo,
 };
@@ -848,6 +1187,32 @@ static const USART_PIN UART8_rx = {
 };
 #endif
 
+#ifdef UART8_TX_DMA_Stream
+static DMA_Handle_t UART8_TX_DMA_Handle;
+static DMA_Resources_t UART8_TX_DMA = {
+  &UART8_TX_DMA_Handle,
+  UART8_TX_DMA_Stream,
+  UART8_TX_DMA_Channel,
+  UART8_TX_DMA_Priority,
+  UART8_TX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART8_TX_DMA_IRQn,
+};
+#endif
+
+#ifdef UART8_RX_DMA_Stream
+static DMA_Handle_t UART8_RX_DMA_Handle;
+static DMA_Resources_t UART8_RX_DMA = {
+  &UART8_RX_DMA_Handle,
+  UART8_RX_DMA_Stream,
+  UART8_RX_DMA_Channel,
+  UART8_RX_DMA_Priority,
+  UART8_RX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART8_RX_DMA_IRQn,
+};
+#endif
+
 // UART8 Resources
 static const USART_RESOURCES USART8_Resources = {
   {     // Capabilities
@@ -895,6 +1260,16 @@ static const USART_RESOURCES USART8_Resources = {
 
   UART8_IRQn,
   RCC_PERIPH_UART8,
+#ifdef UART8_TX_DMA_Stream
+  &UART8_TX_DMA,
+#else
+  NULL,
+#endif
+#ifdef UART8_RX_DMA_Stream
+  &UART8_RX_DMA,
+#else
+  NULL,
+#endif
   &UART8_Info,
   &UART8_TransferInfo,
 };
@@ -923,6 +1298,32 @@ static const USART_PIN UART9_rx = {
 };
 #endif
 
+#ifdef UART9_TX_DMA_Stream
+static DMA_Handle_t UART9_TX_DMA_Handle;
+static DMA_Resources_t UART9_TX_DMA = {
+  &UART9_TX_DMA_Handle,
+  UART9_TX_DMA_Stream,
+  UART9_TX_DMA_Channel,
+  UART9_TX_DMA_Priority,
+  UART9_TX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART9_TX_DMA_IRQn,
+};
+#endif
+
+#ifdef UART9_RX_DMA_Stream
+static DMA_Handle_t UART9_RX_DMA_Handle;
+static DMA_Resources_t UART9_RX_DMA = {
+  &UART9_RX_DMA_Handle,
+  UART9_RX_DMA_Stream,
+  UART9_RX_DMA_Channel,
+  UART9_RX_DMA_Priority,
+  UART9_RX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART9_RX_DMA_IRQn,
+};
+#endif
+
 // UART9 Resources
 static const USART_RESOURCES USART9_Resources = {
   {     // Capabilities
@@ -970,6 +1371,16 @@ static const USART_RESOURCES USART9_Resources = {
 
   UART9_IRQn,
   RCC_PERIPH_UART9,
+#ifdef UART9_TX_DMA_Stream
+  &UART9_TX_DMA,
+#else
+  NULL,
+#endif
+#ifdef UART9_RX_DMA_Stream
+  &UART9_RX_DMA,
+#else
+  NULL,
+#endif
   &UART9_Info,
   &UART9_TransferInfo
 };
@@ -998,6 +1409,32 @@ static const USART_PIN UART10_rx = {
 };
 #endif
 
+#ifdef UART10_TX_DMA_Stream
+static DMA_Handle_t UART10_TX_DMA_Handle;
+static DMA_Resources_t UART10_TX_DMA = {
+  &UART10_TX_DMA_Handle,
+  UART10_TX_DMA_Stream,
+  UART10_TX_DMA_Channel,
+  UART10_TX_DMA_Priority,
+  UART10_TX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART10_TX_DMA_IRQn,
+};
+#endif
+
+#ifdef UART10_RX_DMA_Stream
+static DMA_Handle_t UART10_RX_DMA_Handle;
+static DMA_Resources_t UART10_RX_DMA = {
+  &UART10_RX_DMA_Handle,
+  UART10_RX_DMA_Stream,
+  UART10_RX_DMA_Channel,
+  UART10_RX_DMA_Priority,
+  UART10_RX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART10_RX_DMA_IRQn,
+};
+#endif
+
 // UART10 Resources
 static const USART_RESOURCES USART10_Resources = {
   {     // Capabilities
@@ -1045,18 +1482,21 @@ static const USART_RESOURCES USART10_Resources = {
 
   UART10_IRQn,
   RCC_PERIPH_UART10,
+#ifdef UART10_TX_DMA_Stream
+  &UART10_TX_DMA,
+#else
+  NULL,
+#endif
+#ifdef UART10_RX_DMA_Stream
+  &UART10_RX_DMA,
+#else
+  NULL,
+#endif
   &UART10_Info,
   &UART10_TransferInfo
 };
 #endif
 
-/*******************************************************************************
- *  function prototypes (scope: module-local)
- ******************************************************************************/
-
-static
-int32_t USART_Receive(void *data, uint32_t num, USART_RESOURCES *usart);
-
 /*******************************************************************************
  *  function implementations (scope: module-local)
  ******************************************************************************/
@@ -1198,6 +1638,17 @@ int32_t USART_PowerControl(ARM_POWER_STATE state, USART_RESOURCES *usart)
       /* Disable IRQ */
       NVIC_DisableIRQ(usart->irq_num);
 
+#if defined(USART_DMA_TX) || defined(USART_DMA_RX)
+      // Uninitialize DMA
+      if ((info->flags & USART_FLAG_POWERED) != 0U) {
+        if (usart->dma_tx != NULL)
+          DMA_Uninitialize(usart->dma_tx);
+
+        if (usart->dma_rx != NULL)
+          DMA_Uninitialize(usart->dma_rx);
+      }
+#endif
+
       // Disable USART clock
       RCC_DisablePeriph(usart->rcc);
 
@@ -1252,6 +1703,37 @@ int32_t USART_PowerControl(ARM_POWER_STATE state, USART_RESOURCES *usart)
       NVIC_SetPriority(usart->irq_num, RTE_USART_INT_PRIORITY);
       NVIC_EnableIRQ(usart->irq_num);
 
+      // Initialize DMA
+#ifdef USART_DMA_TX
+      if (usart->dma_tx != NULL) {
+        DMA_StreamConfig_t *cfg = &usart->dma_tx->handle->config;
+
+        cfg->Direction = DMA_DIR_MEM_TO_PER;
+        cfg->PerInc    = DMA_PINC_DISABLE;
+        cfg->Mode      = DMA_MODE_NORMAL;
+        cfg->FIFOMode  = DMA_FIFOMODE_DISABLE;
+        cfg->MemBurst  = DMA_MBURST_SINGLE;
+        cfg->PerBurst  = DMA_PBURST_SINGLE;
+
+        DMA_Initialize(usart->dma_tx);
+      }
+#endif
+
+#ifdef USART_DMA_RX
+      if (usart->dma_rx != NULL) {
+        DMA_StreamConfig_t *cfg = &usart->dma_rx->handle->config;
+
+        cfg->Direction = DMA_DIR_PER_TO_MEM;
+        cfg->PerInc    = DMA_PINC_DISABLE;
+        cfg->Mode      = DMA_MODE_NORMAL;
+        cfg->FIFOMode  = DMA_FIFOMODE_DISABLE;
+        cfg->MemBurst  = DMA_MBURST_SINGLE;
+        cfg->PerBurst  = DMA_PBURST_SINGLE;
+
+        DMA_Initialize(usart->dma_rx);
+      }
+#endif
+
       // USART peripheral reset
       RCC_ResetPeriph(usart->rcc);
 
@@ -1275,6 +1757,9 @@ int32_t USART_Send(const void *data, uint32_t num, USART_RESOURCES *usart)
 {
   USART_INFO *info = usart->info;
   USART_TRANSFER_INFO *xfer = usart->xfer;
+#ifdef USART_DMA_TX
+  uint32_t mem_inc = DMA_MINC_ENABLE;
+#endif
 
   if ((data == NULL) || (num == 0U)) {
     // Invalid parameters
@@ -1307,10 +1792,46 @@ int32_t USART_Send(const void *data, uint32_t num, USART_RESOURCES *usart)
       if (USART_Receive(&xfer->dump_val, num, usart) == ARM_DRIVER_ERROR_BUSY)
         return ARM_DRIVER_ERROR_BUSY;
     }
+#ifdef USART_DMA_TX
+    else if (xfer->sync_mode == USART_SYNC_MODE_RX) {
+      // Dummy DMA writes (do not increment source address)
+      mem_inc = DMA_MINC_DISABLE;
+    }
+#endif
   }
 
-  // TXE interrupt enable
-  usart->reg->CR1 |= USART_CR1_TXEIE;
+#ifdef USART_DMA_TX
+  if (usart->dma_tx != NULL) {
+    // DMA mode
+    DMA_StreamConfig_t *cfg = &usart->dma_tx->handle->config;
+    uint32_t cr1 = usart->reg->CR1;
+
+    cfg->MemInc = mem_inc;
+
+    if (((cr1 & USART_CR1_PCE) == 0U) && ((cr1 & USART_CR1_M) != 0U)) {
+      // Nine bit data, no parity
+      cfg->MemDataAlign = DMA_MDATAALIGN_HALFWORD;
+      cfg->PerDataAlign = DMA_PDATAALIGN_HALFWORD;
+    }
+    else {
+      cfg->MemDataAlign = DMA_MDATAALIGN_BYTE;
+      cfg->PerDataAlign = DMA_PDATAALIGN_BYTE;
+    }
+
+    DMA_StreamConfig(usart->dma_tx);
+    DMA_StreamEnable(usart->dma_tx, (uint32_t)&usart->reg->DR, (uint32_t)data, num);
+
+    // Clear TC flag and enable DMA transmitter
+    usart->reg->SR &= ~USART_SR_TC;
+    usart->reg->CR3 |= USART_CR3_DMAT;
+  }
+  else
+#endif
+  {
+    // Interrupt mode
+    // TXE interrupt enable
+    usart->reg->CR1 |= USART_CR1_TXEIE;
+  }
 
   return ARM_DRIVER_OK;
 }
@@ -1328,6 +1849,9 @@ int32_t USART_Receive(void *data, uint32_t num, USART_RESOURCES *usart)
 {
   USART_INFO *info = usart->info;
   USART_TRANSFER_INFO *xfer = usart->xfer;
+#ifdef USART_DMA_RX
+  uint32_t mem_inc = DMA_MINC_ENABLE;
+#endif
 
   if ((data == NULL) || (num == 0U)) {
     // Invalid parameters
@@ -1363,8 +1887,43 @@ int32_t USART_Receive(void *data, uint32_t num, USART_RESOURCES *usart)
   // Set RX busy flag
   info->status.rx_busy = 1U;
 
-  // Enable RXNE and IDLE interrupt
-  usart->reg->CR1 |= (USART_CR1_IDLEIE | USART_CR1_RXNEIE);
+#ifdef USART_DMA_RX
+  if (usart->dma_rx != NULL) {
+    // DMA mode
+    DMA_StreamConfig_t *cfg = &usart->dma_rx->handle->config;
+    uint32_t cr1 = usart->reg->CR1;
+
+    if ((info->mode == ARM_USART_MODE_SYNCHRONOUS_MASTER) &&
+        (xfer->sync_mode == USART_SYNC_MODE_TX)) {
+      // Dummy DMA reads (do not increment destination address)
+      mem_inc = DMA_MINC_DISABLE;
+    }
+    cfg->MemInc = mem_inc;
+
+    if (((cr1 & USART_CR1_PCE) == 0U) && ((cr1 & USART_CR1_M) != 0U)) {
+      // Nine bit data, no parity
+      cfg->MemDataAlign = DMA_MDATAALIGN_HALFWORD;
+      cfg->PerDataAlign = DMA_PDATAALIGN_HALFWORD;
+    }
+    else {
+      cfg->MemDataAlign = DMA_MDATAALIGN_BYTE;
+      cfg->PerDataAlign = DMA_PDATAALIGN_BYTE;
+    }
+
+    DMA_StreamConfig(usart->dma_rx);
+    DMA_StreamEnable(usart->dma_rx, (uint32_t)&usart->reg->DR, (uint32_t)data, num);
+
+    // Enable DMA receiver and IDLE interrupt
+    usart->reg->CR3 |= USART_CR3_DMAR;
+    usart->reg->CR1 |= USART_CR1_IDLEIE;
+  }
+  else
+#endif
+  {
+    // Interrupt mode
+    // Enable RXNE and IDLE interrupt
+    usart->reg->CR1 |= (USART_CR1_IDLEIE | USART_CR1_RXNEIE);
+  }
 
   // Synchronous mode
   if (info->mode == ARM_USART_MODE_SYNCHRONOUS_MASTER) {
@@ -1432,6 +1991,12 @@ int32_t USART_Transfer(const void *data_out, void *data_in, uint32_t num, USART_
 static
 uint32_t USART_GetTxCount(USART_RESOURCES *usart)
 {
+#ifdef USART_DMA_TX
+  if ((usart->dma_tx != NULL) && (usart->xfer->send_active != 0U)) {
+    return (usart->xfer->tx_num - usart->dma_tx->stream->NDTR);
+  }
+#endif
+
   return usart->xfer->tx_cnt;
 }
 
@@ -1444,9 +2009,60 @@ uint32_t USART_GetTxCount(USART_RESOURCES *usart)
 static
 uint32_t USART_GetRxCount(USART_RESOURCES *usart)
 {
+#ifdef USART_DMA_RX
+  if ((usart->dma_rx != NULL) && (usart->info->status.rx_busy != 0U)) {
+    return (usart->xfer->rx_num - usart->dma_rx->stream->NDTR);
+  }
+#endif
+
   return usart->xfer->rx_cnt;
 }
 
+/**
+  \fn          void USART_AbortDMA_TX(USART_RESOURCES *usart)
+  \brief       Stop the transmit DMA stream of an active send.
+  \param[in]   usart     Pointer to USART resources
+*/
+static
+void USART_AbortDMA_TX(USART_RESOURCES *usart)
+{
+#ifdef USART_DMA_TX
+  if ((usart->dma_tx != NULL) && (usart->xfer->send_active != 0U)) {
+    // Disable DMA transmitter
+    usart->reg->CR3 &= ~USART_CR3_DMAT;
+
+    // Save number of data sent and stop the stream
+    usart->xfer->tx_cnt = usart->xfer->tx_num - usart->dma_tx->stream->NDTR;
+    DMA_StreamDisable(usart->dma_tx);
+  }
+#else
+  (void)usart;
+#endif
+}
+
+/**
+  \fn          void USART_AbortDMA_RX(USART_RESOURCES *usart)
+  \brief       Stop the receive DMA stream of an active receive.
+  \param[in]   usart     Pointer to USART resources
+*/
+static
+void USART_AbortDMA_RX(USART_RESOURCES *usart)
+{
+#ifdef USART_DMA_RX
+  if ((usart->dma_rx != NULL) && (usart->info->status.rx_busy != 0U)) {
+    // Disable DMA receiver
+    usart->reg->CR3 &= ~USART_CR3_DMAR;
+
+    // Save number of data received and stop the stream
+    usart->xfer->rx_cnt = usart->xfer->rx_num - usart->dma_rx->stream->NDTR;
+    DMA_StreamDisable(usart->dma_rx);
+
+  }
+#else
+  (void)usart;
+#endif
+}
+
 /**
   \fn          int32_t USART_Control(uint32_t control, uint32_t arg, USART_RESOURCES *usart)
   \brief       Control USART Interface.
@@ -1500,6 +2116,7 @@ int32_t USART_Control(uint32_t control, uint32_t arg, USART_RESOURCES *usart)
     case ARM_USART_ABORT_SEND:
       // Disable TX and TC interrupt
       usart->reg->CR1 &= ~(USART_CR1_TXEIE | USART_CR1_TCIE);
+      USART_AbortDMA_TX(usart);
       // Clear break flag
       xfer->break_flag = 0U;
       // Clear Send active flag
@@ -1510,6 +2127,7 @@ int32_t USART_Control(uint32_t control, uint32_t arg, USART_RESOURCES *usart)
     case ARM_USART_ABORT_RECEIVE:
       // Disable RX interrupt
       usart->reg->CR1 &= ~USART_CR1_RXNEIE;
+      USART_AbortDMA_RX(usart);
       // Clear RX busy status
       info->status.rx_busy = 0U;
       return ARM_DRIVER_OK;
@@ -1518,6 +2136,8 @@ int32_t USART_Control(uint32_t control, uint32_t arg, USART_RESOURCES *usart)
     case ARM_USART_ABORT_TRANSFER:
       // Disable TX, TC and RX interrupt
       usart->reg->CR1 &= ~(USART_CR1_TXEIE | USART_CR1_TCIE | USART_CR1_RXNEIE);
+      USART_AbortDMA_TX(usart);
+      USART_AbortDMA_RX(usart);
       // Clear busy statuses
       info->status.rx_busy = 0U;
       xfer->send_active    = 0U;
@@ -2283,6 +2903,90 @@ void USART_IRQHandler(USART_RESOURCES *usart)
   }
 }
 
+#ifdef USART_DMA_TX
+/**
+  \fn          void USART_TX_DMA_Complete(uint32_t event, USART_RESOURCES *usart)
+  \brief       Transmit DMA stream event handler.
+  \param[in]   event     DMA stream events
+  \param[in]   usart     Pointer to USART resources
+*/
+static
+void USART_TX_DMA_Complete(uint32_t event, USART_RESOURCES *usart)
+{
+  USART_INFO *info = usart->info;
+  USART_TRANSFER_INFO *xfer = usart->xfer;
+
+  if ((event & DMA_EVENT_TRANSFER_COMPLETE) != 0U) {
+    // Disable DMA transmitter
+    usart->reg->CR3 &= ~USART_CR3_DMAT;
+
+    xfer->tx_cnt = xfer->tx_num;
+    xfer->send_active = 0U;
+
+    // Enable TC interrupt
+    usart->reg->CR1 |= USART_CR1_TCIE;
+
+    // Set send complete event, in synchronous mode it is signaled by the receiver
+    if ((info->mode != ARM_USART_MODE_SYNCHRONOUS_MASTER) ||
+        ((xfer->sync_mode == USART_SYNC_MODE_TX) &&
+         ((info->flags & USART_FLAG_RX_ENABLED) == 0U))) {
+      if (info->cb_event != NULL) {
+        info->cb_event(ARM_USART_EVENT_SEND_COMPLETE);
+      }
+    }
+  }
+}
+#endif
+
+#ifdef USART_DMA_RX
+/**
+  \fn          void USART_RX_DMA_Complete(uint32_t event, USART_RESOURCES *usart)
+  \brief       Receive DMA stream event handler.
+  \param[in]   event     DMA stream events
+  \param[in]   usart     Pointer to USART resources
+*/
+static
+void USART_RX_DMA_Complete(uint32_t event, USART_RESOURCES *usart)
+{
+  USART_INFO *info = usart->info;
+  USART_TRANSFER_INFO *xfer = usart->xfer;
+  uint32_t val, cb_event;
+
+  if ((event & DMA_EVENT_TRANSFER_COMPLETE) != 0U) {
+    // Disable DMA receiver and IDLE interrupt
+    usart->reg->CR3 &= ~USART_CR3_DMAR;
+    usart->reg->CR1 &= ~USART_CR1_IDLEIE;
+
+    // Detect overflow until the next receive is started
+    usart->reg->CR1 |= USART_CR1_RXNEIE;
+
+    xfer->rx_cnt = xfer->rx_num;
+    info->status.rx_busy = 0U;
+
+    // Set receive transfer complete event
+    cb_event = ARM_USART_EVENT_RECEIVE_COMPLETE;
+    if (info->mode == ARM_USART_MODE_SYNCHRONOUS_MASTER) {
+      val = xfer->sync_mode;
+      xfer->sync_mode = 0U;
+      switch (val) {
+        case USART_SYNC_MODE_TX:
+          cb_event = ARM_USART_EVENT_SEND_COMPLETE;
+          break;
+        case USART_SYNC_MODE_TX_RX:
+          cb_event = ARM_USART_EVENT_TRANSFER_COMPLETE;
+          break;
+        default:
+          break;
+      }
+    }
+
+    if (info->cb_event != NULL) {
+      info->cb_event(cb_event);
+    }
+  }
+}
+#endif
+
 #ifdef USE_USART1
 // USART1 Driver Wrapper functions
 
@@ -2369,6 +3073,32 @@ void USART1_IRQHandler(void)
   USART_IRQHandler(&USART1_Resources);
 }
 
+#ifdef USART1_TX_DMA_Stream
+void USART1_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&USART1_TX_DMA);
+}
+
+static
+void USART1_TX_DMA_Complete(uint32_t event)
+{
+  USART_TX_DMA_Complete(event, &USART1_Resources);
+}
+#endif
+
+#ifdef USART1_RX_DMA_Stream
+void USART1_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&USART1_RX_DMA);
+}
+
+static
+void USART1_RX_DMA_Complete(uint32_t event)
+{
+  USART_RX_DMA_Complete(event, &USART1_Resources);
+}
+#endif
+
 // USART1 Driver Control Block
 ARM_DRIVER_USART Driver_USART1 = {
     USARTx_GetVersion,
@@ -2474,6 +3204,32 @@ void USART2_IRQHandler(void)
   USART_IRQHandler(&USART2_Resources);
 }
 
+#ifdef USART2_TX_DMA_Stream
+void USART2_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&USART2_TX_DMA);
+}
+
+static
+void USART2_TX_DMA_Complete(uint32_t event)
+{
+  USART_TX_DMA_Complete(event, &USART2_Resources);
+}
+#endif
+
+#ifdef USART2_RX_DMA_Stream
+void USART2_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&USART2_RX_DMA);
+}
+
+static
+void USART2_RX_DMA_Complete(uint32_t event)
+{
+  USART_RX_DMA_Complete(event, &USART2_Resources);
+}
+#endif
+
 // USART2 Driver Control Block
 ARM_DRIVER_USART Driver_USART2 = {
     USARTx_GetVersion,
@@ -2579,6 +3335,32 @@ void USART3_IRQHandler(void)
   USART_IRQHandler(&USART3_Resources);
 }
 
+#ifdef USART3_TX_DMA_Stream
+void USART3_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&USART3_TX_DMA);
+}
+
+static
+void USART3_TX_DMA_Complete(uint32_t event)
+{
+  USART_TX_DMA_Complete(event, &USART3_Resources);
+}
+#endif
+
+#ifdef USART3_RX_DMA_Stream
+void USART3_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&USART3_RX_DMA);
+}
+
+static
+void USART3_RX_DMA_Complete(uint32_t event)
+{
+  USART_RX_DMA_Complete(event, &USART3_Resources);
+}
+#endif
+
 // USART3 Driver Control Block
 ARM_DRIVER_USART Driver_USART3 = {
     USARTx_GetVersion,
@@ -2683,6 +3465,32 @@ void UART4_IRQHandler(void)
   USART_IRQHandler(&USART4_Resources);
 }
 
+#ifdef UART4_TX_DMA_Stream
+void UART4_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART4_TX_DMA);
+}
+
+static
+void UART4_TX_DMA_Complete(uint32_t event)
+{
+  USART_TX_DMA_Complete(event, &USART4_Resources);
+}
+#endif
+
+#ifdef UART4_RX_DMA_Stream
+void UART4_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART4_RX_DMA);
+}
+
+static
+void UART4_RX_DMA_Complete(uint32_t event)
+{
+  USART_RX_DMA_Complete(event, &USART4_Resources);
+}
+#endif
+
 // USART4 Driver Control Block
 ARM_DRIVER_USART Driver_USART4 = {
     USARTx_GetVersion,
@@ -2788,6 +3596,32 @@ void UART5_IRQHandler(void)
   USART_IRQHandler(&USART5_Resources);
 }
 
+#ifdef UART5_TX_DMA_Stream
+void UART5_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART5_TX_DMA);
+}
+
+static
+void UART5_TX_DMA_Complete(uint32_t event)
+{
+  USART_TX_DMA_Complete(event, &USART5_Resources);
+}
+#endif
+
+#ifdef UART5_RX_DMA_Stream
+void UART5_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART5_RX_DMA);
+}
+
+static
+void UART5_RX_DMA_Complete(uint32_t event)
+{
+  USART_RX_DMA_Complete(event, &USART5_Resources);
+}
+#endif
+
 // USART5 Driver Control Block
 ARM_DRIVER_USART Driver_USART5 = {
     USARTx_GetVersion,
@@ -2893,6 +3727,32 @@ void USART6_IRQHandler(void)
   USART_IRQHandler(&USART6_Resources);
 }
 
+#ifdef USART6_TX_DMA_Stream
+void USART6_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&USART6_TX_DMA);
+}
+
+static
+void USART6_TX_DMA_Complete(uint32_t event)
+{
+  USART_TX_DMA_Complete(event, &USART6_Resources);
+}
+#endif
+
+#ifdef USART6_RX_DMA_Stream
+void USART6_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&USART6_RX_DMA);
+}
+
+static
+void USART6_RX_DMA_Complete(uint32_t event)
+{
+  USART_RX_DMA_Complete(event, &USART6_Resources);
+}
+#endif
+
 // USART6 Driver Control Block
 ARM_DRIVER_USART Driver_USART6 = {
     USARTx_GetVersion,
@@ -2998,6 +3858,32 @@ void UART7_IRQHandler(void)
   USART_IRQHandler(&USART7_Resources);
 }
 
+#ifdef UART7_TX_DMA_Stream
+void UART7_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART7_TX_DMA);
+}
+
+static
+void UART7_TX_DMA_Complete(uint32_t event)
+{
+  USART_TX_DMA_Complete(event, &USART7_Resources);
+}
+#endif
+
+#ifdef UART7_RX_DMA_Stream
+void UART7_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART7_RX_DMA);
+}
+
+static
+void UART7_RX_DMA_Complete(uint32_t event)
+{
+  USART_RX_DMA_Complete(event, &USART7_Resources);
+}
+#endif
+
 // USART7 Driver Control Block
 ARM_DRIVER_USART Driver_USART7 = {
     USARTx_GetVersion,
@@ -3103,6 +3989,32 @@ void UART8_IRQHandler(void)
   USART_IRQHandler(&USART8_Resources);
 }
 
+#ifdef UART8_TX_DMA_Stream
+void UART8_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART8_TX_DMA);
+}
+
+static
+void UART8_TX_DMA_Complete(uint32_t event)
+{
+  USART_TX_DMA_Complete(event, &USART8_Resources);
+}
+#endif
+
+#ifdef UART8_RX_DMA_Stream
+void UART8_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART8_RX_DMA);
+}
+
+static
+void UART8_RX_DMA_Complete(uint32_t event)
+{
+  USART_RX_DMA_Complete(event, &USART8_Resources);
+}
+#endif
+
 // USART8 Driver Control Block
 ARM_DRIVER_USART Driver_USART8 = {
     USARTx_GetVersion,
@@ -3208,6 +4120,32 @@ void UART9_IRQHandler(void)
   USART_IRQHandler(&USART9_Resources);
 }
 
+#ifdef UART9_TX_DMA_Stream
+void UART9_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART9_TX_DMA);
+}
+
+static
+void UART9_TX_DMA_Complete(uint32_t event)
+{
+  USART_TX_DMA_Complete(event, &USART9_Resources);
+}
+#endif
+
+#ifdef UART9_RX_DMA_Stream
+void UART9_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART9_RX_DMA);
+}
+
+static
+void UART9_RX_DMA_Complete(uint32_t event)
+{
+  USART_RX_DMA_Complete(event, &USART9_Resources);
+}
+#endif
+
 // USART9 Driver Control Block
 ARM_DRIVER_USART Driver_USART9 = {
     USARTx_GetVersion,
@@ -3313,6 +4251,32 @@ void UART10_IRQHandler(void)
   USART_IRQHandler(&USART10_Resources);
 }
 
+#ifdef UART10_TX_DMA_Stream
+void UART10_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART10_TX_DMA);
+}
+
+static
+void UART10_TX_DMA_Complete(uint32_t event)
+{
+  USART_TX_DMA_Complete(event, &USART10_Resources);
+}
+#endif
+
+#ifdef UART10_RX_DMA_Stream
+void UART10_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART10_RX_DMA);
+}
+
+static
+void UART10_RX_DMA_Complete(uint32_t event)
+{
+  USART_RX_DMA_Complete(event, &USART10_Resources);
+}
+#endif
+
 // USART10 Driver Control Block
 ARM_DRIVER_USART Driver_USART10 = {
     USARTx_GetVersion,
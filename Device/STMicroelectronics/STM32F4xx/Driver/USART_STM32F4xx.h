@@ -30,6 +30,7 @@
 #include <asm/stm32f4xx.h>
 #include <Driver/RCC_STM32F4xx.h>
 #include <Driver/GPIO_STM32F4xx.h>
+#include <Driver/DMA_STM32F4xx.h>
 
 #include <Driver/Driver_USART.h>
 
@@ -43,6 +44,21 @@
 #if (RTE_USART1 == 1)
   #define USE_USART1
 
+  #if (RTE_USART1_RX_DMA == 1)
+    #define USART1_RX_DMA_Stream    DMAx_STREAMy(RTE_USART1_RX_DMA_NUMBER, RTE_USART1_RX_DMA_STREAM)
+    #define USART1_RX_DMA_IRQn      DMAx_STREAMy_IRQn(RTE_USART1_RX_DMA_NUMBER, RTE_USART1_RX_DMA_STREAM)
+    #define USART1_RX_DMA_Channel   DMA_CHANNEL_x(RTE_USART1_RX_DMA_CHANNEL)
+    #define USART1_RX_DMA_Priority  DMA_PRIORITY(RTE_USART1_RX_DMA_PRIORITY)
+    #define USART1_RX_DMA_Handler   DMAx_STREAMy_IRQ(RTE_USART1_RX_DMA_NUMBER, RTE_USART1_RX_DMA_STREAM)
+  #endif
+  #if (RTE_USART1_TX_DMA == 1)
+    #define USART1_TX_DMA_Stream    DMAx_STREAMy(RTE_USART1_TX_DMA_NUMBER, RTE_USART1_TX_DMA_STREAM)
+    #define USART1_TX_DMA_IRQn      DMAx_STREAMy_IRQn(RTE_USART1_TX_DMA_NUMBER, RTE_USART1_TX_DMA_STREAM)
+    #define USART1_TX_DMA_Channel   DMA_CHANNEL_x(RTE_USART1_TX_DMA_CHANNEL)
+    #define USART1_TX_DMA_Priority  DMA_PRIORITY(RTE_USART1_TX_DMA_PRIORITY)
+    #define USART1_TX_DMA_Handler   DMAx_STREAMy_IRQ(RTE_USART1_TX_DMA_NUMBER, RTE_USART1_TX_DMA_STREAM)
+  #endif
+
   #if (RTE_USART1_TX == 1)
     #if defined (STM32F410Tx)
       // USART1 TX available on pins: PA15, PB6
@@ -113,6 +129,21 @@
 #if (RTE_USART2 == 1)
   #define USE_USART2
 
+  #if (RTE_USART2_RX_DMA == 1)
+    #define USART2_RX_DMA_Stream    DMAx_STREAMy(RTE_USART2_RX_DMA_NUMBER, RTE_USART2_RX_DMA_STREAM)
+    #define USART2_RX_DMA_IRQn      DMAx_STREAMy_IRQn(RTE_USART2_RX_DMA_NUMBER, RTE_USART2_RX_DMA_STREAM)
+    #define USART2_RX_DMA_Channel   DMA_CHANNEL_x(RTE_USART2_RX_DMA_CHANNEL)
+    #define USART2_RX_DMA_Priority  DMA_PRIORITY(RTE_USART2_RX_DMA_PRIORITY)
+    #define USART2_RX_DMA_Handler   DMAx_STREAMy_IRQ(RTE_USART2_RX_DMA_NUMBER, RTE_USART2_RX_DMA_STREAM)
+  #endif
+  #if (RTE_USART2_TX_DMA == 1)
+    #define USART2_TX_DMA_Stream    DMAx_STREAMy(RTE_USART2_TX_DMA_NUMBER, RTE_USART2_TX_DMA_STREAM)
+    #define USART2_TX_DMA_IRQn      DMAx_STREAMy_IRQn(RTE_USART2_TX_DMA_NUMBER, RTE_USART2_TX_DMA_STREAM)
+    #define USART2_TX_DMA_Channel   DMA_CHANNEL_x(RTE_USART2_TX_DMA_CHANNEL)
+    #define USART2_TX_DMA_Priority  DMA_PRIORITY(RTE_USART2_TX_DMA_PRIORITY)
+    #define USART2_TX_DMA_Handler   DMAx_STREAMy_IRQ(RTE_USART2_TX_DMA_NUMBER, RTE_USART2_TX_DMA_STREAM)
+  #endif
+
   #if (RTE_USART2_TX == 1)
     #if defined(STM32F410Tx) || defined(STM32F410Cx) || defined(STM32F410Rx)
       // USART2 TX available on pin: PA2
@@ -200,6 +231,21 @@
 
   #define USE_USART3
 
+  #if (RTE_USART3_RX_DMA == 1)
+    #define USART3_RX_DMA_Stream    DMAx_STREAMy(RTE_USART3_RX_DMA_NUMBER, RTE_USART3_RX_DMA_STREAM)
+    #define USART3_RX_DMA_IRQn      DMAx_STREAMy_IRQn(RTE_USART3_RX_DMA_NUMBER, RTE_USART3_RX_DMA_STREAM)
+    #define USART3_RX_DMA_Channel   DMA_CHANNEL_x(RTE_USART3_RX_DMA_CHANNEL)
+    #define USART3_RX_DMA_Priority  DMA_PRIORITY(RTE_USART3_RX_DMA_PRIORITY)
+    #define USART3_RX_DMA_Handler   DMAx_STREAMy_IRQ(RTE_USART3_RX_DMA_NUMBER, RTE_USART3_RX_DMA_STREAM)
+  #endif
+  #if (RTE_USART3_TX_DMA == 1)
+    #define USART3_TX_DMA_Stream    DMAx_STREAMy(RTE_USART3_TX_DMA_NUMBER, RTE_USART3_TX_DMA_STREAM)
+    #define USART3_TX_DMA_IRQn      DMAx_STREAMy_IRQn(RTE_USART3_TX_DMA_NUMBER, RTE_USART3_TX_DMA_STREAM)
+    #define USART3_TX_DMA_Channel   DMA_CHANNEL_x(RTE_USART3_TX_DMA_CHANNEL)
+    #define USART3_TX_DMA_Priority  DMA_PRIORITY(RTE_USART3_TX_DMA_PRIORITY)
+    #define USART3_TX_DMA_Handler   DMAx_STREAMy_IRQ(RTE_USART3_TX_DMA_NUMBER, RTE_USART3_TX_DMA_STREAM)
+  #endif
+
   #if (RTE_USART3_TX == 1)
     #define USE_USART3_TX_Pin       1
     #define USART3_TX_GPIO_PORT     RTE_USART3_TX_PORT
@@ -245,6 +291,21 @@
 
   #define USE_UART4
 
+  #if (RTE_UART4_RX_DMA == 1)
+    #define UART4_RX_DMA_Stream     DMAx_STREAMy(RTE_UART4_RX_DMA_NUMBER, RTE_UART4_RX_DMA_STREAM)
+    #define UART4_RX_DMA_IRQn       DMAx_STREAMy_IRQn(RTE_UART4_RX_DMA_NUMBER, RTE_UART4_RX_DMA_STREAM)
+    #define UART4_RX_DMA_Channel    DMA_CHANNEL_x(RTE_UART4_RX_DMA_CHANNEL)
+    #define UART4_RX_DMA_Priority   DMA_PRIORITY(RTE_UART4_RX_DMA_PRIORITY)
+    #define UART4_RX_DMA_Handler    DMAx_STREAMy_IRQ(RTE_UART4_RX_DMA_NUMBER, RTE_UART4_RX_DMA_STREAM)
+  #endif
+  #if (RTE_UART4_TX_DMA == 1)
+    #define UART4_TX_DMA_Stream     DMAx_STREAMy(RTE_UART4_TX_DMA_NUMBER, RTE_UART4_TX_DMA_STREAM)
+    #define UART4_TX_DMA_IRQn       DMAx_STREAMy_IRQn(RTE_UART4_TX_DMA_NUMBER, RTE_UART4_TX_DMA_STREAM)
+    #define UART4_TX_DMA_Channel    DMA_CHANNEL_x(RTE_UART4_TX_DMA_CHANNEL)
+    #define UART4_TX_DMA_Priority   DMA_PRIORITY(RTE_UART4_TX_DMA_PRIORITY)
+    #define UART4_TX_DMA_Handler    DMAx_STREAMy_IRQ(RTE_UART4_TX_DMA_NUMBER, RTE_UART4_TX_DMA_STREAM)
+  #endif
+
   #if (RTE_UART4_TX == 1)
     #if defined (STM32F413xx) || defined (STM32F423xx)
       // UART4 TX available on pins: PA0, PD10, PA12, PD1
@@ -288,6 +349,21 @@
 
   #define USE_UART5
 
+  #if (RTE_UART5_RX_DMA == 1)
+    #define UART5_RX_DMA_Stream     DMAx_STREAMy(RTE_UART5_RX_DMA_NUMBER, RTE_UART5_RX_DMA_STREAM)
+    #define UART5_RX_DMA_IRQn       DMAx_STREAMy_IRQn(RTE_UART5_RX_DMA_NUMBER, RTE_UART5_RX_DMA_STREAM)
+    #define UART5_RX_DMA_Channel    DMA_CHANNEL_x(RTE_UART5_RX_DMA_CHANNEL)
+    #define UART5_RX_DMA_Priority   DMA_PRIORITY(RTE_UART5_RX_DMA_PRIORITY)
+    #define UART5_RX_DMA_Handler    DMAx_STREAMy_IRQ(RTE_UART5_RX_DMA_NUMBER, RTE_UART5_RX_DMA_STREAM)
+  #endif
+  #if (RTE_UART5_TX_DMA == 1)
+    #define UART5_TX_DMA_Stream     DMAx_STREAMy(RTE_UART5_TX_DMA_NUMBER, RTE_UART5_TX_DMA_STREAM)
+    #define UART5_TX_DMA_IRQn       DMAx_STREAMy_IRQn(RTE_UART5_TX_DMA_NUMBER, RTE_UART5_TX_DMA_STREAM)
+    #define UART5_TX_DMA_Channel    DMA_CHANNEL_x(RTE_UART5_TX_DMA_CHANNEL)
+    #define UART5_TX_DMA_Priority   DMA_PRIORITY(RTE_UART5_TX_DMA_PRIORITY)
+    #define UART5_TX_DMA_Handler    DMAx_STREAMy_IRQ(RTE_UART5_TX_DMA_NUMBER, RTE_UART5_TX_DMA_STREAM)
+  #endif
+
   #if (RTE_UART5_TX == 1)
     #if !defined (STM32F413xx) && !defined (STM32F423xx)
       // UART5 TX available on pins: PC12
@@ -326,6 +402,21 @@
 #if (RTE_USART6 == 1)
   #define USE_USART6
 
+  #if (RTE_USART6_RX_DMA == 1)
+    #define USART6_RX_DMA_Stream    DMAx_STREAMy(RTE_USART6_RX_DMA_NUMBER, RTE_USART6_RX_DMA_STREAM)
+    #define USART6_RX_DMA_IRQn      DMAx_STREAMy_IRQn(RTE_USART6_RX_DMA_NUMBER, RTE_USART6_RX_DMA_STREAM)
+    #define USART6_RX_DMA_Channel   DMA_CHANNEL_x(RTE_USART6_RX_DMA_CHANNEL)
+    #define USART6_RX_DMA_Priority  DMA_PRIORITY(RTE_USART6_RX_DMA_PRIORITY)
+    #define USART6_RX_DMA_Handler   DMAx_STREAMy_IRQ(RTE_USART6_RX_DMA_NUMBER, RTE_USART6_RX_DMA_STREAM)
+  #endif
+  #if (RTE_USART6_TX_DMA == 1)
+    #define USART6_TX_DMA_Stream    DMAx_STREAMy(RTE_USART6_TX_DMA_NUMBER, RTE_USART6_TX_DMA_STREAM)
+    #define USART6_TX_DMA_IRQn      DMAx_STREAMy_IRQn(RTE_USART6_TX_DMA_NUMBER, RTE_USART6_TX_DMA_STREAM)
+    #define USART6_TX_DMA_Channel   DMA_CHANNEL_x(RTE_USART6_TX_DMA_CHANNEL)
+    #define USART6_TX_DMA_Priority  DMA_PRIORITY(RTE_USART6_TX_DMA_PRIORITY)
+    #define USART6_TX_DMA_Handler   DMAx_STREAMy_IRQ(RTE_USART6_TX_DMA_NUMBER, RTE_USART6_TX_DMA_STREAM)
+  #endif
+
   #ifndef USART6
     #error "USART6 not available for selected device!"
   #endif
@@ -448,6 +539,21 @@
 
   #define USE_UART7
 
+  #if (RTE_UART7_RX_DMA == 1)
+    #define UART7_RX_DMA_Stream     DMAx_STREAMy(RTE_UART7_RX_DMA_NUMBER, RTE_UART7_RX_DMA_STREAM)
+    #define UART7_RX_DMA_IRQn       DMAx_STREAMy_IRQn(RTE_UART7_RX_DMA_NUMBER, RTE_UART7_RX_DMA_STREAM)
+    #define UART7_RX_DMA_Channel    DMA_CHANNEL_x(RTE_UART7_RX_DMA_CHANNEL)
+    #define UART7_RX_DMA_Priority   DMA_PRIORITY(RTE_UART7_RX_DMA_PRIORITY)
+    #define UART7_RX_DMA_Handler    DMAx_STREAMy_IRQ(RTE_UART7_RX_DMA_NUMBER, RTE_UART7_RX_DMA_STREAM)
+  #endif
+  #if (RTE_UART7_TX_DMA == 1)
+    #define UART7_TX_DMA_Stream     DMAx_STREAMy(RTE_UART7_TX_DMA_NUMBER, RTE_UART7_TX_DMA_STREAM)
+    #define UART7_TX_DMA_IRQn       DMAx_STREAMy_IRQn(RTE_UART7_TX_DMA_NUMBER, RTE_UART7_TX_DMA_STREAM)
+    #define UART7_TX_DMA_Channel    DMA_CHANNEL_x(RTE_UART7_TX_DMA_CHANNEL)
+    #define UART7_TX_DMA_Priority   DMA_PRIORITY(RTE_UART7_TX_DMA_PRIORITY)
+    #define UART7_TX_DMA_Handler    DMAx_STREAMy_IRQ(RTE_UART7_TX_DMA_NUMBER, RTE_UART7_TX_DMA_STREAM)
+  #endif
+
   #if (RTE_UART7_TX == 1)
     #if !defined (STM32F413xx) && !defined (STM32F423xx)
       // UART7 TX available on pins: PF7, PE8
@@ -486,6 +592,21 @@
 
   #define USE_UART8
 
+  #if (RTE_UART8_RX_DMA == 1)
+    #define UART8_RX_DMA_Stream     DMAx_STREAMy(RTE_UART8_RX_DMA_NUMBER, RTE_UART8_RX_DMA_STREAM)
+    #define UART8_RX_DMA_IRQn       DMAx_STREAMy_IRQn(RTE_UART8_RX_DMA_NUMBER, RTE_UART8_RX_DMA_STREAM)
+    #define UART8_RX_DMA_Channel    DMA_CHANNEL_x(RTE_UART8_RX_DMA_CHANNEL)
+    #define UART8_RX_DMA_Priority   DMA_PRIORITY(RTE_UART8_RX_DMA_PRIORITY)
+    #define UART8_RX_DMA_Handler    DMAx_STREAMy_IRQ(RTE_UART8_RX_DMA_NUMBER, RTE_UART8_RX_DMA_STREAM)
+  #endif
+  #if (RTE_UART8_TX_DMA == 1)
+    #define UART8_TX_DMA_Stream     DMAx_STREAMy(RTE_UART8_TX_DMA_NUMBER, RTE_UART8_TX_DMA_STREAM)
+    #define UART8_TX_DMA_IRQn       DMAx_STREAMy_IRQn(RTE_UART8_TX_DMA_NUMBER, RTE_UART8_TX_DMA_STREAM)
+    #define UART8_TX_DMA_Channel    DMA_CHANNEL_x(RTE_UART8_TX_DMA_CHANNEL)
+    #define UART8_TX_DMA_Priority   DMA_PRIORITY(RTE_UART8_TX_DMA_PRIORITY)
+    #define UART8_TX_DMA_Handler    DMAx_STREAMy_IRQ(RTE_UART8_TX_DMA_NUMBER, RTE_UART8_TX_DMA_STREAM)
+  #endif
+
   #if (RTE_UART8_TX == 1)
     #if !defined (STM32F413xx) && !defined (STM32F423xx)
       // UART8 TX available on pins: PE1
@@ -529,6 +650,21 @@
 
   #define USE_UART9
 
+  #if (RTE_UART9_RX_DMA == 1)
+    #define UART9_RX_DMA_Stream     DMAx_STREAMy(RTE_UART9_RX_DMA_NUMBER, RTE_UART9_RX_DMA_STREAM)
+    #define UART9_RX_DMA_IRQn       DMAx_STREAMy_IRQn(RTE_UART9_RX_DMA_NUMBER, RTE_UART9_RX_DMA_STREAM)
+    #define UART9_RX_DMA_Channel    DMA_CHANNEL_x(RTE_UART9_RX_DMA_CHANNEL)
+    #define UART9_RX_DMA_Priority   DMA_PRIORITY(RTE_UART9_RX_DMA_PRIORITY)
+    #define UART9_RX_DMA_Handler    DMAx_STREAMy_IRQ(RTE_UART9_RX_DMA_NUMBER, RTE_UART9_RX_DMA_STREAM)
+  #endif
+  #if (RTE_UART9_TX_DMA == 1)
+    #define UART9_TX_DMA_Stream     DMAx_STREAMy(RTE_UART9_TX_DMA_NUMBER, RTE_UART9_TX_DMA_STREAM)
+    #define UART9_TX_DMA_IRQn       DMAx_STREAMy_IRQn(RTE_UART9_TX_DMA_NUMBER, RTE_UART9_TX_DMA_STREAM)
+    #define UART9_TX_DMA_Channel    DMA_CHANNEL_x(RTE_UART9_TX_DMA_CHANNEL)
+    #define UART9_TX_DMA_Priority   DMA_PRIORITY(RTE_UART9_TX_DMA_PRIORITY)
+    #define UART9_TX_DMA_Handler    DMAx_STREAMy_IRQ(RTE_UART9_TX_DMA_NUMBER, RTE_UART9_TX_DMA_STREAM)
+  #endif
+
   #if (RTE_UART9_TX == 1)
     #define USE_UART9_TX_Pin        1
     #define UART9_TX_GPIO_PORT      RTE_UART9_TX_PORT
@@ -558,6 +694,21 @@
 
   #define USE_UART10
 
+  #if (RTE_UART10_RX_DMA == 1)
+    #define UART10_RX_DMA_Stream    DMAx_STREAMy(RTE_UART10_RX_DMA_NUMBER, RTE_UART10_RX_DMA_STREAM)
+    #define UART10_RX_DMA_IRQn      DMAx_STREAMy_IRQn(RTE_UART10_RX_DMA_NUMBER, RTE_UART10_RX_DMA_STREAM)
+    #define UART10_RX_DMA_Channel   DMA_CHANNEL_x(RTE_UART10_RX_DMA_CHANNEL)
+    #define UART10_RX_DMA_Priority  DMA_PRIORITY(RTE_UART10_RX_DMA_PRIORITY)
+    #define UART10_RX_DMA_Handler   DMAx_STREAMy_IRQ(RTE_UART10_RX_DMA_NUMBER, RTE_UART10_RX_DMA_STREAM)
+  #endif
+  #if (RTE_UART10_TX_DMA == 1)
+    #define UART10_TX_DMA_Stream    DMAx_STREAMy(RTE_UART10_TX_DMA_NUMBER, RTE_UART10_TX_DMA_STREAM)
+    #define UART10_TX_DMA_IRQn      DMAx_STREAMy_IRQn(RTE_UART10_TX_DMA_NUMBER, RTE_UART10_TX_DMA_STREAM)
+    #define UART10_TX_DMA_Channel   DMA_CHANNEL_x(RTE_UART10_TX_DMA_CHANNEL)
+    #define UART10_TX_DMA_Priority  DMA_PRIORITY(RTE_UART10_TX_DMA_PRIORITY)
+    #define UART10_TX_DMA_Handler   DMAx_STREAMy_IRQ(RTE_UART10_TX_DMA_NUMBER, RTE_UART10_TX_DMA_STREAM)
+  #endif
+
   #if (RTE_UART10_TX == 1)
     #define USE_UART10_TX_Pin       1
     #define UART10_TX_GPIO_PORT     RTE_UART10_TX_PORT
@@ -573,6 +724,33 @@
   #endif
 #endif
 
+// USART DMA usage
+#if ((defined(USE_USART1) && defined(USART1_RX_DMA_Handler)) || \
+     (defined(USE_USART2) && defined(USART2_RX_DMA_Handler)) || \
+     (defined(USE_USART3) && defined(USART3_RX_DMA_Handler)) || \
+     (defined(USE_UART4) && defined(UART4_RX_DMA_Handler))   || \
+     (defined(USE_UART5) && defined(UART5_RX_DMA_Handler))   || \
+     (defined(USE_USART6) && defined(USART6_RX_DMA_Handler)) || \
+     (defined(USE_UART7) && defined(UART7_RX_DMA_Handler))   || \
+     (defined(USE_UART8) && defined(UART8_RX_DMA_Handler))   || \
+     (defined(USE_UART9) && defined(UART9_RX_DMA_Handler))   || \
+     (defined(USE_UART10) && defined(UART10_RX_DMA_Handler)))
+  #define USART_DMA_RX
+#endif
+
+#if ((defined(USE_USART1) && defined(USART1_TX_DMA_Handler)) || \
+     (defined(USE_USART2) && defined(USART2_TX_DMA_Handler)) || \
+     (defined(USE_USART3) && defined(USART3_TX_DMA_Handler)) || \
+     (defined(USE_UART4) && defined(UART4_TX_DMA_Handler))   || \
+     (defined(USE_UART5) && defined(UART5_TX_DMA_Handler))   || \
+     (defined(USE_USART6) && defined(USART6_TX_DMA_Handler)) || \
+     (defined(USE_UART7) && defined(UART7_TX_DMA_Handler))   || \
+     (defined(USE_UART8) && defined(UART8_TX_DMA_Handler))   || \
+     (defined(USE_UART9) && defined(UART9_TX_DMA_Handler))   || \
+     (defined(USE_UART10) && defined(UART10_TX_DMA_Handler)))
+  #define USART_DMA_TX
+#endif
+
 // USART BRR macro
 #define USART_DIVIDER(_PCLK_, _BAUD_)           (((_PCLK_)*25)/(4*(_BAUD_)))
 #define USART_DIVIDER_MANTISA(_PCLK_, _BAUD_)     (USART_DIVIDER((_PCLK_), (_BAUD_))/100)
@@ -652,6 +830,8 @@ typedef struct USART_RESOURCES_s {
   USART_IO                io;                  // USART Input/Output pins
   IRQn_Type               irq_num;             // USART IRQ Number
   RCC_Periph_t            rcc;                 // RCC Clock/Reset registers
+  DMA_Resources_t        *dma_tx;              // Transmit stream resources
+  DMA_Resources_t        *dma_rx;              // Receive stream resources
   USART_INFO             *info;                // Run-Time Information
   USART_TRANSFER_INFO    *xfer;                // USART transfer information
 } const USART_RESOURCES;
@@ -167,6 +167,21 @@ void EXTI_LineMapping(EXTI_Line_t line, EXTI_Port_t port);
  */
 void EXTI_SoftwareRequest(EXTI_Line_t line);
 
+/**
+ * @fn          void EXTI_InterruptMask(EXTI_Line_t line)
+ * @brief       Mask the interrupt request of a single line, other lines of a
+ *              shared vector stay enabled.
+ * @param[in]   line
+ */
+void EXTI_InterruptMask(EXTI_Line_t line);
+
+/**
+ * @fn          void EXTI_InterruptUnmask(EXTI_Line_t line)
+ * @brief       Unmask the interrupt request of a single line.
+ * @param[in]   line
+ */
+void EXTI_InterruptUnmask(EXTI_Line_t line);
+
 #endif /* EXTI_STM32F4XX_H_ */
 
 /* ----------------------------- End of file ---------------------------------*/
@@ -0,0 +1,336 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: CRC unit port for STMicroelectronics STM32F7xx
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <asm/stm32f7xx.h>
+#include <Driver/RCC_STM32F7xx.h>
+#include <Driver/DMA_STM32F7xx.h>
+#include <CRC/crc.h>
+
+#include <device_config.h>
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#if (DEV_CRC_DMA == 1)
+  #if (DEV_CRC_DMA_NUMBER != 2)
+    #error "CRC DMA requires DMA2 (memory to memory transfer)!"
+  #endif
+
+  #define CRC_DMA_Stream            DMAx_STREAMy(DEV_CRC_DMA_NUMBER, DEV_CRC_DMA_STREAM)
+  #define CRC_DMA_IRQn              DMAx_STREAMy_IRQn(DEV_CRC_DMA_NUMBER, DEV_CRC_DMA_STREAM)
+  #define CRC_DMA_Channel           DMA_CHANNEL_x(DEV_CRC_DMA_CHANNEL)
+  #define CRC_DMA_Priority          DMA_PRIORITY(DEV_CRC_DMA_PRIORITY)
+
+  /* Data items per DMA transfer */
+  #define CRC_DMA_MAX_NUM           (0xFFFFU)
+#endif
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static volatile uint32_t busy;
+
+#if (DEV_CRC_DMA == 1)
+static void CRC_DMA_Callback(uint32_t event, const void *param);
+
+static DMA_Handle_t CRC_DMA_Handle;
+static const DMA_Resources_t CRC_DMA = {
+  &CRC_DMA_Handle,
+  CRC_DMA_Stream,
+  CRC_DMA_Channel,
+  CRC_DMA_Priority,
+  CRC_DMA_Callback,
+  NULL,
+  DEV_CRC_DMA_INT_PRIORITY,
+  CRC_DMA_IRQn,
+};
+
+static struct {
+  CRC_PortCallback_t cb;
+  uint32_t           addr;          // Next source address
+  uint32_t           num;           // Data items left
+  uint32_t           size;          // Data item size in bytes
+  uint32_t           mask;          // Result mask
+  volatile int32_t   status;
+} dma_xfer;
+#endif
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+/**
+ * @fn          bool UnitAcquire(void)
+ * @brief       Take the CRC unit without blocking, also from interrupts.
+ * @return      true - unit taken, false - unit in use.
+ */
+static bool UnitAcquire(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  bool     ret     = false;
+
+  __disable_irq();
+  if (busy == 0U) {
+    busy = 1U;
+    ret  = true;
+  }
+  __set_PRIMASK(primask);
+
+  return (ret);
+}
+
+/**
+ * @fn          uint32_t ResultMask(uint32_t width)
+ * @brief       Mask of the significant bits of the data register.
+ * @param[in]   width  Width in bits
+ * @return      Mask value.
+ */
+static uint32_t ResultMask(uint32_t width)
+{
+  return ((width == 32U) ? 0xFFFFFFFFUL : ((1UL << width) - 1U));
+}
+
+#if (DEV_CRC_DMA == 1)
+/**
+ * @fn          void CRC_DMA_Next(void)
+ * @brief       Start the next DMA transfer of the block.
+ */
+static void CRC_DMA_Next(void)
+{
+  uint32_t num = dma_xfer.num;
+
+  if (num > CRC_DMA_MAX_NUM) {
+    num = CRC_DMA_MAX_NUM;
+  }
+
+  DMA_Start(&CRC_DMA, dma_xfer.addr, (uint32_t)&CRC->DR, num);
+
+  dma_xfer.addr += num * dma_xfer.size;
+  dma_xfer.num  -= num;
+}
+
+/**
+ * @fn          void CRC_DMA_Callback(uint32_t event, const void *param)
+ * @brief       DMA stream event callback.
+ * @param[in]   event  DMA_EVENT_xxx
+ * @param[in]   param  Not used
+ */
+static void CRC_DMA_Callback(uint32_t event, const void *param)
+{
+  (void)param;
+
+  if ((event & DMA_EVENT_TRANSFER_ERROR) != 0U) {
+    dma_xfer.status = CRC_ERROR;
+    dma_xfer.cb(CRC_ERROR);
+  }
+  else if ((event & DMA_EVENT_TRANSFER_COMPLETE) != 0U) {
+    if (dma_xfer.num != 0U) {
+      CRC_DMA_Next();
+    }
+    else {
+      dma_xfer.status = CRC_OK;
+      dma_xfer.cb(CRC_OK);
+    }
+  }
+}
+#endif
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+/**
+ * @fn          int32_t CRC_PortInitialize(void)
+ * @brief       Initialize the CRC unit.
+ * @return      CRC_OK
+ */
+int32_t CRC_PortInitialize(void)
+{
+  RCC_EnablePeriph(RCC_PERIPH_CRC);
+  busy = 0U;
+
+#if (DEV_CRC_DMA == 1)
+  DMA_Initialize(&CRC_DMA);
+  /* DMA_Start enables only the transfer complete interrupt */
+  CRC_DMA.stream->CR |= DMA_SxCR_TEIE;
+#endif
+
+  return (CRC_OK);
+}
+
+/**
+ * @fn          int32_t CRC_PortCalc(const CRC_Param_t *param, uint32_t *reg, const void *data, uint32_t len, CRC_PortCallback_t cb)
+ * @brief       Run a block through the CRC unit. The polynomial and register
+ *              are programmed for each block, reflected input and output
+ *              are supported for 32-bit algorithms only.
+ * @param[in]   param  CRC algorithm
+ * @param[in,out] reg  Register value
+ * @param[in]   data   Pointer to the data, word aligned
+ * @param[in]   len    Data length in bytes, multiple of four
+ * @param[in]   cb     Completion callback, NULL - feed the data by the CPU
+ * @return      CRC_OK, CRC_PENDING, CRC_ERROR_BUSY or CRC_ERROR_UNSUPPORTED.
+ */
+int32_t CRC_PortCalc(const CRC_Param_t *param, uint32_t *reg, const void *data, uint32_t len, CRC_PortCallback_t cb)
+{
+  const uint32_t *p = data;
+  uint32_t        n = len / 4U;
+  uint32_t        cr;
+
+  switch (param->width) {
+    case 32U: cr = 0U;                break;
+    case 16U: cr = CRC_CR_POLYSIZE_0; break;
+    case 8U:  cr = CRC_CR_POLYSIZE_1; break;
+    case 7U:  cr = CRC_CR_POLYSIZE;   break;
+    default:
+      return (CRC_ERROR_UNSUPPORTED);
+  }
+
+  if (param->reflect != 0U) {
+    /* The data register of the unit is 32 bits wide, the reflected register of
+       narrower algorithms would have to be shifted */
+    if (param->width != 32U) {
+      return (CRC_ERROR_UNSUPPORTED);
+    }
+    cr |= CRC_CR_REV_IN | CRC_CR_REV_OUT;
+  }
+
+  if (n == 0U) {
+    return (CRC_OK);
+  }
+
+  if (!UnitAcquire()) {
+    return (CRC_ERROR_BUSY);
+  }
+
+  CRC->POL  = param->poly;
+  CRC->INIT = (param->reflect != 0U) ? __RBIT(*reg) : *reg;
+  CRC->CR   = cr | CRC_CR_RESET;
+
+#if (DEV_CRC_DMA == 1)
+  if ((cb != NULL) && (__get_IPSR() == 0U)) {
+    DMA_StreamConfig_t *cfg = &CRC_DMA.handle->config;
+
+    /*
+     * Memory to memory transfer, the stream reads the block through the
+     * peripheral port and writes the data register through the memory port.
+     * Reflected data is reversed by the unit, other data is written bytewise.
+     */
+    cfg->Direction     = DMA_DIR_MEM_TO_MEM;
+    cfg->PerInc        = DMA_PINC_ENABLE;
+    cfg->MemInc        = DMA_MINC_DISABLE;
+    cfg->Mode          = DMA_MODE_NORMAL;
+    cfg->FIFOMode      = DMA_FIFOMODE_ENABLE;
+    cfg->FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+    cfg->MemBurst      = DMA_MBURST_SINGLE;
+    cfg->PerBurst      = DMA_PBURST_SINGLE;
+
+    if (param->reflect != 0U) {
+      cfg->PerDataAlign = DMA_PDATAALIGN_WORD;
+      cfg->MemDataAlign = DMA_MDATAALIGN_WORD;
+      dma_xfer.size     = 4U;
+      dma_xfer.num      = n;
+    }
+    else {
+      cfg->PerDataAlign = DMA_PDATAALIGN_BYTE;
+      cfg->MemDataAlign = DMA_MDATAALIGN_BYTE;
+      dma_xfer.size     = 1U;
+      dma_xfer.num      = len;
+    }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache_by_Addr((uint32_t *)((uint32_t)data & ~31U),
+                            (int32_t)(len + ((uint32_t)data & 31U)));
+#endif
+
+    dma_xfer.cb     = cb;
+    dma_xfer.addr   = (uint32_t)data;
+    dma_xfer.mask   = ResultMask(param->width);
+    dma_xfer.status = CRC_PENDING;
+
+    DMA_Config(&CRC_DMA);
+    CRC_DMA_Next();
+
+    return (CRC_PENDING);
+  }
+#else
+  (void)cb;
+#endif
+
+  if (param->reflect != 0U) {
+    do {
+      CRC->DR = *p++;
+    } while (--n != 0U);
+  }
+  else {
+    /* The unit shifts words in MSB first */
+    do {
+      CRC->DR = __REV(*p++);
+    } while (--n != 0U);
+  }
+
+  *reg = CRC->DR & ResultMask(param->width);
+
+  busy = 0U;
+
+  return (CRC_OK);
+}
+
+/**
+ * @fn          int32_t CRC_PortFinish(uint32_t *reg)
+ * @brief       Read the result of a DMA fed block and release the CRC unit.
+ * @param[out]  reg  Register value, unchanged on error
+ * @return      CRC_OK or CRC_ERROR.
+ */
+int32_t CRC_PortFinish(uint32_t *reg)
+{
+#if (DEV_CRC_DMA == 1)
+  int32_t status = dma_xfer.status;
+
+  if (status == CRC_PENDING) {
+    return (CRC_ERROR);
+  }
+
+  if (status == CRC_OK) {
+    *reg = CRC->DR & dma_xfer.mask;
+  }
+  else {
+    status = CRC_ERROR;
+  }
+
+  dma_xfer.status = CRC_ERROR;
+  busy = 0U;
+
+  return (status);
+#else
+  (void)reg;
+
+  return (CRC_ERROR);
+#endif
+}
+
+/* ----------------------------- End of file ---------------------------------*/
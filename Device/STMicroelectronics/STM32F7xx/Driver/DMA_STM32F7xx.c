@@ -311,11 +311,13 @@ static void DMA_IRQ_Handle(DMA_Resources_t *res)
       /* Clear Transfer Complete Interrupt flag */
       dma->IFCR = DMA_FLAG_TCIF << handle->bit_offset;
 
-      if (!(cr & DMA_SxCR_CIRC))
+      /* Circular transfer keeps running until aborted */
+      if (!(cr & DMA_SxCR_CIRC)) {
         stream->CR &= ~DMA_SxCR_TCIE;
 
-      /* Change the DMA state */
-      handle->state = DMA_STATE_READY;
+        /* Change the DMA state */
+        handle->state = DMA_STATE_READY;
+      }
 
       event |= DMA_EVENT_TRANSFER_COMPLETE;
     }
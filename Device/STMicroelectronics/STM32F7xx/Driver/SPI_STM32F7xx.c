@@ -686,6 +686,201 @@ int32_t CalcPrescalerValue(SPI_RESOURCES *spi, uint32_t freq)
   return (val);
 }
 
+/**
+ * @fn          bool SPI_PackFrames(uint32_t cr2, uint32_t num)
+ * @brief       Check if two 8-bit frames can be moved with one 16-bit DMA access.
+ * @param[in]   cr2  Value of the control register 2
+ * @param[in]   num  Number of data frames
+ * @return      true - data packing is used
+ */
+static
+bool SPI_PackFrames(uint32_t cr2, uint32_t num)
+{
+  return ((((cr2 & SPI_CR2_DS) >> SPI_CR2_DS_Pos) <= 7U) && ((num & 1U) == 0U));
+}
+
+/**
+ * @fn          uint32_t SPI_RxThreshold(uint32_t cr2, bool pack)
+ * @brief       Select the RX FIFO threshold of 8-bit frames.
+ * @param[in]   cr2   Value of the control register 2
+ * @param[in]   pack  RXNE event on 16 bits, two frames are read at once
+ * @return      Value of the control register 2
+ */
+static
+uint32_t SPI_RxThreshold(uint32_t cr2, bool pack)
+{
+  cr2 &= ~SPI_CR2_FRXTH;
+
+  if ((((cr2 & SPI_CR2_DS) >> SPI_CR2_DS_Pos) <= 7U) && !pack) {
+    /* RXNE event on 8 bits */
+    cr2 |= SPI_CR2_FRXTH;
+  }
+
+  return (cr2);
+}
+
+#if defined(SPI_DMA_RX) || defined(SPI_DMA_TX)
+/**
+ * @fn          void SPI_DMA_Start(const DMA_Resources_t *dma, SPI_TypeDef *reg, uint32_t mem_addr, bool mem_inc, uint32_t num, bool pack)
+ * @brief       Configure and start a DMA stream on the data register.
+ * @param[in]   dma       Pointer to DMA resources
+ * @param[in]   reg       Pointer to SPI registers
+ * @param[in]   mem_addr  Memory address
+ * @param[in]   mem_inc   Memory address increment
+ * @param[in]   num       Number of data frames
+ * @param[in]   pack      Two 8-bit frames per 16-bit data register access
+ */
+static
+void SPI_DMA_Start(const DMA_Resources_t *dma, SPI_TypeDef *reg, uint32_t mem_addr, bool mem_inc, uint32_t num, bool pack)
+{
+  DMA_StreamConfig_t *cfg = &dma->handle->config;
+  uint32_t size;
+
+  cfg->PerInc   = DMA_PINC_DISABLE;
+  cfg->PerBurst = DMA_PBURST_SINGLE;
+
+  if (pack || (((reg->CR2 & SPI_CR2_DS) >> SPI_CR2_DS_Pos) > 7U)) {
+    /* 16 - bit data register access */
+    cfg->PerDataAlign = DMA_PDATAALIGN_HALFWORD;
+    cfg->MemDataAlign = DMA_MDATAALIGN_HALFWORD;
+    if (pack) {
+      num /= 2U;
+    }
+    size = num * 2U;
+  }
+  else {
+    /* 8 - bit data register access */
+    cfg->PerDataAlign = DMA_PDATAALIGN_BYTE;
+    cfg->MemDataAlign = DMA_MDATAALIGN_BYTE;
+    size = num;
+  }
+
+  if (mem_inc && (size >= SPI_DMA_BURST_MIN) && ((mem_addr & 0xFU) == 0U) && ((size & 0xFU) == 0U)) {
+    /* FIFO mode, the memory port moves the full FIFO in one burst of four words */
+    cfg->MemInc        = DMA_MINC_ENABLE;
+    cfg->MemDataAlign  = DMA_MDATAALIGN_WORD;
+    cfg->FIFOMode      = DMA_FIFOMODE_ENABLE;
+    cfg->FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+    cfg->MemBurst      = DMA_MBURST_INC4;
+  }
+  else if (mem_inc && ((mem_addr & ((size / num) - 1U)) != 0U)) {
+    /* 16 - bit access to an unaligned buffer, the FIFO splits it into bytes */
+    cfg->MemInc        = DMA_MINC_ENABLE;
+    cfg->MemDataAlign  = DMA_MDATAALIGN_BYTE;
+    cfg->FIFOMode      = DMA_FIFOMODE_ENABLE;
+    cfg->FIFOThreshold = DMA_FIFO_THRESHOLD_HALFFULL;
+    cfg->MemBurst      = DMA_MBURST_SINGLE;
+  }
+  else {
+    /* Direct mode */
+    cfg->MemInc   = mem_inc ? DMA_MINC_ENABLE : DMA_MINC_DISABLE;
+    cfg->FIFOMode = DMA_FIFOMODE_DISABLE;
+    cfg->MemBurst = DMA_MBURST_SINGLE;
+  }
+
+  /* Initialize and start DMA Stream */
+  DMA_Config(dma);
+  DMA_Start(dma, (uint32_t)&reg->DR, mem_addr, num);
+}
+#endif
+
+/**
+ * @fn          void SPI_SegmentStart(SPI_RESOURCES *spi)
+ * @brief       Start the current segment of a transfer list.
+ * @param[in]   spi  Pointer to SPI resources
+ */
+static
+void SPI_SegmentStart(SPI_RESOURCES *spi)
+{
+  SPI_TRANSFER_INFO *xfer = spi->xfer;
+  const SPI_SEGMENT *seg  = xfer->segment;
+  SPI_TypeDef       *reg  = spi->reg;
+  uint32_t           cr2;
+
+  if ((seg->cs & SPI_SEGMENT_CS_ASSERT) != 0U) {
+    GPIO_PinWrite((GPIO_PORT_t)seg->cs_port, (GPIO_PIN_t)seg->cs_pin, GPIO_PIN_OUT_LOW);
+  }
+
+  /* Save transfer info */
+  xfer->rx_buf = seg->data_in;
+  xfer->tx_buf = seg->data_out;
+  xfer->num    = seg->num;
+  xfer->rx_cnt = 0U;
+  xfer->tx_cnt = 0U;
+
+  cr2 = reg->CR2;
+
+#ifdef SPI_DMA
+  if ((spi->rx_dma != NULL) && (spi->tx_dma != NULL)) {
+    /* DMA mode */
+    bool pack = SPI_PackFrames(cr2, seg->num);
+
+    cr2 = SPI_RxThreshold(cr2, pack);
+
+    /* Receive into the buffer or dump the data */
+    if (seg->data_in != NULL) {
+      SPI_DMA_Start(spi->rx_dma, reg, (uint32_t)seg->data_in, true, seg->num, pack);
+    }
+    else {
+      SPI_DMA_Start(spi->rx_dma, reg, (uint32_t)&xfer->dump_val, false, seg->num, pack);
+    }
+
+    /* Send the buffer or the default value */
+    if (seg->data_out != NULL) {
+      SPI_DMA_Start(spi->tx_dma, reg, (uint32_t)seg->data_out, true, seg->num, pack);
+    }
+    else {
+      SPI_DMA_Start(spi->tx_dma, reg, (uint32_t)&xfer->def_val, false, seg->num, false);
+    }
+
+    /* RX and TX Buffer DMA enable */
+    cr2 |= SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN;
+  }
+  else
+#endif
+  {
+    /* Interrupt mode, the first data is written on TX Buffer empty */
+    cr2  = SPI_RxThreshold(cr2, seg->num > 1U);
+    cr2 |= SPI_CR2_RXNEIE | SPI_CR2_TXEIE;
+  }
+
+  reg->CR2 = cr2;
+}
+
+/**
+ * @fn          bool SPI_SegmentNext(SPI_RESOURCES *spi)
+ * @brief       Finish the current segment of a transfer list and start the next one.
+ * @param[in]   spi  Pointer to SPI resources
+ * @return      true - next segment started, false - transfer list completed or
+ *              paused (the current segment is not NULL)
+ */
+static
+bool SPI_SegmentNext(SPI_RESOURCES *spi)
+{
+  SPI_TRANSFER_INFO *xfer = spi->xfer;
+  const SPI_SEGMENT *seg  = xfer->segment;
+
+  if ((seg->cs & SPI_SEGMENT_CS_RELEASE) != 0U) {
+    GPIO_PinWrite((GPIO_PORT_t)seg->cs_port, (GPIO_PIN_t)seg->cs_pin, GPIO_PIN_OUT_HIGH);
+  }
+
+  if (--xfer->segment_num == 0U) {
+    xfer->segment = NULL;
+    return (false);
+  }
+
+  xfer->segment++;
+
+  /* Pause only between segments, the application continues the list */
+  if ((seg->flags & SPI_SEGMENT_PAUSE) != 0U) {
+    return (false);
+  }
+
+  SPI_SegmentStart(spi);
+
+  return (true);
+}
+
 /**
  * @fn          ARM_DRIVER_VERSION SPIx_GetVersion(void)
  * @brief       Get driver version.
@@ -909,9 +1104,6 @@ int32_t SPI_Send(const void *data, uint32_t num, SPI_RESOURCES *spi)
   }
 
   cr2 = reg->CR2;
-#if defined(SPI_DMA_RX) || defined(SPI_DMA_TX)
-  bool access_16bit = ((cr2 & SPI_CR2_DS) >> SPI_CR2_DS_Pos) > 7U;
-#endif
 
   /* Update SPI statuses */
   info->status.busy       = 1U;
@@ -929,25 +1121,10 @@ int32_t SPI_Send(const void *data, uint32_t num, SPI_RESOURCES *spi)
   /* DMA mode */
   if (spi->rx_dma != NULL) {
     /* Prepare DMA to receive dummy RX data */
-    DMA_StreamConfig_t *cfg = &spi->rx_dma->handle->config;
-
-    cfg->MemInc = DMA_MINC_DISABLE;
-    cfg->PerInc = DMA_PINC_DISABLE;
-
-    if (access_16bit) {
-      /* 16 - bit data frame */
-      cfg->MemDataAlign = DMA_MDATAALIGN_HALFWORD;
-      cfg->PerDataAlign = DMA_PDATAALIGN_HALFWORD;
-    }
-    else {
-      /* 8 - bit data frame */
-      cfg->MemDataAlign = DMA_MDATAALIGN_BYTE;
-      cfg->PerDataAlign = DMA_PDATAALIGN_BYTE;
-    }
+    bool pack = SPI_PackFrames(cr2, num);
 
-    /* Initialize and start DMA Stream */
-    DMA_Config(spi->rx_dma);
-    DMA_Start(spi->rx_dma, (uint32_t)&reg->DR, (uint32_t)&xfer->dump_val, num);
+    cr2 = SPI_RxThreshold(cr2, pack);
+    SPI_DMA_Start(spi->rx_dma, reg, (uint32_t)&xfer->dump_val, false, num, pack);
     /* RX Buffer DMA enable */
     cr2 |= SPI_CR2_RXDMAEN;
   }
@@ -955,6 +1132,7 @@ int32_t SPI_Send(const void *data, uint32_t num, SPI_RESOURCES *spi)
 #endif
   {
     /* Interrupt mode */
+    cr2 = SPI_RxThreshold(cr2, num > 1U);
     /* RX Buffer not empty interrupt enable */
     cr2 |= SPI_CR2_RXNEIE;
   }
@@ -963,25 +1141,7 @@ int32_t SPI_Send(const void *data, uint32_t num, SPI_RESOURCES *spi)
   /* DMA mode */
   if (spi->tx_dma != NULL) {
     /* Prepare DMA to send TX data */
-    DMA_StreamConfig_t *cfg = &spi->tx_dma->handle->config;
-
-    cfg->MemInc = DMA_MINC_ENABLE;
-    cfg->PerInc = DMA_PINC_DISABLE;
-
-    if (access_16bit) {
-      /* 16 - bit data frame */
-      cfg->MemDataAlign = DMA_MDATAALIGN_HALFWORD;
-      cfg->PerDataAlign = DMA_PDATAALIGN_HALFWORD;
-    }
-    else {
-      /* 8 - bit data frame */
-      cfg->MemDataAlign = DMA_MDATAALIGN_BYTE;
-      cfg->PerDataAlign = DMA_PDATAALIGN_BYTE;
-    }
-
-    /* Initialize and start DMA Stream */
-    DMA_Config(spi->tx_dma);
-    DMA_Start(spi->tx_dma, (uint32_t)&reg->DR, (uint32_t)data, num);
+    SPI_DMA_Start(spi->tx_dma, reg, (uint32_t)data, true, num, SPI_PackFrames(cr2, num));
     /* TX Buffer DMA enable */
     cr2 |= SPI_CR2_TXDMAEN;
   }
@@ -1027,9 +1187,6 @@ int32_t SPI_Receive(void *data, uint32_t num, SPI_RESOURCES *spi)
   }
 
   cr2 = reg->CR2;
-#if defined(SPI_DMA_RX) || defined(SPI_DMA_TX)
-  bool access_16bit = ((cr2 & SPI_CR2_DS) >> SPI_CR2_DS_Pos) > 7U;
-#endif
 
   /* Update SPI statuses */
   info->status.busy       = 1U;
@@ -1047,25 +1204,10 @@ int32_t SPI_Receive(void *data, uint32_t num, SPI_RESOURCES *spi)
   /* DMA mode */
   if (spi->rx_dma != NULL) {
     /* Prepare DMA to receive RX data */
-    DMA_StreamConfig_t *cfg = &spi->rx_dma->handle->config;
-
-    cfg->MemInc = DMA_MINC_ENABLE;
-    cfg->PerInc = DMA_PINC_DISABLE;
-
-    if (access_16bit) {
-      /* 16 - bit data frame */
-      cfg->MemDataAlign = DMA_MDATAALIGN_HALFWORD;
-      cfg->PerDataAlign = DMA_PDATAALIGN_HALFWORD;
-    }
-    else {
-      /* 8 - bit data frame */
-      cfg->MemDataAlign = DMA_MDATAALIGN_BYTE;
-      cfg->PerDataAlign = DMA_PDATAALIGN_BYTE;
-    }
+    bool pack = SPI_PackFrames(cr2, num);
 
-    /* Initialize and start DMA Stream */
-    DMA_Config(spi->rx_dma);
-    DMA_Start(spi->rx_dma, (uint32_t)&reg->DR, (uint32_t)data, num);
+    cr2 = SPI_RxThreshold(cr2, pack);
+    SPI_DMA_Start(spi->rx_dma, reg, (uint32_t)data, true, num, pack);
     /* RX Buffer DMA enable */
     cr2 |= SPI_CR2_RXDMAEN;
   }
@@ -1073,6 +1215,7 @@ int32_t SPI_Receive(void *data, uint32_t num, SPI_RESOURCES *spi)
 #endif
   {
     /* Interrupt mode */
+    cr2 = SPI_RxThreshold(cr2, num > 1U);
     /* RX Buffer not empty interrupt enable */
     cr2 |= SPI_CR2_RXNEIE;
   }
@@ -1081,25 +1224,7 @@ int32_t SPI_Receive(void *data, uint32_t num, SPI_RESOURCES *spi)
   /* DMA mode */
   if (spi->tx_dma != NULL) {
     /* Prepare DMA to send TX data */
-    DMA_StreamConfig_t *cfg = &spi->tx_dma->handle->config;
-
-    cfg->MemInc = DMA_MINC_DISABLE;
-    cfg->PerInc = DMA_PINC_DISABLE;
-
-    if (access_16bit) {
-      /* 16 - bit data frame */
-      cfg->MemDataAlign = DMA_MDATAALIGN_HALFWORD;
-      cfg->PerDataAlign = DMA_PDATAALIGN_HALFWORD;
-    }
-    else {
-      /* 8 - bit data frame */
-      cfg->MemDataAlign = DMA_MDATAALIGN_BYTE;
-      cfg->PerDataAlign = DMA_PDATAALIGN_BYTE;
-    }
-
-    /* Initialize and start DMA Stream */
-    DMA_Config(spi->tx_dma);
-    DMA_Start(spi->tx_dma, (uint32_t)&reg->DR, (uint32_t)&xfer->def_val, num);
+    SPI_DMA_Start(spi->tx_dma, reg, (uint32_t)&xfer->def_val, false, num, false);
     /* TX Buffer DMA enable */
     cr2 |= SPI_CR2_TXDMAEN;
   }
@@ -1146,9 +1271,6 @@ int32_t SPI_Transfer(const void *data_out, void *data_in, uint32_t num, SPI_RESO
   }
 
   cr2 = reg->CR2;
-#ifdef SPI_DMA
-  bool access_16bit = ((cr2 & SPI_CR2_DS) >> SPI_CR2_DS_Pos) > 7U;
-#endif
 
   /* Update SPI statuses */
   info->status.busy       = 1U;
@@ -1166,51 +1288,18 @@ int32_t SPI_Transfer(const void *data_out, void *data_in, uint32_t num, SPI_RESO
   if ((spi->rx_dma != NULL) || (spi->tx_dma != NULL)) {
     /* DMA mode */
     if (spi->rx_dma != NULL) {
-      /* Prepare DMA to receive dummy RX data */
-      DMA_StreamConfig_t *cfg = &spi->rx_dma->handle->config;
+      /* Prepare DMA to receive RX data */
+      bool pack = SPI_PackFrames(cr2, num);
 
-      cfg->MemInc = DMA_MINC_ENABLE;
-      cfg->PerInc = DMA_PINC_DISABLE;
-
-      if (access_16bit) {
-        /* 16 - bit data frame */
-        cfg->MemDataAlign = DMA_MDATAALIGN_HALFWORD;
-        cfg->PerDataAlign = DMA_PDATAALIGN_HALFWORD;
-      }
-      else {
-        /* 8 - bit data frame */
-        cfg->MemDataAlign = DMA_MDATAALIGN_BYTE;
-        cfg->PerDataAlign = DMA_PDATAALIGN_BYTE;
-      }
-
-      /* Initialize and start DMA Stream */
-      DMA_Config(spi->rx_dma);
-      DMA_Start(spi->rx_dma, (uint32_t)&reg->DR, (uint32_t)data_in, num);
+      cr2 = SPI_RxThreshold(cr2, pack);
+      SPI_DMA_Start(spi->rx_dma, reg, (uint32_t)data_in, true, num, pack);
       /* RX Buffer DMA enable */
       cr2 |= SPI_CR2_RXDMAEN;
     }
 
     if (spi->tx_dma != NULL) {
       /* Prepare DMA to send TX data */
-      DMA_StreamConfig_t *cfg = &spi->tx_dma->handle->config;
-
-      cfg->MemInc = DMA_MINC_ENABLE;
-      cfg->PerInc = DMA_PINC_DISABLE;
-
-      if (access_16bit) {
-        /* 16 - bit data frame */
-        cfg->MemDataAlign = DMA_MDATAALIGN_HALFWORD;
-        cfg->PerDataAlign = DMA_PDATAALIGN_HALFWORD;
-      }
-      else {
-        /* 8 - bit data frame */
-        cfg->MemDataAlign = DMA_MDATAALIGN_BYTE;
-        cfg->PerDataAlign = DMA_PDATAALIGN_BYTE;
-      }
-
-      /* Initialize and start DMA Stream */
-      DMA_Config(spi->tx_dma);
-      DMA_Start(spi->tx_dma, (uint32_t)&reg->DR, (uint32_t)data_out, num);
+      SPI_DMA_Start(spi->tx_dma, reg, (uint32_t)data_out, true, num, SPI_PackFrames(cr2, num));
       /* TX Buffer DMA enable */
       cr2 |= SPI_CR2_TXDMAEN;
     }
@@ -1219,6 +1308,7 @@ int32_t SPI_Transfer(const void *data_out, void *data_in, uint32_t num, SPI_RESO
 #endif
   {
     /* Interrupt mode */
+    cr2 = SPI_RxThreshold(cr2, num > 1U);
     /* RX Buffer not empty interrupt enable */
     cr2 |= SPI_CR2_RXNEIE | SPI_CR2_TXEIE;
   }
@@ -1228,6 +1318,68 @@ int32_t SPI_Transfer(const void *data_out, void *data_in, uint32_t num, SPI_RESO
   return (ARM_DRIVER_OK);
 }
 
+/**
+ * @fn          int32_t SPI_TransferList(const SPI_TRANSFER_LIST *list, SPI_RESOURCES *spi)
+ * @brief       Start a transfer list, the segments are chained in the driver.
+ * @param[in]   list  Pointer to transfer list
+ * @param[in]   spi   Pointer to SPI resources
+ * @return      \ref execution_status
+ */
+static
+int32_t SPI_TransferList(const SPI_TRANSFER_LIST *list, SPI_RESOURCES *spi)
+{
+  SPI_INFO *info = spi->info;
+  SPI_TRANSFER_INFO *xfer = spi->xfer;
+  uint32_t i;
+
+  if ((list == NULL) || (list->segment == NULL) || (list->num == 0U)) {
+    return (ARM_DRIVER_ERROR_PARAMETER);
+  }
+
+  for (i = 0U; i < list->num; i++) {
+    if (list->segment[i].num == 0U) {
+      return (ARM_DRIVER_ERROR_PARAMETER);
+    }
+  }
+
+  if ((info->state & SPI_CONFIGURED) == 0U) {
+    return (ARM_DRIVER_ERROR);
+  }
+
+  /* Update SPI statuses */
+  info->status.busy       = 1U;
+  info->status.data_lost  = 0U;
+  info->status.mode_fault = 0U;
+
+  xfer->segment     = list->segment;
+  xfer->segment_num = list->num;
+
+  SPI_SegmentStart(spi);
+
+  return (ARM_DRIVER_OK);
+}
+
+/**
+ * @fn          int32_t SPI_TransferResume(SPI_RESOURCES *spi)
+ * @brief       Continue a transfer list paused after a segment.
+ * @param[in]   spi   Pointer to SPI resources
+ * @return      \ref execution_status
+ */
+static
+int32_t SPI_TransferResume(SPI_RESOURCES *spi)
+{
+  SPI_TRANSFER_INFO *xfer = spi->xfer;
+
+  /* Paused list: the next segment is set, the data of the previous one is done */
+  if ((xfer->segment == NULL) || (xfer->rx_cnt != xfer->num)) {
+    return (ARM_DRIVER_ERROR);
+  }
+
+  SPI_SegmentStart(spi);
+
+  return (ARM_DRIVER_OK);
+}
+
 /**
  * @fn          uint32_t SPI_GetDataCount(SPI_RESOURCES *spi)
  * @brief       Get transferred data count.
@@ -1308,12 +1460,22 @@ int32_t SPI_Control(uint32_t control, uint32_t arg, SPI_RESOURCES *spi)
 
     reg->CR2 = cr2;
 
+    /* Release chip select of the transfer list */
+    if ((spi->xfer->segment != NULL) && (spi->xfer->segment->cs != 0U)) {
+      GPIO_PinWrite((GPIO_PORT_t)spi->xfer->segment->cs_port, (GPIO_PIN_t)spi->xfer->segment->cs_pin, GPIO_PIN_OUT_HIGH);
+    }
+
     memset((void *)spi->xfer, 0, sizeof(SPI_TRANSFER_INFO));
     info->status.busy = 0U;
 
     return ARM_DRIVER_OK;
   }
 
+  /* Paused transfer list stays busy until it is continued */
+  if ((control & ARM_SPI_CONTROL_Msk) == SPI_CONTROL_TRANSFER_RESUME) {
+    return SPI_TransferResume(spi);
+  }
+
   /* Check for busy flag */
   if (info->status.busy) {
     return (ARM_DRIVER_ERROR_BUSY);
@@ -1360,6 +1522,9 @@ int32_t SPI_Control(uint32_t control, uint32_t arg, SPI_RESOURCES *spi)
       spi->xfer->def_val = (uint16_t)(arg & 0xFFFFU);
       return ARM_DRIVER_OK;
 
+    case SPI_CONTROL_TRANSFER_LIST:
+      return SPI_TransferList((const SPI_TRANSFER_LIST *)arg, spi);
+
     case ARM_SPI_CONTROL_SS:
       val = (info->mode & ARM_SPI_CONTROL_Msk);
       /* Master modes */
@@ -1654,6 +1819,19 @@ void SPI_IRQHandler(SPI_RESOURCES *spi)
           *((uint16_t *)xfer->rx_buf++) = (uint16_t)value;
         }
       }
+      else if ((cr2 & SPI_CR2_FRXTH) == 0U) {
+        /* Two 8-bit frames packed in one access */
+        value = *(__IO uint16_t *)&reg->DR;
+        if (xfer->rx_buf != NULL) {
+          *((uint8_t *)xfer->rx_buf++) = (uint8_t)value;
+          *((uint8_t *)xfer->rx_buf++) = (uint8_t)(value >> 8U);
+        }
+
+        if ((xfer->num - ++xfer->rx_cnt) == 2U) {
+          /* The last odd frame is read with RXNE event on 8 bits */
+          cr2 |= SPI_CR2_FRXTH;
+        }
+      }
       else {
         value = *(__IO uint8_t *)&reg->DR;
         if (xfer->rx_buf != NULL) {
@@ -1664,10 +1842,25 @@ void SPI_IRQHandler(SPI_RESOURCES *spi)
       if (++xfer->rx_cnt == xfer->num) {
         /* Disable RX Buffer Not Empty Interrupt */
         cr2 &= ~SPI_CR2_RXNEIE;
-        /* Clear busy flag */
-        info->status.busy = 0U;
-        /* Transfer completed */
-        event |= ARM_SPI_EVENT_TRANSFER_COMPLETE;
+
+        if (xfer->segment != NULL) {
+          /* Transfer list: continue with the next segment */
+          reg->CR2 = cr2;
+          if (SPI_SegmentNext(spi)) {
+            cr2 = reg->CR2;
+          }
+          else if (xfer->segment != NULL) {
+            /* Paused, the application continues the list */
+            event |= SPI_EVENT_SEGMENT_PAUSE;
+          }
+        }
+
+        if (xfer->segment == NULL) {
+          /* Clear busy flag */
+          info->status.busy = 0U;
+          /* Transfer completed */
+          event |= ARM_SPI_EVENT_TRANSFER_COMPLETE;
+        }
       }
     }
     else {
@@ -1688,6 +1881,18 @@ void SPI_IRQHandler(SPI_RESOURCES *spi)
         }
         *(__IO uint16_t *)&reg->DR = (uint16_t)value;
       }
+      else if ((xfer->num - xfer->tx_cnt) > 1U) {
+        /* Two 8-bit frames packed in one access */
+        if (xfer->tx_buf != NULL) {
+          value  = *((uint8_t *)xfer->tx_buf++);
+          value |= (uint32_t)*((uint8_t *)xfer->tx_buf++) << 8U;
+        }
+        else {
+          value = (xfer->def_val & 0xFFU) * 0x0101U;
+        }
+        *(__IO uint16_t *)&reg->DR = (uint16_t)value;
+        xfer->tx_cnt++;
+      }
       else {
         if (xfer->tx_buf != NULL) {
           value = *((uint8_t *)xfer->tx_buf++);
@@ -1740,9 +1945,23 @@ void SPIx_RX_DMA_Callback(uint32_t event, const void *param)
 
   if (event & DMA_EVENT_TRANSFER_COMPLETE) {
     /* RX Buffer DMA disable */
-    spi->reg->CR2 |= SPI_CR2_RXDMAEN;
+    spi->reg->CR2 &= ~SPI_CR2_RXDMAEN;
 
     spi->xfer->rx_cnt = spi->xfer->num;
+
+    if (spi->xfer->segment != NULL) {
+      if (SPI_SegmentNext(spi)) {
+        /* Transfer list continues with the next segment */
+        return;
+      }
+      if (spi->xfer->segment != NULL) {
+        /* Paused, the application continues the list */
+        if (info->cb_event != NULL)
+          info->cb_event(SPI_EVENT_SEGMENT_PAUSE);
+        return;
+      }
+    }
+
     info->status.busy = 0U;
 
     if (info->cb_event != NULL)
@@ -32,7 +32,7 @@
 #include <Driver/GPIO_STM32F7xx.h>
 #include <Driver/DMA_STM32F7xx.h>
 
-#include <Driver/Driver_SPI.h>
+#include <Driver/Driver_SPI_Ext.h>
 
 #include <device_config.h>
 
@@ -356,6 +356,11 @@
   #define SPI_DMA
 #endif
 
+/* Minimum DMA transfer size in bytes that uses the FIFO and memory bursts */
+#ifndef SPI_DMA_BURST_MIN
+  #define SPI_DMA_BURST_MIN         (64U)
+#endif
+
 #define SPIx_EXPORT_DRIVER(x)                                                                                                                                             \
 static int32_t        SPI##x##_Initialize      (ARM_SPI_SignalEvent_t pSignalEvent)                { return SPI_Initialize (pSignalEvent, &SPI##x##_Resources);         } \
 static int32_t        SPI##x##_Uninitialize    (void)                                              { return SPI_Uninitialize (&SPI##x##_Resources);                     } \
@@ -432,6 +437,8 @@ typedef struct _SPI_TRANSFER_INFO {
   uint32_t              dump_val;           // Variable for dumping DMA data
   uint16_t              def_val;            // Default transfer value
   uint16_t              reserved;           // Reserved
+  const SPI_SEGMENT    *segment;            // Transfer list: current segment
+  uint32_t              segment_num;        // Transfer list: number of segments left
 } SPI_TRANSFER_INFO;
 
 /* SPI Resource Configuration */
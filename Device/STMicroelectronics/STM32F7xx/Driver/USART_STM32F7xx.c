@@ -1806,6 +1806,11 @@ int32_t USART_Receive(void *data, uint32_t num, const USART_RESOURCES *usart)
     return (ARM_DRIVER_ERROR_BUSY);
   }
 
+  if (((info->flags & USART_FLAG_RX_CONTINUOUS) != 0U) && (info->mode == ARM_USART_MODE_SYNCHRONOUS_MASTER)) {
+    /* Continuous receive is not available in synchronous mode */
+    return (ARM_DRIVER_ERROR);
+  }
+
   /* Disable RXNE Interrupt */
   reg->CR1 &= ~USART_CR1_RXNEIE;
 
@@ -1839,11 +1844,24 @@ int32_t USART_Receive(void *data, uint32_t num, const USART_RESOURCES *usart)
 
   /* DMA mode */
   if (usart->dma_rx) {
-    DMA_StreamConfig_t *cfg = &usart->dma_tx->handle->config;
+    DMA_StreamConfig_t *cfg = &usart->dma_rx->handle->config;
 
     /* Configure and enable rx DMA channel */
     cfg->MemInc = mem_inc;
 
+    if ((info->flags & USART_FLAG_RX_CONTINUOUS) != 0U) {
+      /* Receive into the ring until aborted */
+      cfg->Mode = DMA_MODE_CIRCULAR;
+
+      xfer->rx_rd     = 0U;
+      xfer->rx_wr     = 0U;
+      xfer->rx_rd_cnt = 0U;
+      xfer->rx_wr_cnt = 0U;
+    }
+    else {
+      cfg->Mode = DMA_MODE_NORMAL;
+    }
+
     if (((cr1 & USART_CR1_M) != 0U) && ((cr1 & USART_CR1_PCE) == 0U)) {
       // 9-bit data frame, no parity
       cfg->MemDataAlign = DMA_MDATAALIGN_HALFWORD;
@@ -1856,6 +1874,12 @@ int32_t USART_Receive(void *data, uint32_t num, const USART_RESOURCES *usart)
     }
 
     DMA_Config(usart->dma_rx);
+
+    if (cfg->Mode == DMA_MODE_CIRCULAR) {
+      /* Half transfer interrupt signals the first half of the ring */
+      usart->dma_rx->stream->CR |= DMA_SxCR_HTIE;
+    }
+
     DMA_Start(usart->dma_rx, (uint32_t)(&reg->RDR), (uint32_t)data, num);
 
     reg->CR3 |= USART_CR3_DMAR;
@@ -1935,6 +1959,152 @@ int32_t USART_Transfer(const void *data_out, void *data_in, uint32_t num, const
   return (ARM_DRIVER_OK);
 }
 
+#ifdef __USART_DMA_RX
+/**
+ * @fn          uint32_t USART_RxRingWrite(const USART_RESOURCES *usart)
+ * @brief       Get the current write index of the continuous receive ring.
+ * @param[in]   usart     Pointer to USART resources
+ * @return      write index
+ */
+static
+uint32_t USART_RxRingWrite(const USART_RESOURCES *usart)
+{
+  uint32_t wr = usart->xfer->rx_num - DMA_GET_COUNTER(usart->dma_rx);
+
+  /* Counter is reloaded at the end of the ring */
+  if (wr == usart->xfer->rx_num) {
+    wr = 0U;
+  }
+
+  return (wr);
+}
+
+/**
+ * @fn          uint32_t USART_RxRingDelta(const USART_RESOURCES *usart)
+ * @brief       Get number of data written to the ring since the last event.
+ * @param[in]   usart     Pointer to USART resources
+ * @return      number of data items
+ */
+static
+uint32_t USART_RxRingDelta(const USART_RESOURCES *usart)
+{
+  USART_TRANSFER_INFO *xfer = usart->xfer;
+
+  return ((USART_RxRingWrite(usart) + xfer->rx_num - xfer->rx_wr) % xfer->rx_num);
+}
+
+/**
+ * @fn          uint32_t USART_RxRingUpdate(const USART_RESOURCES *usart)
+ * @brief       Account data written to the ring, called on the ring events.
+ * @param[in]   usart     Pointer to USART resources
+ * @return      ARM_USART_EVENT_RX_OVERFLOW when unread data was overwritten, 0 otherwise
+ */
+static
+uint32_t USART_RxRingUpdate(const USART_RESOURCES *usart)
+{
+  USART_TRANSFER_INFO *xfer = usart->xfer;
+
+  /* Half and full ring events keep the delta below the ring size */
+  xfer->rx_wr_cnt += USART_RxRingDelta(usart);
+  xfer->rx_wr      = USART_RxRingWrite(usart);
+
+  if ((xfer->rx_wr_cnt - xfer->rx_rd_cnt) >= xfer->rx_num) {
+    usart->info->status.rx_overflow = 1U;
+    return (ARM_USART_EVENT_RX_OVERFLOW);
+  }
+
+  return (0U);
+}
+
+/**
+ * @fn          uint32_t USART_RxRingAvailable(const USART_RESOURCES *usart)
+ * @brief       Get number of unread data in the ring.
+ * @note        Called with interrupts disabled, the ring events update the
+ *              write position from the USART and DMA interrupt handlers.
+ * @param[in]   usart     Pointer to USART resources
+ * @return      number of data items
+ */
+static
+uint32_t USART_RxRingAvailable(const USART_RESOURCES *usart)
+{
+  USART_TRANSFER_INFO *xfer = usart->xfer;
+
+  if ((xfer->rx_wr_cnt - xfer->rx_rd_cnt) >= xfer->rx_num) {
+    /* Unread data was overwritten, continue with the new data */
+    xfer->rx_rd     = xfer->rx_wr;
+    xfer->rx_rd_cnt = xfer->rx_wr_cnt;
+  }
+
+  return ((USART_RxRingWrite(usart) + xfer->rx_num - xfer->rx_rd) % xfer->rx_num);
+}
+
+/**
+ * @fn          void USART_RxRingSpans(USART_RX_SPANS *spans, const USART_RESOURCES *usart)
+ * @brief       Get unread data of the ring as up to two contiguous spans.
+ * @param[out]  spans     Pointer to spans
+ * @param[in]   usart     Pointer to USART resources
+ */
+static
+void USART_RxRingSpans(USART_RX_SPANS *spans, const USART_RESOURCES *usart)
+{
+  USART_TRANSFER_INFO *xfer    = usart->xfer;
+  uint32_t             cr1     = usart->reg->CR1;
+  uint32_t             size    = 1U;
+  uint32_t             primask = __get_PRIMASK();
+  uint32_t             num;
+
+  if (((cr1 & USART_CR1_M) != 0U) && ((cr1 & USART_CR1_PCE) == 0U)) {
+    /* 9-bit data frame, no parity */
+    size = 2U;
+  }
+
+  __disable_irq();
+  num = USART_RxRingAvailable(usart);
+
+  spans->data[0] = &xfer->rx_buf[xfer->rx_rd * size];
+
+  if ((xfer->rx_rd + num) > xfer->rx_num) {
+    /* Unread data wraps around the end of the ring */
+    spans->num[0]  = xfer->rx_num - xfer->rx_rd;
+    spans->data[1] = xfer->rx_buf;
+    spans->num[1]  = num - spans->num[0];
+  }
+  else {
+    spans->num[0]  = num;
+    spans->data[1] = NULL;
+    spans->num[1]  = 0U;
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+ * @fn          int32_t USART_RxRingRelease(uint32_t num, const USART_RESOURCES *usart)
+ * @brief       Release data read from the ring.
+ * @param[in]   num       Number of data items
+ * @param[in]   usart     Pointer to USART resources
+ * @return      \ref execution_status
+ */
+static
+int32_t USART_RxRingRelease(uint32_t num, const USART_RESOURCES *usart)
+{
+  USART_TRANSFER_INFO *xfer    = usart->xfer;
+  uint32_t             primask = __get_PRIMASK();
+  int32_t              status  = ARM_DRIVER_OK;
+
+  __disable_irq();
+  if (num > USART_RxRingAvailable(usart)) {
+    status = ARM_DRIVER_ERROR_PARAMETER;
+  }
+  else {
+    xfer->rx_rd      = (xfer->rx_rd + num) % xfer->rx_num;
+    xfer->rx_rd_cnt += num;
+  }
+  __set_PRIMASK(primask);
+
+  return (status);
+}
+#endif
+
 /**
  * @fn          uint32_t USART_GetTxCount(const USART_RESOURCES *usart)
  * @brief       Get transmitted data count.
@@ -1966,6 +2136,16 @@ uint32_t USART_GetRxCount(const USART_RESOURCES *usart)
 {
 #ifdef __USART_DMA_RX
   if (usart->dma_rx) {
+    if (((usart->info->flags & USART_FLAG_RX_CONTINUOUS) != 0U) && (usart->info->status.rx_busy != 0U)) {
+      uint32_t primask = __get_PRIMASK();
+      uint32_t cnt;
+
+      __disable_irq();
+      cnt = usart->xfer->rx_wr_cnt + USART_RxRingDelta(usart);
+      __set_PRIMASK(primask);
+
+      return (cnt);
+    }
     return (usart->xfer->rx_num - DMA_GET_COUNTER(usart->dma_rx));
   }
   else
@@ -2167,6 +2347,69 @@ int32_t USART_Control(uint32_t control, uint32_t arg, const USART_RESOURCES *usa
       }
       return (ARM_DRIVER_OK);
 
+    /* Receiver timeout */
+    case USART_CONTROL_RX_TIMEOUT:
+      if (usart->capabilities.event_rx_timeout == 0U) {
+        return (ARM_DRIVER_ERROR_UNSUPPORTED);
+      }
+
+      if (arg > (USART_RTOR_RTO_Msk >> USART_RTOR_RTO_Pos)) {
+        return (ARM_DRIVER_ERROR_PARAMETER);
+      }
+
+      if (arg != 0U) {
+        reg->RTOR = (reg->RTOR & ~USART_RTOR_RTO_Msk) | (arg << USART_RTOR_RTO_Pos);
+        reg->ICR  = USART_ICR_RTOCF;
+        reg->CR2 |= USART_CR2_RTOEN;
+        reg->CR1 |= USART_CR1_RTOIE;
+      }
+      else {
+        reg->CR1 &= ~USART_CR1_RTOIE;
+        reg->CR2 &= ~USART_CR2_RTOEN;
+      }
+      return (ARM_DRIVER_OK);
+
+#ifdef __USART_DMA_RX
+    /* Continuous receive */
+    case USART_CONTROL_RX_CONTINUOUS:
+      if (usart->dma_rx == NULL) {
+        return (ARM_DRIVER_ERROR_UNSUPPORTED);
+      }
+
+      if (info->status.rx_busy != 0U) {
+        return (ARM_DRIVER_ERROR_BUSY);
+      }
+
+      if (arg != 0U) {
+        info->flags |= USART_FLAG_RX_CONTINUOUS;
+      }
+      else {
+        info->flags &= ~USART_FLAG_RX_CONTINUOUS;
+      }
+      return (ARM_DRIVER_OK);
+
+    /* Get unread data of the ring */
+    case USART_GET_RX_SPANS:
+      if (arg == 0U) {
+        return (ARM_DRIVER_ERROR_PARAMETER);
+      }
+
+      if (((info->flags & USART_FLAG_RX_CONTINUOUS) == 0U) || (info->status.rx_busy == 0U)) {
+        return (ARM_DRIVER_ERROR);
+      }
+
+      USART_RxRingSpans((USART_RX_SPANS *)arg, usart);
+      return (ARM_DRIVER_OK);
+
+    /* Release data read from the ring */
+    case USART_RELEASE_RX_DATA:
+      if (((info->flags & USART_FLAG_RX_CONTINUOUS) == 0U) || (info->status.rx_busy == 0U)) {
+        return (ARM_DRIVER_ERROR);
+      }
+
+      return (USART_RxRingRelease(arg, usart));
+#endif
+
     default:
       break;
   }
@@ -2751,6 +2994,22 @@ void USART_IRQHandler(const USART_RESOURCES *usart)
     event |= ARM_USART_EVENT_RX_TIMEOUT;
   }
 
+  /* Receiver timeout */
+  if (((sr & USART_ISR_RTOF) != 0U) && ((reg->CR1 & USART_CR1_RTOIE) != 0U)) {
+    /* Clear RTO flag */
+    reg->ICR = USART_ICR_RTOCF;
+    event |= ARM_USART_EVENT_RX_TIMEOUT;
+  }
+
+#ifdef __USART_DMA_RX
+  /* Continuous receive: account data received before the line went idle */
+  if (((event & ARM_USART_EVENT_RX_TIMEOUT) != 0U) &&
+      ((info->flags & USART_FLAG_RX_CONTINUOUS) != 0U) && (info->status.rx_busy != 0U))
+  {
+    event |= USART_RxRingUpdate(usart);
+  }
+#endif
+
   /* Transmit data register empty */
   if (sr & USART_ISR_TXE & reg->CR1) {
     /* Break handling */
@@ -2895,6 +3154,18 @@ static void USART_RX_DMA_Callback(uint32_t event, const void *param)
   USART_TRANSFER_INFO *xfer = usart->xfer;
   uint32_t val, cb_event;
 
+  if ((info->flags & USART_FLAG_RX_CONTINUOUS) != 0U) {
+    /* Continuous receive: half and full ring */
+    if (event & (DMA_EVENT_HALF_TRANSFER_COMPLETE | DMA_EVENT_TRANSFER_COMPLETE)) {
+      cb_event = USART_RxRingUpdate(usart) | USART_EVENT_RX_DATA;
+
+      if (info->cb_event) {
+        info->cb_event(cb_event);
+      }
+    }
+    return;
+  }
+
   if (event & DMA_EVENT_TRANSFER_COMPLETE) {
     /* Disable IDLE interrupt */
     usart->reg->CR1 &= ~USART_CR1_IDLEIE;
@@ -33,7 +33,7 @@
 #include <Driver/GPIO_STM32F7xx.h>
 #include <Driver/DMA_STM32F7xx.h>
 
-#include <Driver/Driver_USART.h>
+#include <Driver/Driver_USART_Ext.h>
 
 #include <device_config.h>
 
@@ -575,6 +575,7 @@ ARM_DRIVER_USART Driver_USART##x = {
 #define USART_FLAG_CONFIGURED       ((uint8_t)(1U << 2U))
 #define USART_FLAG_TX_ENABLED       ((uint8_t)(1U << 3U))
 #define USART_FLAG_RX_ENABLED       ((uint8_t)(1U << 4U))
+#define USART_FLAG_RX_CONTINUOUS    ((uint8_t)(1U << 5U))
 
 /* USART synchronous transfer modes */
 #define USART_SYNC_MODE_TX           (1UL)
@@ -618,6 +619,10 @@ typedef struct _USART_TRANSFER_INFO {
   uint8_t                break_flag;    // Transmit break flag
   uint8_t               send_active;    // Send active flag
   uint16_t                 reserved;    // Reserved
+  uint32_t                    rx_rd;    // Continuous receive: read index
+  uint32_t                    rx_wr;    // Continuous receive: write index at last event
+  uint32_t                rx_rd_cnt;    // Continuous receive: number of data released
+  uint32_t                rx_wr_cnt;    // Continuous receive: number of data written
 } USART_TRANSFER_INFO;
 
 typedef struct _USART_STATUS {
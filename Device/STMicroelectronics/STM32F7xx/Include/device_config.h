@@ -46,6 +46,7 @@
 #define DEV_QSPI_DMA_INT_PRIORITY      (1U)
 #define DEV_EXTI_INT_PRIORITY          (1U)
 #define DEV_DAC_INT_PRIORITY           (1U)
+#define DEV_CRC_DMA_INT_PRIORITY       (1U)
 
 // <e> USART1 (Universal synchronous asynchronous receiver transmitter) [Driver_USART1]
 // <i> Configuration settings for Driver_USART1 in component ::CMSIS Driver:USART
@@ -2307,6 +2308,26 @@
 
 // </e>
 
+// <h> CRC (Cyclic redundancy check calculation unit)
+//   <e> DMA
+//     <i>  Feed large blocks to the CRC unit by a memory to memory transfer
+//     <o1> Number <2=>2
+//     <i>  Selects DMA Number (only DMA2 can be used)
+//     <o2> Stream <0-7>
+//     <i>  Selects DMA Stream
+//     <o3> Channel <0-7>
+//     <i>  Selects DMA Channel
+//     <o4> Priority <0=>Low <1=>Medium <2=>High <3=>Very High
+//     <i>  Selects DMA Priority
+//   </e>
+#define DEV_CRC_DMA                     0
+#define DEV_CRC_DMA_NUMBER              2
+#define DEV_CRC_DMA_STREAM              1
+#define DEV_CRC_DMA_CHANNEL             0
+#define DEV_CRC_DMA_PRIORITY            0
+
+// </h>
+
 // <e> EXTI (Extended interrupts and events controller)
 // <i> Configuration settings for EXTI
 #define DEV_EXTI                       0
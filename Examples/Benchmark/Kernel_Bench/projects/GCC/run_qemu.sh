@@ -0,0 +1,26 @@
+#!/bin/sh
+#
+# Run the kernel benchmark suite on the QEMU model of the Arm MPS2 AN385
+# board. The report is written through semihosting to stdout, QEMU exits
+# when the suite calls SYS_EXIT.
+#
+#   ./run_qemu.sh [elf]     default build/kernel_bench.elf
+#
+# QEMU=<path> selects the emulator, TIMEOUT=<s> stops a hung run (default 600).
+#
+
+ELF=${1:-build/kernel_bench.elf}
+QEMU=${QEMU:-qemu-system-arm}
+TIMEOUT=${TIMEOUT:-600}
+
+if [ ! -f "$ELF" ]; then
+  echo "$ELF not found, run make first" >&2
+  exit 1
+fi
+
+exec timeout "$TIMEOUT" "$QEMU" \
+  -machine mps2-an385 -cpu cortex-m3 \
+  -display none -monitor none -serial none \
+  -chardev stdio,id=semihost \
+  -semihosting-config enable=on,target=native,chardev=semihost \
+  -kernel "$ELF"
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: Startup for the Arm MPS2 AN385 (Cortex-M3) as modelled by QEMU
+ */
+
+#include <stdint.h>
+
+#include "Core/Cortex/cmsis_compiler.h"
+
+/*----------------------------------------------------------------------------
+  Exception / Interrupt Handler Function Prototype
+ *----------------------------------------------------------------------------*/
+typedef void( *pFunc )( void );
+
+/*----------------------------------------------------------------------------
+  External References
+ *----------------------------------------------------------------------------*/
+extern uint32_t __INITIAL_SP;
+
+extern __NO_RETURN void __PROGRAM_START(void);
+
+extern void SystemInit(void);
+
+/*----------------------------------------------------------------------------
+  Internal References
+ *----------------------------------------------------------------------------*/
+void __NO_RETURN Default_Handler(void);
+void __NO_RETURN Reset_Handler  (void);
+
+/*----------------------------------------------------------------------------
+  Exception / Interrupt Handler
+ *----------------------------------------------------------------------------*/
+/* Exceptions */
+void NMI_Handler                   (void) __attribute__ ((weak, alias("Default_Handler")));
+void HardFault_Handler             (void) __attribute__ ((weak, alias("Default_Handler")));
+void MemManage_Handler             (void) __attribute__ ((weak, alias("Default_Handler")));
+void BusFault_Handler              (void) __attribute__ ((weak, alias("Default_Handler")));
+void UsageFault_Handler            (void) __attribute__ ((weak, alias("Default_Handler")));
+void SVC_Handler                   (void) __attribute__ ((weak, alias("Default_Handler")));
+void DebugMon_Handler              (void) __attribute__ ((weak, alias("Default_Handler")));
+void PendSV_Handler                (void) __attribute__ ((weak, alias("Default_Handler")));
+void SysTick_Handler               (void) __attribute__ ((weak, alias("Default_Handler")));
+
+void UARTRX0_IRQHandler            (void) __attribute__ ((weak, alias("Default_Handler")));
+void UARTTX0_IRQHandler            (void) __attribute__ ((weak, alias("Default_Handler")));
+void UARTRX1_IRQHandler            (void) __attribute__ ((weak, alias("Default_Handler")));
+void UARTTX1_IRQHandler            (void) __attribute__ ((weak, alias("Default_Handler")));
+void UARTRX2_IRQHandler            (void) __attribute__ ((weak, alias("Default_Handler")));
+void UARTTX2_IRQHandler            (void) __attribute__ ((weak, alias("Default_Handler")));
+void PORT0_ALL_IRQHandler          (void) __attribute__ ((weak, alias("Default_Handler")));
+void PORT1_ALL_IRQHandler          (void) __attribute__ ((weak, alias("Default_Handler")));
+void TIMER0_IRQHandler             (void) __attribute__ ((weak, alias("Default_Handler")));
+void TIMER1_IRQHandler             (void) __attribute__ ((weak, alias("Default_Handler")));
+void DUALTIMER_IRQHandler          (void) __attribute__ ((weak, alias("Default_Handler")));
+void SPI_IRQHandler                (void) __attribute__ ((weak, alias("Default_Handler")));
+void UARTOVF_IRQHandler            (void) __attribute__ ((weak, alias("Default_Handler")));
+void ETHERNET_IRQHandler           (void) __attribute__ ((weak, alias("Default_Handler")));
+void I2S_IRQHandler                (void) __attribute__ ((weak, alias("Default_Handler")));
+void TSC_IRQHandler                (void) __attribute__ ((weak, alias("Default_Handler")));
+void PORT2_ALL_IRQHandler          (void) __attribute__ ((weak, alias("Default_Handler")));
+void PORT3_ALL_IRQHandler          (void) __attribute__ ((weak, alias("Default_Handler")));
+void UARTRX3_IRQHandler            (void) __attribute__ ((weak, alias("Default_Handler")));
+void UARTTX3_IRQHandler            (void) __attribute__ ((weak, alias("Default_Handler")));
+void UARTRX4_IRQHandler            (void) __attribute__ ((weak, alias("Default_Handler")));
+void UARTTX4_IRQHandler            (void) __attribute__ ((weak, alias("Default_Handler")));
+void ADCSPI_IRQHandler             (void) __attribute__ ((weak, alias("Default_Handler")));
+void SHIELDSPI_IRQHandler          (void) __attribute__ ((weak, alias("Default_Handler")));
+void PORT0_0_IRQHandler            (void) __attribute__ ((weak, alias("Default_Handler")));
+void PORT0_1_IRQHandler            (void) __attribute__ ((weak, alias("Default_Handler")));
+void PORT0_2_IRQHandler            (void) __attribute__ ((weak, alias("Default_Handler")));
+void PORT0_3_IRQHandler            (void) __attribute__ ((weak, alias("Default_Handler")));
+void PORT0_4_IRQHandler            (void) __attribute__ ((weak, alias("Default_Handler")));
+void PORT0_5_IRQHandler            (void) __attribute__ ((weak, alias("Default_Handler")));
+void PORT0_6_IRQHandler            (void) __attribute__ ((weak, alias("Default_Handler")));
+void PORT0_7_IRQHandler            (void) __attribute__ ((weak, alias("Default_Handler")));
+
+/*----------------------------------------------------------------------------
+  Exception / Interrupt Vector table
+ *----------------------------------------------------------------------------*/
+
+#if defined ( __GNUC__ )
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+
+extern const pFunc __VECTOR_TABLE[];
+       const pFunc __VECTOR_TABLE[] __VECTOR_TABLE_ATTRIBUTE = {
+  (pFunc)(&__INITIAL_SP),           /*     Initial Stack Pointer              */
+  Reset_Handler,                    /*     Reset Handler                      */
+  NMI_Handler,                      /* -14 NMI Handler                        */
+  HardFault_Handler,                /* -13 Hard Fault Handler                 */
+  MemManage_Handler,                /* -12 MPU Fault Handler                  */
+  BusFault_Handler,                 /* -11 Bus Fault Handler                  */
+  UsageFault_Handler,               /* -10 Usage Fault Handler                */
+  0,                                /*     Reserved                           */
+  0,                                /*     Reserved                           */
+  0,                                /*     Reserved                           */
+  0,                                /*     Reserved                           */
+  SVC_Handler,                      /*  -5 SVCall Handler                     */
+  DebugMon_Handler,                 /*  -4 Debug Monitor Handler              */
+  0,                                /*     Reserved                           */
+  PendSV_Handler,                   /*  -2 PendSV Handler                     */
+  SysTick_Handler,                  /*  -1 SysTick Handler                    */
+
+  /* Interrupts */
+  UARTRX0_IRQHandler,               /*   0 UART 0 receive                     */
+  UARTTX0_IRQHandler,               /*   1 UART 0 transmit                    */
+  UARTRX1_IRQHandler,               /*   2 UART 1 receive                     */
+  UARTTX1_IRQHandler,               /*   3 UART 1 transmit                    */
+  UARTRX2_IRQHandler,               /*   4 UART 2 receive                     */
+  UARTTX2_IRQHandler,               /*   5 UART 2 transmit                    */
+  PORT0_ALL_IRQHandler,             /*   6 GPIO port 0 combined               */
+  PORT1_ALL_IRQHandler,             /*   7 GPIO port 1 combined               */
+  TIMER0_IRQHandler,                /*   8 Timer 0                            */
+  TIMER1_IRQHandler,                /*   9 Timer 1                            */
+  DUALTIMER_IRQHandler,             /*  10 Dual timer                         */
+  SPI_IRQHandler,                   /*  11 SPI                                */
+  UARTOVF_IRQHandler,               /*  12 UART 0..4 overflow                 */
+  ETHERNET_IRQHandler,              /*  13 Ethernet                           */
+  I2S_IRQHandler,                   /*  14 Audio I2S                          */
+  TSC_IRQHandler,                   /*  15 Touch screen                       */
+  PORT2_ALL_IRQHandler,             /*  16 GPIO port 2 combined               */
+  PORT3_ALL_IRQHandler,             /*  17 GPIO port 3 combined               */
+  UARTRX3_IRQHandler,               /*  18 UART 3 receive                     */
+  UARTTX3_IRQHandler,               /*  19 UART 3 transmit                    */
+  UARTRX4_IRQHandler,               /*  20 UART 4 receive                     */
+  UARTTX4_IRQHandler,               /*  21 UART 4 transmit                    */
+  ADCSPI_IRQHandler,                /*  22 SPI ADC                            */
+  SHIELDSPI_IRQHandler,             /*  23 SPI shield 0 and 1                 */
+  PORT0_0_IRQHandler,               /*  24 GPIO port 0 pin 0                  */
+  PORT0_1_IRQHandler,               /*  25 GPIO port 0 pin 1                  */
+  PORT0_2_IRQHandler,               /*  26 GPIO port 0 pin 2                  */
+  PORT0_3_IRQHandler,               /*  27 GPIO port 0 pin 3                  */
+  PORT0_4_IRQHandler,               /*  28 GPIO port 0 pin 4                  */
+  PORT0_5_IRQHandler,               /*  29 GPIO port 0 pin 5                  */
+  PORT0_6_IRQHandler,               /*  30 GPIO port 0 pin 6                  */
+  PORT0_7_IRQHandler,               /*  31 GPIO port 0 pin 7                  */
+};
+
+#if defined ( __GNUC__ )
+#pragma GCC diagnostic pop
+#endif
+
+/*----------------------------------------------------------------------------
+  Reset Handler called on controller reset
+ *----------------------------------------------------------------------------*/
+void Reset_Handler(void)
+{
+  SystemInit();                      /* CMSIS System Initialization           */
+  __PROGRAM_START();                 /* Enter PreMain (C library entry point) */
+}
+
+/*----------------------------------------------------------------------------
+  Default Handler for Exceptions / Interrupts
+ *----------------------------------------------------------------------------*/
+void Default_Handler(void)
+{
+  while(1);
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: System for the Arm MPS2 AN385 (Cortex-M3) as modelled by QEMU
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#define SYSTEM_CLOCK                  (25000000UL)  ///< Fixed FPGA system clock
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-exported)
+ ******************************************************************************/
+
+uint32_t SystemCoreClock = SYSTEM_CLOCK;  /*!< System Clock Frequency (Core Clock)  */
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+/**
+ * @brief       Update SystemCoreClock variable.
+ */
+void SystemCoreClockUpdate(void)
+{
+  SystemCoreClock = SYSTEM_CLOCK;
+}
+
+/**
+ * @brief       Initialize the System.
+ */
+void SystemInit(void)
+{
+  SystemCoreClockUpdate();
+}
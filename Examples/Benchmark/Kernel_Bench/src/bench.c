@@ -0,0 +1,637 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: mbOS real-time kernel
+ */
+
+/**
+ * @file
+ *
+ * Kernel micro-benchmark suite.
+ *
+ * Every test prints one line in the comma separated format
+ *
+ *   BENCH,<test>,<samples>,<average>,<minimum>,<maximum>
+ *
+ * The values are counter cycles per operation with the counter read overhead
+ * subtracted. The report starts with the counter frequency and the overhead
+ * and ends with "BENCH,end". Tests that the port cannot run are not reported.
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stddef.h>
+
+#include "bench.h"
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#if (BENCH_MUTEX_CHAIN < 1U) || (BENCH_MUTEX_CHAIN > 4U)
+  #error BENCH_MUTEX_CHAIN must be in range 1..4
+#endif
+
+#define CHAIN_ITERATIONS              (100U)
+#define TIMER_TIMEOUT                 (100000U)
+#define MSG_COUNT                     (16U)
+
+/*******************************************************************************
+ *  typedefs and structures (scope: module-local)
+ ******************************************************************************/
+
+typedef struct {
+  uint32_t count;
+  uint32_t min;
+  uint32_t max;
+  uint64_t total;
+} bench_stat_t;
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static uint32_t          overhead;
+static bench_stat_t      stat;
+static bench_stat_t      stat_isr;
+static volatile uint32_t stamp;
+
+static osThread_t        bench_cb;
+static uint64_t          bench_stack[BENCH_STACK_SIZE/8U];
+
+static osThreadId_t      peer_id;
+static osThread_t        peer_cb;
+static uint64_t          peer_stack[BENCH_STACK_SIZE/8U];
+
+static osThreadId_t      chain_id[BENCH_MUTEX_CHAIN];
+static osThread_t        chain_cb[BENCH_MUTEX_CHAIN];
+static uint64_t          chain_stack[BENCH_MUTEX_CHAIN][BENCH_STACK_SIZE/8U];
+
+static osSemaphoreId_t   sem_a;
+static osSemaphore_t     sem_a_cb;
+static osSemaphoreId_t   sem_b;
+static osSemaphore_t     sem_b_cb;
+
+static osMutexId_t       mutex_id[BENCH_MUTEX_CHAIN];
+static osMutex_t         mutex_cb[BENCH_MUTEX_CHAIN];
+
+static osMessageQueueId_t mq;
+static osMessageQueue_t   mq_cb;
+static uint32_t           mq_mem[osMessageQueueMemSize(MSG_COUNT, sizeof(uint32_t))/4U];
+
+static osDataQueueId_t    dq;
+static osDataQueue_t      dq_cb;
+static uint32_t           dq_mem[MSG_COUNT];
+
+static osMemoryPoolId_t   mp;
+static osMemoryPool_t     mp_cb;
+static uint32_t           mp_mem[osMemoryPoolMemSize(MSG_COUNT, 32U)/4U];
+
+static osTimerId_t        timer_id[BENCH_TIMER_COUNT + 1U];
+static osTimer_t          timer_cb[BENCH_TIMER_COUNT + 1U];
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+static void PutStr(const char *str)
+{
+  while (*str != '\0') {
+    BenchPortPutc(*str++);
+  }
+}
+
+static void PutDec(uint32_t value)
+{
+  char     buf[10];
+  uint32_t len = 0U;
+
+  do {
+    buf[len++] = (char)('0' + (value % 10U));
+    value /= 10U;
+  } while (value != 0U);
+
+  while (len != 0U) {
+    BenchPortPutc(buf[--len]);
+  }
+}
+
+static void StatReset(bench_stat_t *st)
+{
+  st->count = 0U;
+  st->min   = UINT32_MAX;
+  st->max   = 0U;
+  st->total = 0U;
+}
+
+/**
+ * @brief       Add a sample measured from start to now.
+ * @param[in]   st      statistics.
+ * @param[in]   start   counter value at the start of the operation.
+ * @param[in]   ops     number of operations measured by the sample.
+ */
+static void StatAdd(bench_stat_t *st, uint32_t start, uint32_t ops)
+{
+  uint32_t cycles = BenchPortCycles() - start;
+
+  cycles = (cycles > overhead) ? ((cycles - overhead) / ops) : 0U;
+
+  st->count++;
+  st->total += cycles;
+  if (cycles < st->min) {
+    st->min = cycles;
+  }
+  if (cycles > st->max) {
+    st->max = cycles;
+  }
+}
+
+static void StatReport(const char *name, const bench_stat_t *st)
+{
+  if (st->count == 0U) {
+    return;
+  }
+
+  PutStr("BENCH,");
+  PutStr(name);
+  BenchPortPutc(',');
+  PutDec(st->count);
+  BenchPortPutc(',');
+  PutDec((uint32_t)(st->total / st->count));
+  BenchPortPutc(',');
+  PutDec(st->min);
+  BenchPortPutc(',');
+  PutDec(st->max);
+  BenchPortPutc('\n');
+}
+
+static bool PeerStart(osThreadFunc_t func, osPriority_t priority)
+{
+  osThreadAttr_t attr = {
+    .name       = "bench_peer",
+    .attr_bits  = osThreadDetached,
+    .cb_mem     = &peer_cb,
+    .cb_size    = sizeof(peer_cb),
+    .stack_mem  = &peer_stack[0],
+    .stack_size = sizeof(peer_stack),
+    .priority   = priority,
+    .threshold  = osPriorityNone,
+  };
+
+  peer_id = osThreadNew(func, NULL, &attr);
+
+  return (peer_id != NULL);
+}
+
+static void PeerStop(void)
+{
+  (void)osThreadTerminate(peer_id);
+  peer_id = NULL;
+}
+
+/*
+ * Thread functions of the peer thread.
+ */
+
+__NO_RETURN
+static void PeerYield(void *argument)
+{
+  (void)argument;
+
+  for (;;) {
+    (void)osThreadYield();
+  }
+}
+
+__NO_RETURN
+static void PeerFlagsWait(void *argument)
+{
+  (void)argument;
+
+  for (;;) {
+    (void)osThreadFlagsWait(1U, osFlagsWaitAny, osWaitForever);
+    StatAdd(&stat, stamp, 1U);
+  }
+}
+
+__NO_RETURN
+static void PeerIrqWait(void *argument)
+{
+  (void)argument;
+
+  for (;;) {
+    (void)osSemaphoreAcquire(sem_a, osWaitForever);
+    StatAdd(&stat, stamp, 1U);
+  }
+}
+
+__NO_RETURN
+static void PeerPingPong(void *argument)
+{
+  (void)argument;
+
+  for (;;) {
+    (void)osSemaphoreAcquire(sem_a, osWaitForever);
+    (void)osSemaphoreRelease(sem_b);
+  }
+}
+
+/**
+ * @brief       Thread of the mutex inheritance chain.
+ * @param[in]   argument  position in the chain, 1..BENCH_MUTEX_CHAIN.
+ */
+static void ChainThread(void *argument)
+{
+  uint32_t pos = (uint32_t)argument;
+
+  if (pos < BENCH_MUTEX_CHAIN) {
+    (void)osMutexAcquire(mutex_id[pos], osWaitForever);
+  }
+  else {
+    /* The head of the chain starts the measurement */
+    (void)osThreadFlagsWait(1U, osFlagsWaitAny, osWaitForever);
+    stamp = BenchPortCycles();
+  }
+
+  /* Blocks and raises the priority of the mutex owner */
+  (void)osMutexAcquire(mutex_id[pos - 1U], osWaitForever);
+
+  (void)osMutexRelease(mutex_id[pos - 1U]);
+  if (pos < BENCH_MUTEX_CHAIN) {
+    (void)osMutexRelease(mutex_id[pos]);
+  }
+}
+
+/*
+ * Tests, executed by the benchmark thread at osPriorityNormal.
+ */
+
+static void TestOverhead(void)
+{
+  uint32_t start;
+
+  overhead = UINT32_MAX;
+  for (uint32_t i = 0U; i < BENCH_ITERATIONS; i++) {
+    start = BenchPortCycles();
+    start = BenchPortCycles() - start;
+    if (start < overhead) {
+      overhead = start;
+    }
+  }
+
+  PutStr("BENCH,clock,");
+  PutDec(BenchPortCyclesFreq());
+  PutStr("\nBENCH,overhead,");
+  PutDec(overhead);
+  BenchPortPutc('\n');
+}
+
+/* Thread switch by osThreadYield between threads of the same priority */
+static void TestCoopSwitch(void)
+{
+  uint32_t start;
+
+  StatReset(&stat);
+  if (PeerStart(PeerYield, osPriorityNormal)) {
+    for (uint32_t i = 0U; i < BENCH_ITERATIONS; i++) {
+      start = BenchPortCycles();
+      (void)osThreadYield();
+      StatAdd(&stat, start, 2U);
+    }
+    PeerStop();
+  }
+
+  StatReport("coop_switch", &stat);
+}
+
+/* Thread switch to a higher priority thread woken by thread flags */
+static void TestPreemptSwitch(void)
+{
+  StatReset(&stat);
+  if (PeerStart(PeerFlagsWait, osPriorityAboveNormal)) {
+    for (uint32_t i = 0U; i < BENCH_ITERATIONS; i++) {
+      stamp = BenchPortCycles();
+      (void)osThreadFlagsSet(peer_id, 1U);
+    }
+    PeerStop();
+  }
+
+  StatReport("preempt_switch", &stat);
+}
+
+/* Interrupt entry and switch to a thread woken by the interrupt handler */
+static void TestIrqLatency(void)
+{
+  StatReset(&stat);
+  StatReset(&stat_isr);
+  if (PeerStart(PeerIrqWait, osPriorityAboveNormal)) {
+    for (uint32_t i = 0U; i < BENCH_ITERATIONS; i++) {
+      stamp = BenchPortCycles();
+      if (!BenchPortIrqTrigger()) {
+        break;
+      }
+    }
+    PeerStop();
+  }
+
+  StatReport("irq_entry", &stat_isr);
+  StatReport("irq_to_thread", &stat);
+}
+
+/* Semaphore round trip between two threads */
+static void TestSemPingPong(void)
+{
+  uint32_t start;
+
+  StatReset(&stat);
+  if (PeerStart(PeerPingPong, osPriorityAboveNormal)) {
+    for (uint32_t i = 0U; i < BENCH_ITERATIONS; i++) {
+      start = BenchPortCycles();
+      (void)osSemaphoreRelease(sem_a);
+      (void)osSemaphoreAcquire(sem_b, osWaitForever);
+      StatAdd(&stat, start, 1U);
+    }
+    PeerStop();
+  }
+
+  StatReport("sem_pingpong", &stat);
+}
+
+static void TestMessageQueue(void)
+{
+  uint32_t start;
+  uint32_t msg = 0U;
+
+  StatReset(&stat);
+  for (uint32_t i = 0U; i < BENCH_ITERATIONS; i++) {
+    start = BenchPortCycles();
+    for (uint32_t n = 0U; n < MSG_COUNT; n++) {
+      (void)osMessageQueuePut(mq, &msg, 0U, 0U);
+    }
+    for (uint32_t n = 0U; n < MSG_COUNT; n++) {
+      (void)osMessageQueueGet(mq, &msg, NULL, 0U);
+    }
+    StatAdd(&stat, start, MSG_COUNT);
+  }
+
+  StatReport("msgq_put_get", &stat);
+}
+
+static void TestDataQueue(void)
+{
+  uint32_t start;
+  uint32_t data = 0U;
+
+  StatReset(&stat);
+  for (uint32_t i = 0U; i < BENCH_ITERATIONS; i++) {
+    start = BenchPortCycles();
+    for (uint32_t n = 0U; n < MSG_COUNT; n++) {
+      (void)osDataQueuePut(dq, &data, 0U);
+    }
+    for (uint32_t n = 0U; n < MSG_COUNT; n++) {
+      (void)osDataQueueGet(dq, &data, 0U);
+    }
+    StatAdd(&stat, start, MSG_COUNT);
+  }
+
+  StatReport("dataq_put_get", &stat);
+}
+
+static void TestMemoryPool(void)
+{
+  void    *block[MSG_COUNT];
+  uint32_t start;
+
+  StatReset(&stat);
+  for (uint32_t i = 0U; i < BENCH_ITERATIONS; i++) {
+    start = BenchPortCycles();
+    for (uint32_t n = 0U; n < MSG_COUNT; n++) {
+      block[n] = osMemoryPoolAlloc(mp, 0U);
+    }
+    for (uint32_t n = 0U; n < MSG_COUNT; n++) {
+      (void)osMemoryPoolFree(mp, block[n]);
+    }
+    StatAdd(&stat, start, MSG_COUNT);
+  }
+
+  StatReport("mempool_alloc_free", &stat);
+}
+
+/* Start and stop of a timer while BENCH_TIMER_COUNT timers are running */
+static void TestTimer(void)
+{
+  bench_stat_t stop;
+  uint32_t     start;
+  osTimerId_t  timer = timer_id[BENCH_TIMER_COUNT];
+
+  for (uint32_t i = 0U; i < BENCH_TIMER_COUNT; i++) {
+    (void)osTimerStart(timer_id[i], TIMER_TIMEOUT + i);
+  }
+
+  StatReset(&stat);
+  StatReset(&stop);
+  for (uint32_t i = 0U; i < BENCH_ITERATIONS; i++) {
+    start = BenchPortCycles();
+    (void)osTimerStart(timer, TIMER_TIMEOUT + (BENCH_TIMER_COUNT / 2U));
+    StatAdd(&stat, start, 1U);
+
+    start = BenchPortCycles();
+    (void)osTimerStop(timer);
+    StatAdd(&stop, start, 1U);
+  }
+
+  for (uint32_t i = 0U; i < BENCH_TIMER_COUNT; i++) {
+    (void)osTimerStop(timer_id[i]);
+  }
+
+  StatReport("timer_start", &stat);
+  StatReport("timer_stop", &stop);
+}
+
+/* Blocking on a mutex at the head of a priority inheritance chain */
+static void TestMutexChain(void)
+{
+  osThreadAttr_t attr = {
+    .name       = "bench_chain",
+    .attr_bits  = osThreadDetached,
+    .cb_size    = sizeof(osThread_t),
+    .stack_size = BENCH_STACK_SIZE,
+    .threshold  = osPriorityNone,
+  };
+
+  StatReset(&stat);
+  for (uint32_t i = 0U; i < CHAIN_ITERATIONS; i++) {
+    (void)osMutexAcquire(mutex_id[0], osWaitForever);
+
+    /* Each thread preempts, takes its mutex and blocks on the previous one */
+    for (uint32_t n = 0U; n < BENCH_MUTEX_CHAIN; n++) {
+      attr.cb_mem    = &chain_cb[n];
+      attr.stack_mem = &chain_stack[n][0];
+      attr.priority  = (osPriority_t)(osPriorityNormal + 1 + (int32_t)n);
+      chain_id[n] = osThreadNew(ChainThread, (void *)(n + 1U), &attr);
+    }
+
+    if (chain_id[BENCH_MUTEX_CHAIN - 1U] != NULL) {
+      /* Returns when the head of the chain is blocked */
+      (void)osThreadFlagsSet(chain_id[BENCH_MUTEX_CHAIN - 1U], 1U);
+      StatAdd(&stat, stamp, 1U);
+    }
+
+    /* Unwind the chain, all chain threads exit */
+    (void)osMutexRelease(mutex_id[0]);
+  }
+
+  StatReport("mutex_chain", &stat);
+}
+
+__NO_RETURN
+static void BenchThread(void *argument)
+{
+  (void)argument;
+
+  BenchPortInit();
+
+  TestOverhead();
+  TestCoopSwitch();
+  TestPreemptSwitch();
+  TestIrqLatency();
+  TestSemPingPong();
+  TestMessageQueue();
+  TestDataQueue();
+  TestMemoryPool();
+  TestTimer();
+  TestMutexChain();
+
+  PutStr("BENCH,end\n");
+  BenchPortExit();
+
+  for (;;) {
+    (void)osDelay(osWaitForever);
+  }
+}
+
+static void TimerFunc(void *argument)
+{
+  (void)argument;
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+/**
+ * @fn          void BenchIrqHandler(void)
+ * @brief       Benchmark interrupt handler, called by the port.
+ */
+void BenchIrqHandler(void)
+{
+  StatAdd(&stat_isr, stamp, 1U);
+  (void)osSemaphoreRelease(sem_a);
+}
+
+/**
+ * @fn          osStatus_t BenchInit(void)
+ * @brief       Create the benchmark objects and thread, called before osKernelStart.
+ * @return      status code that indicates the execution status of the function.
+ */
+osStatus_t BenchInit(void)
+{
+  osThreadAttr_t thread_attr = {
+    .name       = "bench",
+    .attr_bits  = osThreadDetached,
+    .cb_mem     = &bench_cb,
+    .cb_size    = sizeof(bench_cb),
+    .stack_mem  = &bench_stack[0],
+    .stack_size = sizeof(bench_stack),
+    .priority   = osPriorityNormal,
+    .threshold  = osPriorityNone,
+  };
+  osSemaphoreAttr_t sem_attr = {
+    .name    = NULL,
+    .cb_size = sizeof(osSemaphore_t),
+  };
+  osMutexAttr_t mutex_attr = {
+    .name      = NULL,
+    .attr_bits = osMutexPrioInherit,
+    .cb_size   = sizeof(osMutex_t),
+  };
+  const osMessageQueueAttr_t mq_attr = {
+    .name    = NULL,
+    .cb_mem  = &mq_cb,
+    .cb_size = sizeof(mq_cb),
+    .mq_mem  = &mq_mem[0],
+    .mq_size = sizeof(mq_mem),
+  };
+  const osDataQueueAttr_t dq_attr = {
+    .name    = NULL,
+    .cb_mem  = &dq_cb,
+    .cb_size = sizeof(dq_cb),
+    .dq_mem  = &dq_mem[0],
+    .dq_size = sizeof(dq_mem),
+  };
+  const osMemoryPoolAttr_t mp_attr = {
+    .name    = NULL,
+    .cb_mem  = &mp_cb,
+    .cb_size = sizeof(mp_cb),
+    .mp_mem  = &mp_mem[0],
+    .mp_size = sizeof(mp_mem),
+  };
+  osTimerAttr_t timer_attr = {
+    .name    = NULL,
+    .cb_size = sizeof(osTimer_t),
+  };
+
+  sem_attr.cb_mem = &sem_a_cb;
+  sem_a = osSemaphoreNew(1U, 0U, &sem_attr);
+  sem_attr.cb_mem = &sem_b_cb;
+  sem_b = osSemaphoreNew(1U, 0U, &sem_attr);
+  if ((sem_a == NULL) || (sem_b == NULL)) {
+    return (osErrorResource);
+  }
+
+  for (uint32_t i = 0U; i < BENCH_MUTEX_CHAIN; i++) {
+    mutex_attr.cb_mem = &mutex_cb[i];
+    mutex_id[i] = osMutexNew(&mutex_attr);
+    if (mutex_id[i] == NULL) {
+      return (osErrorResource);
+    }
+  }
+
+  mq = osMessageQueueNew(MSG_COUNT, sizeof(uint32_t), &mq_attr);
+  dq = osDataQueueNew(MSG_COUNT, sizeof(uint32_t), &dq_attr);
+  mp = osMemoryPoolNew(MSG_COUNT, 32U, &mp_attr);
+  if ((mq == NULL) || (dq == NULL) || (mp == NULL)) {
+    return (osErrorResource);
+  }
+
+  for (uint32_t i = 0U; i <= BENCH_TIMER_COUNT; i++) {
+    timer_attr.cb_mem = &timer_cb[i];
+    timer_id[i] = osTimerNew(TimerFunc, osTimerOnce, NULL, &timer_attr);
+    if (timer_id[i] == NULL) {
+      return (osErrorResource);
+    }
+  }
+
+  if (osThreadNew(BenchThread, NULL, &thread_attr) == NULL) {
+    return (osErrorResource);
+  }
+
+  return (osOK);
+}
+
+/*------------------------------ End of file ---------------------------------*/
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: mbOS real-time kernel
+ */
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <Kernel/kernel.h>
+
+/*******************************************************************************
+ *  defines and macros
+ ******************************************************************************/
+
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS              (1000U)     ///< Iterations of a test
+#endif
+
+#ifndef BENCH_STACK_SIZE
+#define BENCH_STACK_SIZE              (1024U)     ///< Stack size of a benchmark thread
+#endif
+
+#ifndef BENCH_TIMER_COUNT
+#define BENCH_TIMER_COUNT             (64U)       ///< Timers running during the timer test
+#endif
+
+#ifndef BENCH_MUTEX_CHAIN
+#define BENCH_MUTEX_CHAIN             (4U)        ///< Threads blocked in the mutex chain
+#endif
+
+/*******************************************************************************
+ *  exported function prototypes
+ ******************************************************************************/
+
+/**
+ * @fn          osStatus_t BenchInit(void)
+ * @brief       Create the benchmark thread, called before osKernelStart.
+ * @return      status code that indicates the execution status of the function.
+ */
+osStatus_t BenchInit(void);
+
+/**
+ * @fn          void BenchIrqHandler(void)
+ * @brief       Benchmark interrupt handler, called by the port.
+ */
+void BenchIrqHandler(void);
+
+/*
+ * Port interface, one implementation per target.
+ */
+
+/**
+ * @fn          void BenchPortInit(void)
+ * @brief       Initialize the cycle counter, the output and the test interrupt.
+ */
+void BenchPortInit(void);
+
+/**
+ * @fn          uint32_t BenchPortCycles(void)
+ * @brief       Read the free running cycle counter.
+ * @return      counter value.
+ */
+uint32_t BenchPortCycles(void);
+
+/**
+ * @fn          uint32_t BenchPortCyclesFreq(void)
+ * @brief       Get the cycle counter frequency.
+ * @return      frequency in Hz.
+ */
+uint32_t BenchPortCyclesFreq(void);
+
+/**
+ * @fn          void BenchPortPutc(char ch)
+ * @brief       Output a character of the report.
+ * @param[in]   ch  character.
+ */
+void BenchPortPutc(char ch);
+
+/**
+ * @fn          bool BenchPortIrqTrigger(void)
+ * @brief       Pend the test interrupt, its handler calls BenchIrqHandler.
+ * @return      true - interrupt pended, false - not supported by the port.
+ */
+bool BenchPortIrqTrigger(void);
+
+/**
+ * @fn          void BenchPortExit(void)
+ * @brief       Called when all tests are completed.
+ */
+void BenchPortExit(void);
+
+#endif /* BENCH_H_ */
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: mbOS real-time kernel
+ */
+
+/**
+ * @file
+ *
+ * Kernel micro-benchmark suite, Cortex-M port.
+ *
+ * Cycles are counted by the DWT cycle counter. Cores without the counter, and
+ * QEMU which does not model it, fall back to the kernel system timer.
+ *
+ * The report is written through semihosting, which needs a debugger or QEMU
+ * started with semihosting enabled. Define BENCH_SEMIHOSTING to 0 to write it
+ * to ITM stimulus port 0 (SWO) instead.
+ *
+ * The interrupt tests need a free interrupt line: define BENCH_IRQn and
+ * BENCH_IRQ_HANDLER with the interrupt number and the name of its handler in
+ * the vector table of the device, see projects/GCC/Makefile for mps2-an385.
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <Kernel/tick.h>
+
+#include "bench.h"
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#ifndef BENCH_SEMIHOSTING
+#define BENCH_SEMIHOSTING             (1)
+#endif
+
+#define DEMCR                         (*(volatile uint32_t *)0xE000EDFCU)
+#define DEMCR_TRCENA                  (1UL << 24)
+#define DWT_CTRL                      (*(volatile uint32_t *)0xE0001000U)
+#define DWT_CTRL_CYCCNTENA            (1UL << 0)
+#define DWT_CTRL_NOCYCCNT             (1UL << 25)
+#define DWT_CYCCNT                    (*(volatile uint32_t *)0xE0001004U)
+#define ITM_PORT0                     (*(volatile uint32_t *)0xE0000000U)
+#define ITM_TER                       (*(volatile uint32_t *)0xE0000E00U)
+#define NVIC_ISER                     ((volatile uint32_t *)0xE000E100U)
+#define NVIC_ISPR                     ((volatile uint32_t *)0xE000E200U)
+#define NVIC_IPR                      ((volatile uint8_t  *)0xE000E400U)
+
+#define SYS_WRITEC                    (0x03U)
+#define SYS_EXIT                      (0x18U)
+#define ADP_STOPPED_APP_EXIT          (0x20026U)
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static bool dwt_present;
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+#if (BENCH_SEMIHOSTING != 0)
+static void SemihostingCall(uint32_t op, uint32_t param)
+{
+  register uint32_t r0 __asm("r0") = op;
+  register uint32_t r1 __asm("r1") = param;
+
+  __asm volatile ("bkpt 0xAB" : "+r"(r0) : "r"(r1) : "memory");
+}
+#endif
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+void BenchPortInit(void)
+{
+  uint32_t start;
+
+  DEMCR |= DEMCR_TRCENA;
+
+  if ((DWT_CTRL & DWT_CTRL_NOCYCCNT) == 0U) {
+    DWT_CYCCNT = 0U;
+    DWT_CTRL  |= DWT_CTRL_CYCCNTENA;
+
+    /* Check that the counter runs */
+    start = DWT_CYCCNT;
+    for (volatile uint32_t i = 0U; i < 16U; i++) {
+    }
+    dwt_present = (DWT_CYCCNT != start);
+  }
+
+#if (BENCH_SEMIHOSTING == 0)
+  ITM_TER |= 1U;
+#endif
+
+#ifdef BENCH_IRQn
+  NVIC_IPR[BENCH_IRQn] = 0xFFU;
+  NVIC_ISER[(uint32_t)BENCH_IRQn >> 5] = 1UL << ((uint32_t)BENCH_IRQn & 0x1FU);
+#endif
+}
+
+uint32_t BenchPortCycles(void)
+{
+  if (dwt_present) {
+    return (DWT_CYCCNT);
+  }
+
+  return (osKernelGetSysTimerCount());
+}
+
+uint32_t BenchPortCyclesFreq(void)
+{
+  if (dwt_present) {
+    return (SystemCoreClock);
+  }
+
+  return (osKernelGetSysTimerFreq());
+}
+
+void BenchPortPutc(char ch)
+{
+#if (BENCH_SEMIHOSTING != 0)
+  SemihostingCall(SYS_WRITEC, (uint32_t)&ch);
+#else
+  if ((ITM_TER & 1U) != 0U) {
+    while (ITM_PORT0 == 0U) {
+    }
+    *(volatile uint8_t *)&ITM_PORT0 = (uint8_t)ch;
+  }
+#endif
+}
+
+bool BenchPortIrqTrigger(void)
+{
+#ifdef BENCH_IRQn
+  NVIC_ISPR[(uint32_t)BENCH_IRQn >> 5] = 1UL << ((uint32_t)BENCH_IRQn & 0x1FU);
+  return (true);
+#else
+  return (false);
+#endif
+}
+
+void BenchPortExit(void)
+{
+#if (BENCH_SEMIHOSTING != 0)
+  SemihostingCall(SYS_EXIT, ADP_STOPPED_APP_EXIT);
+#endif
+}
+
+#ifdef BENCH_IRQ_HANDLER
+void BENCH_IRQ_HANDLER(void)
+{
+  BenchIrqHandler();
+}
+#endif
+
+/*------------------------------ End of file ---------------------------------*/
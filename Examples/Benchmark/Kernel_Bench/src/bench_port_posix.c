@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: mbOS real-time kernel
+ */
+
+/**
+ * @file
+ *
+ * Kernel micro-benchmark suite, POSIX host port.
+ *
+ * Cycles are nanoseconds of the monotonic clock. Build with gcc -m32 and
+ * -DBENCH_STACK_SIZE=16384, the host C library needs larger stacks
+ * (Examples/Host/Kernel_Test/Makefile). The test interrupt is the software
+ * interrupt line BENCH_IRQ of the host port.
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <Core/Posix/irq_posix.h>
+
+#include "bench.h"
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#define BENCH_IRQ                     (0)
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+void BenchPortInit(void)
+{
+  (void)IRQ_Initialize();
+  (void)IRQ_SetHandler(BENCH_IRQ, BenchIrqHandler);
+  (void)IRQ_Enable(BENCH_IRQ);
+}
+
+uint32_t BenchPortCycles(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((uint32_t)ts.tv_sec * 1000000000U + (uint32_t)ts.tv_nsec);
+}
+
+uint32_t BenchPortCyclesFreq(void)
+{
+  return (1000000000U);
+}
+
+void BenchPortPutc(char ch)
+{
+  (void)write(STDOUT_FILENO, &ch, 1U);
+}
+
+bool BenchPortIrqTrigger(void)
+{
+  return (IRQ_SetPending(BENCH_IRQ) == 0);
+}
+
+void BenchPortExit(void)
+{
+  exit(0);
+}
+
+/*------------------------------ End of file ---------------------------------*/
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: mbOS real-time kernel
+ */
+
+/**
+ * @file
+ *
+ * Kernel micro-benchmark suite, application entry.
+ *
+ * Build bench.c and main.c with the kernel, the startup code of the target
+ * and one port: bench_port_cm.c (Cortex-M) or bench_port_posix.c (host port,
+ * gcc -m32).
+ *
+ * projects/GCC builds the Cortex-M port for the QEMU model of the Arm MPS2
+ * AN385 board (Cortex-M3) and runs it with run_qemu.sh. The host port is
+ * built by Examples/Host/Kernel_Test/Makefile.
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include "bench.h"
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+int main(void)
+{
+  if ((osKernelInitialize() == osOK) && (BenchInit() == osOK)) {
+    /* Start RTOS */
+    (void)osKernelStart();
+  }
+
+  return (-1);
+}
+
+/*------------------------------ End of file ---------------------------------*/
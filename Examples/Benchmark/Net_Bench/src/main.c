@@ -0,0 +1,541 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: mbOS real-time kernel
+ */
+
+/**
+ * @file
+ *
+ * Network stack throughput benchmark on the host port.
+ *
+ * lwIP runs on Driver_ETH_MAC_Loop0 through the network interface of
+ * Middleware/lwIP/port. A peer thread owns the other end of the wire,
+ * Driver_ETH_MAC_Loop1, and works on raw frames: it answers ARP, sinks the UDP
+ * datagrams the stack sends and generates the datagrams the stack receives.
+ *
+ * Build main.c with the kernel, the host port (gcc -m32), the lwIP core and
+ * api sources, sys_arch.c, eth_netif.c and eth_mac_loop.c. Take lwipopts.h
+ * from Middleware/lwIP/template and define TCPIP_THREAD_STACKSIZE,
+ * DEFAULT_THREAD_STACKSIZE and ETH_NETIF_STACK_SIZE as 16384, MEM_SIZE as
+ * 131072, the host C library needs larger stacks. Each test prints one line
+ *
+ *   BENCH,<test>,<frames>,<bytes>,<ms>,<kbit/s>
+ *
+ * and the run ends with "BENCH,end".
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <Kernel/kernel.h>
+
+#include "lwip/api.h"
+#include "lwip/tcpip.h"
+#include "lwip/netif.h"
+#include "eth_netif.h"
+#include "eth_mac_loop.h"
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#ifndef NET_BENCH_FRAMES
+#define NET_BENCH_FRAMES              (10000U)    ///< Datagrams of a test
+#endif
+
+#ifndef NET_BENCH_PAYLOAD
+#define NET_BENCH_PAYLOAD             (1024U)     ///< UDP payload size
+#endif
+
+#ifndef NET_BENCH_STACK_SIZE
+#define NET_BENCH_STACK_SIZE          (16384U)    ///< Stack size of the benchmark threads
+#endif
+
+#define PORT_SINK                     (9U)        ///< Peer port of the transmit test
+#define PORT_SOURCE                   (7000U)     ///< Stack port of the receive test
+
+#define TAG_DATA                      (0x00U)     ///< First payload byte of a counted datagram
+#define TAG_END                       (0xFFU)     ///< First payload byte of the end marker
+
+#define FLAG_PEER_RX                  (1U << 0)   ///< Peer: frame received
+#define FLAG_PEER_SOURCE              (1U << 1)   ///< Peer: start the receive test
+#define FLAG_PEER_STOP                (1U << 2)   ///< Peer: end marker seen by the stack
+#define FLAG_APP_DONE                 (1U << 0)   ///< Application: end marker seen by the peer
+
+#define ETH_HDR_LEN                   (14U)
+#define IP_HDR_LEN                    (20U)
+#define UDP_HDR_LEN                   (8U)
+#define ARP_FRAME_LEN                 (42U)
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static const uint8_t app_mac[6]  = { 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U };
+static const uint8_t peer_mac[6] = { 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U };
+static const uint8_t app_ip[4]   = { 10U, 0U, 0U, 1U };
+static const uint8_t peer_ip[4]  = { 10U, 0U, 0U, 2U };
+
+static ARM_DRIVER_ETH_MAC *const peer = &Driver_ETH_MAC_Loop1;
+
+static struct netif      app_netif;
+static EthNetif_t        app_eth = {
+  .mac      = &Driver_ETH_MAC_Loop0,
+  .phy      = &Driver_ETH_PHY_Loop,
+  .priority = osPriorityAboveNormal,
+};
+
+static osThreadId_t      app_id;
+static osThread_t        app_cb;
+static uint64_t          app_stack[NET_BENCH_STACK_SIZE/8U];
+
+static osThreadId_t      peer_id;
+static osThread_t        peer_cb;
+static uint64_t          peer_stack[NET_BENCH_STACK_SIZE/8U];
+
+/* Sink counters of the peer */
+static volatile uint32_t sink_frames;
+static volatile uint32_t sink_bytes;
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+static uint32_t TicksToMs(uint32_t ticks)
+{
+  return ((uint32_t)(((uint64_t)ticks * 1000U) / osKernelGetTickFreq()));
+}
+
+static void Report(const char *test, uint32_t frames, uint32_t bytes, uint32_t ticks)
+{
+  uint32_t ms = TicksToMs(ticks);
+
+  if (ms == 0U) {
+    ms = 1U;
+  }
+
+  printf("BENCH,%s,%u,%u,%u,%u\n", test, (unsigned)frames, (unsigned)bytes, (unsigned)ms,
+         (unsigned)(((uint64_t)bytes * 8U) / ms));
+}
+
+static void Put16(uint8_t *p, uint32_t val)
+{
+  p[0] = (uint8_t)(val >> 8);
+  p[1] = (uint8_t)val;
+}
+
+static uint32_t Get16(const uint8_t *p)
+{
+  return (((uint32_t)p[0] << 8) | p[1]);
+}
+
+static uint32_t IpChecksum(const uint8_t *hdr)
+{
+  uint32_t sum = 0U;
+
+  for (uint32_t i = 0U; i < IP_HDR_LEN; i += 2U) {
+    sum += Get16(&hdr[i]);
+  }
+  while ((sum >> 16) != 0U) {
+    sum = (sum & 0xFFFFU) + (sum >> 16);
+  }
+
+  return (~sum & 0xFFFFU);
+}
+
+/**
+ * @fn          void PeerSend(const uint8_t *frame, uint32_t len)
+ * @brief       Send a frame of the peer, built in the transmit buffer or elsewhere.
+ */
+static void PeerSend(const uint8_t *frame, uint32_t len)
+{
+  while (peer->SendFrame(frame, len, 0U) == ARM_DRIVER_ERROR_BUSY) {
+    (void)osThreadYield();
+  }
+  (void)peer->Control(ETH_MAC_TX_RECLAIM, 0U);
+}
+
+/**
+ * @fn          void PeerUdp(uint8_t tag, uint32_t len)
+ * @brief       Send a UDP datagram from the peer to the stack, checksum 0.
+ * @param[in]   tag  First payload byte
+ * @param[in]   len  Payload length
+ */
+static void PeerUdp(uint8_t tag, uint32_t len)
+{
+  static uint16_t   ident;
+  ETH_MAC_FRAME_BUF fb;
+  uint8_t          *f, *ip, *udp;
+
+  if (peer->Control(ETH_MAC_TX_BUFFER_GET, (uint32_t)&fb) != ARM_DRIVER_OK) {
+    return;
+  }
+  f   = fb.data;
+  ip  = &f[ETH_HDR_LEN];
+  udp = &ip[IP_HDR_LEN];
+
+  memcpy(&f[0], app_mac, 6U);
+  memcpy(&f[6], peer_mac, 6U);
+  Put16(&f[12], 0x0800U);
+
+  memset(ip, 0, IP_HDR_LEN);
+  ip[0] = 0x45U;
+  Put16(&ip[2], IP_HDR_LEN + UDP_HDR_LEN + len);
+  Put16(&ip[4], ident++);
+  ip[8] = 64U;
+  ip[9] = 17U;
+  memcpy(&ip[12], peer_ip, 4U);
+  memcpy(&ip[16], app_ip, 4U);
+  Put16(&ip[10], IpChecksum(ip));
+
+  Put16(&udp[0], PORT_SOURCE);
+  Put16(&udp[2], PORT_SOURCE);
+  Put16(&udp[4], UDP_HDR_LEN + len);
+  Put16(&udp[6], 0U);
+  memset(&udp[UDP_HDR_LEN], tag, len);
+
+  PeerSend(f, ETH_HDR_LEN + IP_HDR_LEN + UDP_HDR_LEN + len);
+}
+
+/**
+ * @fn          void PeerFrame(const uint8_t *f, uint32_t len)
+ * @brief       Handle a frame received by the peer.
+ */
+static void PeerFrame(const uint8_t *f, uint32_t len)
+{
+  uint8_t        arp[ARP_FRAME_LEN];
+  const uint8_t *ip  = &f[ETH_HDR_LEN];
+  const uint8_t *udp = &ip[IP_HDR_LEN];
+
+  if (len < ARP_FRAME_LEN) {
+    return;
+  }
+
+  /* ARP request for the peer address */
+  if ((Get16(&f[12]) == 0x0806U) && (Get16(&f[20]) == 1U) && (memcmp(&f[38], peer_ip, 4U) == 0)) {
+    memcpy(&arp[0], &f[22], 6U);
+    memcpy(&arp[6], peer_mac, 6U);
+    Put16(&arp[12], 0x0806U);
+    Put16(&arp[14], 1U);
+    Put16(&arp[16], 0x0800U);
+    arp[18] = 6U;
+    arp[19] = 4U;
+    Put16(&arp[20], 2U);
+    memcpy(&arp[22], peer_mac, 6U);
+    memcpy(&arp[28], peer_ip, 4U);
+    memcpy(&arp[32], &f[22], 10U);
+    PeerSend(arp, ARP_FRAME_LEN);
+    return;
+  }
+
+  /* UDP datagram to the sink port */
+  if ((Get16(&f[12]) == 0x0800U) && (ip[9] == 17U) &&
+      (len > (ETH_HDR_LEN + IP_HDR_LEN + UDP_HDR_LEN)) && (Get16(&udp[2]) == PORT_SINK)) {
+    if (udp[UDP_HDR_LEN] == TAG_END) {
+      (void)osThreadFlagsSet(app_id, FLAG_APP_DONE);
+    }
+    else {
+      sink_frames++;
+      sink_bytes += Get16(&udp[4]) - UDP_HDR_LEN;
+    }
+  }
+}
+
+static void PeerEvent(uint32_t event)
+{
+  if ((event & ARM_ETH_MAC_EVENT_RX_FRAME) != 0U) {
+    (void)osThreadFlagsSet(peer_id, FLAG_PEER_RX);
+  }
+}
+
+/**
+ * @fn          void PeerReceive(void)
+ * @brief       Handle all received frames in place.
+ */
+static void PeerReceive(void)
+{
+  ETH_MAC_FRAME_BUF fb;
+  uint32_t          size;
+
+  while ((size = peer->GetRxFrameSize()) != 0U) {
+    if (peer->Control(ETH_MAC_RX_FRAME_BORROW, (uint32_t)&fb) == ARM_DRIVER_OK) {
+      PeerFrame(fb.data, fb.len);
+      (void)peer->Control(ETH_MAC_RX_FRAME_RETURN, (uint32_t)fb.data);
+    }
+    else {
+      (void)peer->ReadFrame(NULL, 0U);
+    }
+  }
+}
+
+/**
+ * @fn          void PeerThread(void *argument)
+ * @brief       Far end of the wire.
+ */
+static void PeerThread(void *argument)
+{
+  uint32_t flags;
+
+  (void)argument;
+
+  for (;;) {
+    flags = osThreadFlagsWait(FLAG_PEER_RX | FLAG_PEER_SOURCE, osFlagsWaitAny, osWaitForever);
+
+    if ((flags & FLAG_PEER_RX) != 0U) {
+      PeerReceive();
+    }
+
+    if ((flags & FLAG_PEER_SOURCE) != 0U) {
+      for (uint32_t i = 0U; i < NET_BENCH_FRAMES; i++) {
+        PeerUdp(TAG_DATA, NET_BENCH_PAYLOAD);
+      }
+      /* Repeat the end marker until the stack saw it, datagrams may be dropped */
+      do {
+        PeerUdp(TAG_END, 1U);
+        flags = osThreadFlagsWait(FLAG_PEER_STOP, osFlagsWaitAny, 1U);
+      } while ((flags & osFlagsError) != 0U);
+    }
+  }
+}
+
+static void NetInitDone(void *arg)
+{
+  (void)osSemaphoreRelease((osSemaphoreId_t)arg);
+}
+
+/**
+ * @fn          bool NetInit(void)
+ * @brief       Start lwIP and bring up the interface.
+ */
+static bool NetInit(void)
+{
+  static osSemaphore_t sem_cb;
+  const osSemaphoreAttr_t sem_attr = {
+    .cb_mem  = &sem_cb,
+    .cb_size = sizeof(sem_cb),
+  };
+  osSemaphoreId_t sem;
+  ip4_addr_t      addr, mask, gw;
+  struct netif   *netif;
+
+  sem = osSemaphoreNew(1U, 0U, &sem_attr);
+  tcpip_init(NetInitDone, sem);
+  (void)osSemaphoreAcquire(sem, osWaitForever);
+  (void)osSemaphoreDelete(sem);
+
+  IP4_ADDR(&addr, app_ip[0], app_ip[1], app_ip[2], app_ip[3]);
+  IP4_ADDR(&mask, 255U, 255U, 255U, 0U);
+  ip4_addr_set_zero(&gw);
+
+  LOCK_TCPIP_CORE();
+  netif = netif_add(&app_netif, &addr, &mask, &gw, &app_eth, EthNetif_Init, tcpip_input);
+  if (netif != NULL) {
+    netif_set_default(netif);
+    netif_set_up(netif);
+  }
+  UNLOCK_TCPIP_CORE();
+
+  if (netif == NULL) {
+    return (false);
+  }
+
+  while (!netif_is_link_up(&app_netif)) {
+    (void)osDelay(1U);
+  }
+
+  return (true);
+}
+
+/**
+ * @fn          void AppSend(struct netconn *conn, uint8_t tag, uint32_t len)
+ * @brief       Send a datagram from the stack to the peer.
+ * @param[in]   conn  Connection
+ * @param[in]   tag   First payload byte
+ * @param[in]   len   Payload length
+ */
+static void AppSend(struct netconn *conn, uint8_t tag, uint32_t len)
+{
+  struct netbuf *buf;
+  void          *data;
+
+  for (;;) {
+    buf  = netbuf_new();
+    data = (buf != NULL) ? netbuf_alloc(buf, (u16_t)len) : NULL;
+    if (data != NULL) {
+      break;
+    }
+    /* Heap exhausted by frames in flight */
+    if (buf != NULL) {
+      netbuf_delete(buf);
+    }
+    (void)osDelay(1U);
+  }
+
+  memset(data, tag, len);
+  (void)netconn_send(conn, buf);
+  netbuf_delete(buf);
+}
+
+/**
+ * @fn          void TestUdpTx(void)
+ * @brief       Stack sends datagrams, the peer sinks them.
+ */
+static void TestUdpTx(void)
+{
+  struct netconn *conn;
+  ip_addr_t       dst;
+  uint32_t        start;
+
+  IP_ADDR4(&dst, peer_ip[0], peer_ip[1], peer_ip[2], peer_ip[3]);
+
+  conn = netconn_new(NETCONN_UDP);
+  if ((conn == NULL) || (netconn_connect(conn, &dst, PORT_SINK) != ERR_OK)) {
+    return;
+  }
+
+  sink_frames = 0U;
+  sink_bytes  = 0U;
+  (void)osThreadFlagsClear(FLAG_APP_DONE);
+
+  start = osKernelGetTickCount();
+
+  for (uint32_t i = 0U; i < NET_BENCH_FRAMES; i++) {
+    AppSend(conn, TAG_DATA, NET_BENCH_PAYLOAD);
+  }
+  /* Repeat the end marker until the peer saw it, datagrams may be dropped */
+  do {
+    AppSend(conn, TAG_END, 1U);
+  } while ((osThreadFlagsWait(FLAG_APP_DONE, osFlagsWaitAny, 1U) & osFlagsError) != 0U);
+
+  Report("udp_tx", sink_frames, sink_bytes, osKernelGetTickCount() - start);
+
+  (void)netconn_delete(conn);
+}
+
+/**
+ * @fn          void TestUdpRx(void)
+ * @brief       Peer sends datagrams, the stack receives them.
+ */
+static void TestUdpRx(void)
+{
+  struct netconn *conn;
+  struct netbuf  *buf;
+  uint32_t        frames = 0U;
+  uint32_t        bytes = 0U;
+  uint32_t        start;
+  void           *data;
+  u16_t           len;
+  bool            end = false;
+
+  conn = netconn_new(NETCONN_UDP);
+  if ((conn == NULL) || (netconn_bind(conn, IP4_ADDR_ANY, PORT_SOURCE) != ERR_OK)) {
+    return;
+  }
+
+  start = osKernelGetTickCount();
+  (void)osThreadFlagsSet(peer_id, FLAG_PEER_SOURCE);
+
+  while (!end && (netconn_recv(conn, &buf) == ERR_OK)) {
+    if ((netbuf_data(buf, &data, &len) == ERR_OK) && (len != 0U)) {
+      if (((const uint8_t *)data)[0] == TAG_END) {
+        end = true;
+      }
+      else {
+        frames++;
+        bytes += netbuf_len(buf);
+      }
+    }
+    netbuf_delete(buf);
+  }
+
+  Report("udp_rx", frames, bytes, osKernelGetTickCount() - start);
+
+  (void)osThreadFlagsSet(peer_id, FLAG_PEER_STOP);
+  (void)netconn_delete(conn);
+}
+
+/**
+ * @fn          void AppThread(void *argument)
+ * @brief       Benchmark thread.
+ */
+static void AppThread(void *argument)
+{
+  (void)argument;
+
+  /* Peer end of the wire, accepts the frames for its address and broadcasts */
+  (void)peer->Initialize(PeerEvent);
+  (void)peer->PowerControl(ARM_POWER_FULL);
+  (void)peer->Control(ARM_ETH_MAC_CONFIGURE, ARM_ETH_MAC_SPEED_100M | ARM_ETH_MAC_DUPLEX_FULL |
+                                             ARM_ETH_MAC_ADDRESS_BROADCAST);
+  (void)peer->Control(ARM_ETH_MAC_CONTROL_TX, 1U);
+  (void)peer->Control(ARM_ETH_MAC_CONTROL_RX, 1U);
+
+  if (NetInit()) {
+    TestUdpTx();
+    TestUdpRx();
+  }
+
+  printf("BENCH,end\n");
+  (void)fflush(stdout);
+
+  for (;;) {
+    (void)osDelay(osWaitForever - 1U);
+  }
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+int main(void)
+{
+  const osThreadAttr_t app_attr = {
+    .name       = "app",
+    .cb_mem     = &app_cb,
+    .cb_size    = sizeof(app_cb),
+    .stack_mem  = app_stack,
+    .stack_size = sizeof(app_stack),
+    .priority   = osPriorityNormal,
+  };
+  const osThreadAttr_t peer_attr = {
+    .name       = "peer",
+    .cb_mem     = &peer_cb,
+    .cb_size    = sizeof(peer_cb),
+    .stack_mem  = peer_stack,
+    .stack_size = sizeof(peer_stack),
+    .priority   = osPriorityNormal,
+  };
+
+  if (osKernelInitialize() == osOK) {
+    app_id  = osThreadNew(AppThread, NULL, &app_attr);
+    peer_id = osThreadNew(PeerThread, NULL, &peer_attr);
+    if ((app_id != NULL) && (peer_id != NULL)) {
+      /* Start RTOS */
+      (void)osKernelStart();
+    }
+  }
+
+  return (-1);
+}
+
+/*------------------------------ End of file ---------------------------------*/
@@ -88,6 +88,15 @@
 #define OS_PRIVILEGE_MODE           1
 #endif
 
+//   <q>Direct kernel calls from privileged threads
+//   <i> Privileged threads call kernel functions directly with SVC, PendSV
+//   <i> and SysTick masked instead of executing the SVC instruction.
+//   <i> Thread switch is requested through PendSV.
+//   <i> Used on ARMv7-M and ARMv8-M Mainline only.
+#ifndef OS_DIRECT_CALL
+#define OS_DIRECT_CALL              0
+#endif
+
 // </h>
 
 // <h>Timer Configuration
@@ -73,6 +73,9 @@ const osConfig_t osConfig __attribute__((section(".rodata"))) = {
 #endif
 #if (OS_STACK_WATERMARK != 0)
   | osConfigStackWatermark
+#endif
+#if (OS_DIRECT_CALL != 0)
+  | osConfigDirectCall
 #endif
   ,
   (uint32_t)OS_TICK_FREQ,
@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * File Name  :	stm32f4_example_syscall_bench.c
+ * Description:	Kernel call overhead benchmark (SVC and direct call modes).
+ *
+ *              Select the mode with OS_DIRECT_CALL in kernel_config.h and
+ *              read bench_result with the debugger when the green LED is on.
+ *              All values are CPU cycles per iteration.
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <Driver/GPIO_STM32F4xx.h>
+#include <asm/stm32f4xx.h>
+#include <asm/system_stm32f4xx.h>
+#include <Kernel/kernel.h>
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#define BENCH_ITERATIONS              (1000U)
+
+#define THREAD_STACK_SIZE             (512U)
+
+#define LED_PORT                      GPIO_PORT_D
+#define LED_GREEN                     GPIO_PIN_12
+#define LED_RED                       GPIO_PIN_14
+
+/*******************************************************************************
+ *  typedefs and structures (scope: module-local)
+ ******************************************************************************/
+
+typedef struct {
+  uint32_t direct_call;       ///< 1 - direct call mode, 0 - SVC mode
+  uint32_t overhead;          ///< Cycle counter read overhead
+  uint32_t thread_flags_get;  ///< osThreadFlagsGet
+  uint32_t sem_release_get;   ///< osSemaphoreRelease + osSemaphoreAcquire (no wait)
+  uint32_t event_set_clear;   ///< osEventFlagsSet + osEventFlagsClear (no waiters)
+  uint32_t sem_switch;        ///< osSemaphoreRelease waking a higher priority thread
+} bench_result_t;
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static volatile bench_result_t bench_result;
+
+static osThreadId_t         threadBench;
+static osThread_t           threadBench_cb;
+static uint64_t             threadBench_stack[THREAD_STACK_SIZE/8U];
+static const osThreadAttr_t threadBench_attr = {
+    .name       = NULL,
+    .attr_bits  = 0U,
+    .cb_mem     = &threadBench_cb,
+    .cb_size    = sizeof(threadBench_cb),
+    .stack_mem  = &threadBench_stack[0],
+    .stack_size = sizeof(threadBench_stack),
+    .priority   = osPriorityNormal,
+};
+
+static osThreadId_t         threadPeer;
+static osThread_t           threadPeer_cb;
+static uint64_t             threadPeer_stack[THREAD_STACK_SIZE/8U];
+static const osThreadAttr_t threadPeer_attr = {
+    .name       = NULL,
+    .attr_bits  = 0U,
+    .cb_mem     = &threadPeer_cb,
+    .cb_size    = sizeof(threadPeer_cb),
+    .stack_mem  = &threadPeer_stack[0],
+    .stack_size = sizeof(threadPeer_stack),
+    .priority   = osPriorityAboveNormal,
+};
+
+static osSemaphoreId_t         sem;
+static osSemaphore_t           sem_cb;
+static const osSemaphoreAttr_t sem_attr = {
+    .name      = NULL,
+    .attr_bits = 0U,
+    .cb_mem    = &sem_cb,
+    .cb_size   = sizeof(sem_cb)
+};
+
+static osSemaphoreId_t         sem_peer;
+static osSemaphore_t           sem_peer_cb;
+static const osSemaphoreAttr_t sem_peer_attr = {
+    .name      = NULL,
+    .attr_bits = 0U,
+    .cb_mem    = &sem_peer_cb,
+    .cb_size   = sizeof(sem_peer_cb)
+};
+
+static osEventFlagsId_t         event;
+static osEventFlags_t           event_cb;
+static const osEventFlagsAttr_t event_attr = {
+    .name      = NULL,
+    .attr_bits = 0U,
+    .cb_mem    = &event_cb,
+    .cb_size   = sizeof(event_cb)
+};
+
+static const GPIO_PIN_CFG_t LED_cfg = {
+    GPIO_MODE_OUT_PP,
+    GPIO_PULL_DISABLE,
+    GPIO_SPEED_LOW
+};
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+static uint32_t CycleCount(void)
+{
+  return (DWT->CYCCNT);
+}
+
+static uint32_t CycleAverage(uint32_t start, uint32_t stop, uint32_t overhead)
+{
+  return (((stop - start) / BENCH_ITERATIONS) - overhead);
+}
+
+__NO_RETURN
+static void threadPeer_func(void *param)
+{
+  (void) param;
+
+  for (;;) {
+    osSemaphoreAcquire(sem_peer, osWaitForever);
+  }
+}
+
+__NO_RETURN
+static void threadBench_func(void *param)
+{
+  (void)   param;
+  uint32_t start;
+  uint32_t stop;
+  uint32_t i;
+
+  bench_result.direct_call = ((osConfig.flags & osConfigDirectCall) != 0U) ? 1U : 0U;
+
+  start = CycleCount();
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    __NOP();
+  }
+  stop = CycleCount();
+  bench_result.overhead = CycleAverage(start, stop, 0U);
+
+  start = CycleCount();
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    (void)osThreadFlagsGet();
+  }
+  stop = CycleCount();
+  bench_result.thread_flags_get = CycleAverage(start, stop, bench_result.overhead);
+
+  start = CycleCount();
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    (void)osSemaphoreRelease(sem);
+    (void)osSemaphoreAcquire(sem, 0U);
+  }
+  stop = CycleCount();
+  bench_result.sem_release_get = CycleAverage(start, stop, bench_result.overhead);
+
+  start = CycleCount();
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    (void)osEventFlagsSet(event, 1U);
+    (void)osEventFlagsClear(event, 1U);
+  }
+  stop = CycleCount();
+  bench_result.event_set_clear = CycleAverage(start, stop, bench_result.overhead);
+
+  /* Each release switches to threadPeer and back when it blocks again */
+  start = CycleCount();
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    (void)osSemaphoreRelease(sem_peer);
+  }
+  stop = CycleCount();
+  bench_result.sem_switch = CycleAverage(start, stop, bench_result.overhead);
+
+  GPIO_PinWrite(LED_PORT, LED_GREEN, GPIO_PIN_OUT_HIGH);
+
+  for (;;) {
+    osDelay(osWaitForever);
+  }
+}
+
+static void HardwareInit(void)
+{
+  SystemCoreClockUpdate();
+
+  /* Enable cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0U;
+  DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+
+  if (!GPIO_GetPortClockState(LED_PORT)) {
+    GPIO_PortClock(LED_PORT, GPIO_PORT_CLK_ENABLE);
+  }
+
+  GPIO_PinConfig(LED_PORT, LED_GREEN, &LED_cfg);
+  GPIO_PinConfig(LED_PORT, LED_RED,   &LED_cfg);
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+int main(void)
+{
+  osStatus_t status;
+
+  HardwareInit();
+
+  status = osKernelInitialize();
+  if (status == osOK) {
+    sem = osSemaphoreNew(1U, 0U, &sem_attr);
+    if (sem == NULL) {
+      goto error;
+    }
+
+    sem_peer = osSemaphoreNew(1U, 0U, &sem_peer_attr);
+    if (sem_peer == NULL) {
+      goto error;
+    }
+
+    event = osEventFlagsNew(&event_attr);
+    if (event == NULL) {
+      goto error;
+    }
+
+    threadPeer = osThreadNew(threadPeer_func, NULL, &threadPeer_attr);
+    if (threadPeer == NULL) {
+      goto error;
+    }
+
+    threadBench = osThreadNew(threadBench_func, NULL, &threadBench_attr);
+    if (threadBench == NULL) {
+      goto error;
+    }
+
+    /* Start RTOS */
+    osKernelStart();
+  }
+
+error:
+  GPIO_PinWrite(LED_PORT, LED_RED, GPIO_PIN_OUT_HIGH);
+
+  return (-1);
+}
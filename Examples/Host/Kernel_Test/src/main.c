@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: mbOS real-time kernel
+ */
+
+/**
+ * @file
+ *
+ * Kernel tests for the POSIX host port.
+ *
+ * Every test prints one line "TEST,<test>,pass" or
+ * "TEST,<test>,fail,<file>:<line>" and the run ends with "TEST,end,<failed>".
+ * The process exit status is 0 when all tests pass. The first argument sets
+ * the seed of the random tests, the seed is printed to repeat a failed run.
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <Core/Posix/irq_posix.h>
+
+#include "test.h"
+
+/*******************************************************************************
+ *  typedefs and structures (scope: module-local)
+ ******************************************************************************/
+
+typedef struct {
+  const char  *name;
+  void       (*func)(void);
+} test_case_t;
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static const test_case_t test_case[] = {
+  { "stress_threads",   TestStressThreads   },
+  { "stress_timers",    TestStressTimers    },
+  { "irqthread_masked", TestIrqThreadMasked },
+  { "threshold_lower",  TestThresholdLower  },
+  { "threadpool",       TestThreadPool      },
+  { "task",             TestTask            },
+  { "i2c_retry",        TestI2CRetry        },
+};
+
+static uint32_t          seed;
+static uint32_t          seed_state;
+static const char       *fail_file;
+static volatile uint32_t fail_line;
+
+static osThread_t        test_cb;
+static uint64_t          test_stack[TEST_STACK_SIZE/8U];
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+__NO_RETURN
+static void TestThread(void *argument)
+{
+  uint32_t failed = 0U;
+
+  (void)argument;
+
+  printf("TEST,seed,%u\n", (unsigned)seed);
+
+  for (uint32_t i = 0U; i < (sizeof(test_case) / sizeof(test_case[0])); i++) {
+    fail_line = 0U;
+    seed_state = seed;
+
+    test_case[i].func();
+
+    if (fail_line == 0U) {
+      printf("TEST,%s,pass\n", test_case[i].name);
+    }
+    else {
+      printf("TEST,%s,fail,%s:%u\n", test_case[i].name, fail_file, (unsigned)fail_line);
+      failed++;
+    }
+  }
+
+  printf("TEST,end,%u\n", (unsigned)failed);
+
+  exit((failed == 0U) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+void TestCheck(bool cond, const char *file, uint32_t line)
+{
+  if (!cond && (fail_line == 0U)) {
+    fail_file = file;
+    fail_line = line;
+  }
+}
+
+uint32_t TestRand(uint32_t *state)
+{
+  uint32_t x = *state;
+
+  /* xorshift32 */
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+
+  return (x);
+}
+
+uint32_t TestSeed(void)
+{
+  uint32_t value;
+
+  do {
+    value = TestRand(&seed_state);
+  } while (value == 0U);
+
+  return (value);
+}
+
+int main(int argc, char *argv[])
+{
+  const osThreadAttr_t thread_attr = {
+    .name       = "test",
+    .attr_bits  = osThreadDetached,
+    .cb_mem     = &test_cb,
+    .cb_size    = sizeof(test_cb),
+    .stack_mem  = &test_stack[0],
+    .stack_size = sizeof(test_stack),
+    .priority   = osPriorityLow,
+    .threshold  = osPriorityNone,
+  };
+
+  /* Keep the report in order with a crash of the test */
+  (void)setvbuf(stdout, NULL, _IONBF, 0U);
+
+  seed = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 1U;
+  if (seed == 0U) {
+    seed = 1U;
+  }
+
+  if ((IRQ_Initialize() == 0) && (osKernelInitialize() == osOK) &&
+      (osThreadNew(TestThread, NULL, &thread_attr) != NULL)) {
+    /* Start RTOS */
+    (void)osKernelStart();
+  }
+
+  return (EXIT_FAILURE);
+}
+
+/*------------------------------ End of file ---------------------------------*/
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: mbOS real-time kernel
+ */
+
+#ifndef TEST_H_
+#define TEST_H_
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <Kernel/kernel.h>
+
+/*******************************************************************************
+ *  defines and macros
+ ******************************************************************************/
+
+#ifndef TEST_STACK_SIZE
+#define TEST_STACK_SIZE               (16384U)    ///< Stack size of a test thread
+#endif
+
+/**
+ * Record a failure of the running test if the condition is false. Can be used
+ * by any thread, the first failure of a test is reported.
+ */
+#define TEST_ASSERT(cond)             TestCheck((cond), __FILE__, __LINE__)
+
+/*******************************************************************************
+ *  exported function prototypes
+ ******************************************************************************/
+
+/**
+ * @fn          void TestCheck(bool, const char*, uint32_t)
+ * @brief       Record a failure of the running test.
+ * @param[in]   cond  checked condition.
+ * @param[in]   file  source file of the check.
+ * @param[in]   line  source line of the check.
+ */
+void TestCheck(bool cond, const char *file, uint32_t line);
+
+/**
+ * @fn          uint32_t TestRand(uint32_t*)
+ * @brief       Get the next value of a pseudo-random sequence.
+ * @param[in]   state   sequence state, never 0.
+ * @return      pseudo-random value.
+ */
+uint32_t TestRand(uint32_t *state);
+
+/**
+ * @fn          uint32_t TestSeed(void)
+ * @brief       Get a seed derived from the seed of the test run.
+ * @return      seed value, never 0.
+ */
+uint32_t TestSeed(void);
+
+/*
+ * Test cases, run one after another by the test thread.
+ */
+
+void TestStressThreads(void);
+void TestStressTimers(void);
+void TestIrqThreadMasked(void);
+void TestThresholdLower(void);
+void TestThreadPool(void);
+void TestTask(void);
+void TestI2CRetry(void);
+
+#endif /* TEST_H_ */
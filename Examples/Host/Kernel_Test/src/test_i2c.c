@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: mbOS real-time kernel
+ */
+
+/**
+ * @file
+ *
+ * I2C master tests on a fake I2C driver. The driver completes a transfer from
+ * a software interrupt line of the host port, the slave answers the first
+ * address with a NACK and the retry has to run after its backoff, well before
+ * the COM timeout.
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <Core/Posix/irq_posix.h>
+
+#include "i2c_master.h"
+#include "test.h"
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#define TEST_I2C_IRQ                  (2)         ///< Software interrupt line of the driver
+#define TEST_I2C_PORT                 (0U)        ///< Port of the fake driver
+#define TEST_I2C_TIMEOUT              (100U)      ///< COM timeout in ticks
+#define TEST_I2C_RETRY_MAX            (10U)       ///< Latest retry start in ticks after the NACK
+#define TEST_I2C_STARTS               (4U)        ///< Recorded transfer starts
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static ARM_I2C_SignalEvent_t i2c_cb_event;
+static volatile uint32_t     i2c_event;
+static volatile uint32_t     i2c_nack;
+static volatile uint32_t     i2c_starts;
+static uint32_t              i2c_start_tick[TEST_I2C_STARTS];
+
+static I2C_Com_t             i2c_com;
+static I2C_Transfer_t        i2c_xfer;
+static const uint8_t         i2c_data[2] = { 0x10U, 0x55U };
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+/* Fake I2C driver */
+
+static ARM_DRIVER_VERSION FakeGetVersion(void)
+{
+  const ARM_DRIVER_VERSION version = { ARM_I2C_API_VERSION, 0U };
+
+  return (version);
+}
+
+static ARM_I2C_CAPABILITIES FakeGetCapabilities(void)
+{
+  const ARM_I2C_CAPABILITIES capabilities = { 0U };
+
+  return (capabilities);
+}
+
+static int32_t FakeInitialize(ARM_I2C_SignalEvent_t cb_event)
+{
+  i2c_cb_event = cb_event;
+
+  return (ARM_DRIVER_OK);
+}
+
+static int32_t FakeUninitialize(void)
+{
+  i2c_cb_event = NULL;
+
+  return (ARM_DRIVER_OK);
+}
+
+static int32_t FakePowerControl(ARM_POWER_STATE state)
+{
+  (void)state;
+
+  return (ARM_DRIVER_OK);
+}
+
+static int32_t FakeMasterTransmit(uint32_t addr, const uint8_t *data, uint32_t num, bool xfer_pending)
+{
+  (void)addr;
+  (void)data;
+  (void)num;
+  (void)xfer_pending;
+
+  if (i2c_starts < TEST_I2C_STARTS) {
+    i2c_start_tick[i2c_starts] = osKernelGetTickCount();
+  }
+  i2c_starts++;
+
+  if (i2c_nack != 0U) {
+    i2c_nack--;
+    i2c_event = ARM_I2C_EVENT_TRANSFER_DONE | ARM_I2C_EVENT_TRANSFER_INCOMPLETE |
+                ARM_I2C_EVENT_ADDRESS_NACK;
+  }
+  else {
+    i2c_event = ARM_I2C_EVENT_TRANSFER_DONE;
+  }
+
+  /* The transfer completes in the interrupt */
+  return ((IRQ_SetPending(TEST_I2C_IRQ) == 0) ? ARM_DRIVER_OK : ARM_DRIVER_ERROR);
+}
+
+static int32_t FakeMasterReceive(uint32_t addr, uint8_t *data, uint32_t num, bool xfer_pending)
+{
+  (void)addr;
+  (void)data;
+  (void)num;
+  (void)xfer_pending;
+
+  return (ARM_DRIVER_ERROR_UNSUPPORTED);
+}
+
+static int32_t FakeSlaveTransmit(const uint8_t *data, uint32_t num)
+{
+  (void)data;
+  (void)num;
+
+  return (ARM_DRIVER_ERROR_UNSUPPORTED);
+}
+
+static int32_t FakeSlaveReceive(uint8_t *data, uint32_t num)
+{
+  (void)data;
+  (void)num;
+
+  return (ARM_DRIVER_ERROR_UNSUPPORTED);
+}
+
+static int32_t FakeGetDataCount(void)
+{
+  return (0);
+}
+
+static int32_t FakeControl(uint32_t control, uint32_t arg)
+{
+  (void)control;
+  (void)arg;
+
+  return (ARM_DRIVER_OK);
+}
+
+static ARM_I2C_STATUS FakeGetStatus(void)
+{
+  const ARM_I2C_STATUS status = { 0U };
+
+  return (status);
+}
+
+static void FakeIrqHandler(void)
+{
+  if (i2c_cb_event != NULL) {
+    i2c_cb_event(i2c_event);
+  }
+}
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-exported)
+ ******************************************************************************/
+
+/* Both ports of the I2C master are built, the tests use port 0 */
+ARM_DRIVER_I2C Driver_I2C0 = {
+  FakeGetVersion,
+  FakeGetCapabilities,
+  FakeInitialize,
+  FakeUninitialize,
+  FakePowerControl,
+  FakeMasterTransmit,
+  FakeMasterReceive,
+  FakeSlaveTransmit,
+  FakeSlaveReceive,
+  FakeGetDataCount,
+  FakeControl,
+  FakeGetStatus,
+};
+
+ARM_DRIVER_I2C Driver_I2C1 = {
+  FakeGetVersion,
+  FakeGetCapabilities,
+  FakeInitialize,
+  FakeUninitialize,
+  FakePowerControl,
+  FakeMasterTransmit,
+  FakeMasterReceive,
+  FakeSlaveTransmit,
+  FakeSlaveReceive,
+  FakeGetDataCount,
+  FakeControl,
+  FakeGetStatus,
+};
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+void TestI2CRetry(void)
+{
+  i2c_nack   = 1U;
+  i2c_starts = 0U;
+
+  TEST_ASSERT(IRQ_SetHandler(TEST_I2C_IRQ, FakeIrqHandler) == 0);
+  TEST_ASSERT(IRQ_Enable(TEST_I2C_IRQ) == 0);
+
+  TEST_ASSERT(I2C_PortOpen(TEST_I2C_PORT) == I2C_OK);
+  TEST_ASSERT(I2C_ComCreate(&i2c_com, TEST_I2C_PORT, I2C_BUS_SPEED_FAST, 0x50U, TEST_I2C_TIMEOUT) == I2C_OK);
+
+  i2c_xfer.com     = &i2c_com;
+  i2c_xfer.tx_buf  = i2c_data;
+  i2c_xfer.tx_size = sizeof(i2c_data);
+  i2c_xfer.retries = 1U;
+
+  TEST_ASSERT(I2C_Submit(&i2c_xfer) == I2C_OK);
+
+  for (uint32_t i = 0U; (i < (2U * TEST_I2C_TIMEOUT)) && (i2c_xfer.status == I2C_BUSY); i++) {
+    (void)osDelay(1U);
+  }
+
+  /* The address NACK was retried once after the backoff */
+  TEST_ASSERT(i2c_xfer.status == I2C_OK);
+  TEST_ASSERT(i2c_starts == 2U);
+  TEST_ASSERT((i2c_start_tick[1] - i2c_start_tick[0]) >= I2C_RETRY_BACKOFF);
+  TEST_ASSERT((i2c_start_tick[1] - i2c_start_tick[0]) <= TEST_I2C_RETRY_MAX);
+
+  TEST_ASSERT(I2C_PortClose(TEST_I2C_PORT) == I2C_OK);
+  (void)IRQ_Disable(TEST_I2C_IRQ);
+}
+
+/*------------------------------ End of file ---------------------------------*/
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: mbOS real-time kernel
+ */
+
+/**
+ * @file
+ *
+ * Interrupt thread tests on a software interrupt line of the host port. The
+ * top half masks the line, the bottom half has to run once per signal and the
+ * line has to be unmasked when the bottom half completes.
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <Core/Posix/irq_posix.h>
+
+#include "test.h"
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#define TEST_IRQ                      (1)         ///< Software interrupt line
+#define TEST_IRQ_WAIT                 (100U)      ///< Ticks to wait for the bottom half
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static osIrqThreadId_t   irq_id;
+static volatile uint32_t top_count;
+static volatile uint32_t bottom_count;
+static volatile uint32_t repend;
+
+static osIrqThread_t     irq_cb;
+static osThread_t        irq_thread_cb;
+static uint64_t          irq_stack[TEST_STACK_SIZE/8U];
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+static void TestIrqHandler(void)
+{
+  top_count++;
+  TEST_ASSERT(osIrqThreadSignal(irq_id) == osOK);
+}
+
+static void TestIrqBottomHalf(void *argument)
+{
+  (void)argument;
+
+  /* The line stays masked while the bottom half runs */
+  TEST_ASSERT(IRQ_GetEnableState(TEST_IRQ) == 0U);
+
+  bottom_count++;
+
+  /* Signal the masked line again, the top half runs after the unmask */
+  if (repend != 0U) {
+    repend = 0U;
+    TEST_ASSERT(IRQ_SetPending(TEST_IRQ) == 0);
+    TEST_ASSERT(top_count == bottom_count);
+  }
+}
+
+/**
+ * @brief       Trigger the line and wait for the bottom half runs.
+ * @param[in]   count   expected number of bottom half runs.
+ */
+static void TestIrqRun(uint32_t count)
+{
+  uint32_t bottom = bottom_count;
+  uint32_t top    = top_count;
+
+  TEST_ASSERT(IRQ_SetPending(TEST_IRQ) == 0);
+
+  for (uint32_t i = 0U; (i < TEST_IRQ_WAIT) && ((bottom_count - bottom) < count); i++) {
+    (void)osDelay(1U);
+  }
+
+  TEST_ASSERT((bottom_count - bottom) == count);
+  TEST_ASSERT((top_count - top) == count);
+  TEST_ASSERT(IRQ_GetEnableState(TEST_IRQ) == 1U);
+  TEST_ASSERT(IRQ_GetPending(TEST_IRQ) == 0U);
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+void TestIrqThreadMasked(void)
+{
+  const osIrqThreadAttr_t attr = {
+    .name        = "irq",
+    .attr_bits   = osIrqThreadMaskIrq,
+    .cb_mem      = &irq_cb,
+    .cb_size     = sizeof(irq_cb),
+    .thread_mem  = &irq_thread_cb,
+    .thread_size = sizeof(irq_thread_cb),
+    .stack_mem   = &irq_stack[0],
+    .stack_size  = sizeof(irq_stack),
+    .priority    = osPriorityHigh,
+    .irqn        = TEST_IRQ,
+  };
+
+  irq_id = osIrqThreadNew(TestIrqBottomHalf, NULL, &attr);
+  TEST_ASSERT(irq_id != NULL);
+  if (irq_id == NULL) {
+    return;
+  }
+
+  TEST_ASSERT(IRQ_SetHandler(TEST_IRQ, TestIrqHandler) == 0);
+  TEST_ASSERT(IRQ_Enable(TEST_IRQ) == 0);
+
+  /* Two signals one after another */
+  TestIrqRun(1U);
+  TestIrqRun(1U);
+
+  /* Second signal while the line is masked by the first one */
+  repend = 1U;
+  TestIrqRun(2U);
+
+  (void)IRQ_Disable(TEST_IRQ);
+}
+
+/*------------------------------ End of file ---------------------------------*/
@@ -0,0 +1,498 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: mbOS real-time kernel
+ */
+
+/**
+ * @file
+ *
+ * Randomized stress tests: thousands of threads working on shared kernel
+ * objects and thousands of timers started, restarted and stopped at random.
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stddef.h>
+
+#include "test.h"
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#ifndef STRESS_THREADS
+#define STRESS_THREADS                (512U)      ///< Threads alive at the same time
+#endif
+
+#ifndef STRESS_THREAD_TOTAL
+#define STRESS_THREAD_TOTAL           (4096U)     ///< Threads created by the test
+#endif
+
+#ifndef STRESS_THREAD_STEPS
+#define STRESS_THREAD_STEPS           (32U)       ///< Random operations of a thread
+#endif
+
+#ifndef STRESS_TIMERS
+#define STRESS_TIMERS                 (2048U)     ///< Timers of the timer test
+#endif
+
+#ifndef STRESS_TIMER_ROUNDS
+#define STRESS_TIMER_ROUNDS           (8U)        ///< Rounds of random timer operations
+#endif
+
+#define TIMER_PERIOD_MAX              (64U)       ///< Longest timer period in ticks
+#define SEM_TOKENS                    (4U)
+#define MSG_COUNT                     (8U)
+#define BLOCK_COUNT                   (8U)
+#define BLOCK_SIZE                    (16U)
+
+/* Timer state of the timer test */
+#define TimerIdle                     (0U)
+#define TimerStarted                  (1U)
+#define TimerStopped                  (2U)
+
+/*******************************************************************************
+ *  typedefs and structures (scope: module-local)
+ ******************************************************************************/
+
+typedef struct {
+  osTimerType_t type;
+  uint32_t      state;
+  uint32_t      period;
+  uint32_t      start;                            ///< Tick count when started
+  uint32_t      base;                             ///< Callback count when started or stopped
+} stress_timer_t;
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static osThread_t         thread_cb[STRESS_THREADS];
+static uint64_t           thread_stack[STRESS_THREADS][TEST_STACK_SIZE/8U];
+static uint32_t           thread_seed[STRESS_THREADS];
+
+static osMessageQueueId_t done_mq;
+static osMessageQueue_t   done_mq_cb;
+static uint32_t           done_mq_mem[osMessageQueueMemSize(STRESS_THREADS, sizeof(uint32_t))/4U];
+static osSemaphoreId_t    token_sem;
+static osSemaphore_t      token_sem_cb;
+static osMutexId_t        mutex;
+static osMutex_t          mutex_cb;
+static osEventFlagsId_t   evf;
+static osEventFlags_t     evf_cb;
+static osMessageQueueId_t mq;
+static osMessageQueue_t   mq_cb;
+static uint32_t           mq_mem[osMessageQueueMemSize(MSG_COUNT, sizeof(uint32_t))/4U];
+static osMemoryPoolId_t   mp;
+static osMemoryPool_t     mp_cb;
+static uint32_t           mp_mem[osMemoryPoolMemSize(BLOCK_COUNT, BLOCK_SIZE)/4U];
+
+/* Updated by the threads, the mutex protects them */
+static volatile uint32_t  mutex_inside;
+static volatile uint32_t  mutex_count;
+static volatile uint32_t  mutex_expected;
+static volatile uint32_t  msg_put;
+static volatile uint32_t  msg_get;
+
+static osTimerId_t        timer_id[STRESS_TIMERS];
+static osTimer_t          timer_cb[STRESS_TIMERS];
+static stress_timer_t     timer[STRESS_TIMERS];
+static volatile uint32_t  timer_count[STRESS_TIMERS];
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+static void StressMutex(uint32_t *rnd)
+{
+  if (osMutexAcquire(mutex, TestRand(rnd) % 3U) == osOK) {
+    TEST_ASSERT(++mutex_inside == 1U);
+    mutex_count++;
+    if ((TestRand(rnd) & 3U) == 0U) {
+      /* Let other threads contend while the mutex is held */
+      (void)osDelay(1U);
+    }
+    mutex_expected++;
+    TEST_ASSERT(--mutex_inside == 0U);
+    TEST_ASSERT(osMutexRelease(mutex) == osOK);
+  }
+}
+
+static void StressSemaphore(uint32_t *rnd)
+{
+  if (osSemaphoreAcquire(token_sem, TestRand(rnd) % 3U) == osOK) {
+    TEST_ASSERT(osSemaphoreGetCount(token_sem) < SEM_TOKENS);
+    (void)osThreadYield();
+    TEST_ASSERT(osSemaphoreRelease(token_sem) == osOK);
+  }
+}
+
+static void StressMessage(uint32_t *rnd)
+{
+  uint32_t msg = TestRand(rnd);
+
+  if ((msg & 1U) != 0U) {
+    if (osMessageQueuePut(mq, &msg, 0U, msg % 3U) == osOK) {
+      (void)osMutexAcquire(mutex, osWaitForever);
+      msg_put++;
+      (void)osMutexRelease(mutex);
+    }
+  }
+  else {
+    if (osMessageQueueGet(mq, &msg, NULL, msg % 3U) == osOK) {
+      (void)osMutexAcquire(mutex, osWaitForever);
+      msg_get++;
+      (void)osMutexRelease(mutex);
+    }
+  }
+}
+
+static void StressMemoryPool(uint32_t *rnd)
+{
+  uint32_t *block;
+  uint32_t  pattern = TestRand(rnd);
+
+  block = osMemoryPoolAlloc(mp, pattern % 3U);
+  if (block != NULL) {
+    for (uint32_t i = 0U; i < (BLOCK_SIZE / 4U); i++) {
+      block[i] = pattern;
+    }
+    (void)osThreadYield();
+    for (uint32_t i = 0U; i < (BLOCK_SIZE / 4U); i++) {
+      TEST_ASSERT(block[i] == pattern);
+    }
+    TEST_ASSERT(osMemoryPoolFree(mp, block) == osOK);
+  }
+}
+
+static void StressEventFlags(uint32_t *rnd)
+{
+  uint32_t flags = 1UL << (TestRand(rnd) % 8U);
+
+  if ((TestRand(rnd) & 1U) != 0U) {
+    (void)osEventFlagsSet(evf, flags);
+  }
+  else {
+    (void)osEventFlagsWait(evf, flags, osFlagsWaitAny, TestRand(rnd) % 3U);
+  }
+}
+
+static void StressThread(void *argument)
+{
+  uint32_t slot = (uint32_t)argument;
+  uint32_t rnd  = thread_seed[slot];
+
+  for (uint32_t i = 0U; i < STRESS_THREAD_STEPS; i++) {
+    switch (TestRand(&rnd) % 7U) {
+      case 0U:
+        StressMutex(&rnd);
+        break;
+
+      case 1U:
+        StressSemaphore(&rnd);
+        break;
+
+      case 2U:
+        StressMessage(&rnd);
+        break;
+
+      case 3U:
+        StressMemoryPool(&rnd);
+        break;
+
+      case 4U:
+        StressEventFlags(&rnd);
+        break;
+
+      case 5U:
+        (void)osDelay(TestRand(&rnd) % 3U);
+        break;
+
+      default:
+        (void)osThreadYield();
+        break;
+    }
+  }
+
+  /* The test thread has the lowest priority, the slot is free when it runs */
+  TEST_ASSERT(osMessageQueuePut(done_mq, &slot, 0U, 0U) == osOK);
+}
+
+static bool StressObjectsNew(void)
+{
+  const osMessageQueueAttr_t done_attr = {
+    .name    = "stress_done",
+    .cb_mem  = &done_mq_cb,
+    .cb_size = sizeof(done_mq_cb),
+    .mq_mem  = &done_mq_mem[0],
+    .mq_size = sizeof(done_mq_mem),
+  };
+  const osSemaphoreAttr_t token_attr = {
+    .name    = "stress_token",
+    .cb_mem  = &token_sem_cb,
+    .cb_size = sizeof(token_sem_cb),
+  };
+  const osMutexAttr_t mutex_attr = {
+    .name      = "stress_mutex",
+    .attr_bits = osMutexPrioInherit,
+    .cb_mem    = &mutex_cb,
+    .cb_size   = sizeof(mutex_cb),
+  };
+  const osEventFlagsAttr_t evf_attr = {
+    .name    = "stress_evf",
+    .cb_mem  = &evf_cb,
+    .cb_size = sizeof(evf_cb),
+  };
+  const osMessageQueueAttr_t mq_attr = {
+    .name    = "stress_mq",
+    .cb_mem  = &mq_cb,
+    .cb_size = sizeof(mq_cb),
+    .mq_mem  = &mq_mem[0],
+    .mq_size = sizeof(mq_mem),
+  };
+  const osMemoryPoolAttr_t mp_attr = {
+    .name    = "stress_mp",
+    .cb_mem  = &mp_cb,
+    .cb_size = sizeof(mp_cb),
+    .mp_mem  = &mp_mem[0],
+    .mp_size = sizeof(mp_mem),
+  };
+
+  done_mq   = osMessageQueueNew(STRESS_THREADS, sizeof(uint32_t), &done_attr);
+  token_sem = osSemaphoreNew(SEM_TOKENS, SEM_TOKENS, &token_attr);
+  mutex     = osMutexNew(&mutex_attr);
+  evf       = osEventFlagsNew(&evf_attr);
+  mq        = osMessageQueueNew(MSG_COUNT, sizeof(uint32_t), &mq_attr);
+  mp        = osMemoryPoolNew(BLOCK_COUNT, BLOCK_SIZE, &mp_attr);
+
+  return ((done_mq != NULL) && (token_sem != NULL) && (mutex != NULL) &&
+          (evf != NULL) && (mq != NULL) && (mp != NULL));
+}
+
+static void StressTimerFunc(void *argument)
+{
+  timer_count[(uint32_t)argument]++;
+}
+
+/* Stop the timer, its callback cannot run afterwards */
+static void StressTimerStop(uint32_t i)
+{
+  osStatus_t status = osTimerStop(timer_id[i]);
+
+  if (timer[i].state == TimerStarted) {
+    /* A one-shot timer that has expired is not running any more */
+    TEST_ASSERT((status == osOK) ||
+                ((timer[i].type == osTimerOnce) && (status == osErrorResource) &&
+                 (timer_count[i] == (timer[i].base + 1U))));
+  }
+  else {
+    TEST_ASSERT(status == osErrorResource);
+  }
+
+  timer[i].state = TimerStopped;
+  timer[i].base  = timer_count[i];
+}
+
+static void StressTimerStart(uint32_t i, uint32_t *rnd)
+{
+  if (timer[i].state == TimerStarted) {
+    StressTimerStop(i);
+  }
+
+  timer[i].period = 1U + (TestRand(rnd) % TIMER_PERIOD_MAX);
+  timer[i].state  = TimerStarted;
+  timer[i].start  = osKernelGetTickCount();
+  timer[i].base   = timer_count[i];
+
+  TEST_ASSERT(osTimerStart(timer_id[i], timer[i].period) == osOK);
+}
+
+/* Check the callback count of a timer started or stopped before the last wait */
+static void StressTimerCheck(uint32_t i)
+{
+  uint32_t count   = timer_count[i] - timer[i].base;
+  uint32_t elapsed = osKernelGetTickCount() - timer[i].start;
+
+  if (timer[i].state == TimerStopped) {
+    TEST_ASSERT(count == 0U);
+  }
+  else if (timer[i].type == osTimerOnce) {
+    TEST_ASSERT(count == 1U);
+    TEST_ASSERT(osTimerIsRunning(timer_id[i]) == 0U);
+  }
+  else {
+    TEST_ASSERT((count >= 1U) && (count <= ((elapsed / timer[i].period) + 1U)));
+    TEST_ASSERT(osTimerIsRunning(timer_id[i]) != 0U);
+  }
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+/**
+ * @brief       Thousands of threads with random priorities block, time out and
+ *              wake each other on a mutex, a semaphore, a message queue, a
+ *              memory pool and event flags.
+ */
+void TestStressThreads(void)
+{
+  osThreadAttr_t attr = {
+    .name       = "stress",
+    .attr_bits  = osThreadDetached,
+    .cb_size    = sizeof(osThread_t),
+    .stack_size = TEST_STACK_SIZE,
+    .threshold  = osPriorityNone,
+  };
+  uint32_t rnd     = TestSeed();
+  uint32_t created = 0U;
+  uint32_t done    = 0U;
+  uint32_t slot;
+  uint32_t msg;
+
+  if (!StressObjectsNew()) {
+    TEST_ASSERT(false);
+    return;
+  }
+
+  mutex_inside   = 0U;
+  mutex_count    = 0U;
+  mutex_expected = 0U;
+  msg_put        = 0U;
+  msg_get        = 0U;
+
+  /* Every slot is free at the start */
+  for (slot = 0U; slot < STRESS_THREADS; slot++) {
+    (void)osMessageQueuePut(done_mq, &slot, 0U, 0U);
+  }
+
+  while (done < (STRESS_THREAD_TOTAL + STRESS_THREADS)) {
+    if (osMessageQueueGet(done_mq, &slot, NULL, 10000U) != osOK) {
+      TEST_ASSERT(false);
+      return;
+    }
+    done++;
+
+    if (created < STRESS_THREAD_TOTAL) {
+      attr.cb_mem    = &thread_cb[slot];
+      attr.stack_mem = &thread_stack[slot][0];
+      attr.priority  = (osPriority_t)(osPriorityBelowNormal +
+                       (int32_t)(TestRand(&rnd) % (osPriorityAboveNormal - osPriorityBelowNormal + 1)));
+      thread_seed[slot] = TestSeed();
+      if (osThreadNew(StressThread, (void *)slot, &attr) == NULL) {
+        TEST_ASSERT(false);
+        return;
+      }
+      created++;
+    }
+  }
+
+  /* Every thread has terminated, a detached thread is deleted on exit */
+  for (slot = 0U; slot < STRESS_THREADS; slot++) {
+    TEST_ASSERT(osThreadGetState(&thread_cb[slot]) == osThreadError);
+  }
+
+  TEST_ASSERT(mutex_inside == 0U);
+  TEST_ASSERT(mutex_count == mutex_expected);
+  TEST_ASSERT(osMutexGetOwner(mutex) == NULL);
+  TEST_ASSERT(osSemaphoreGetCount(token_sem) == SEM_TOKENS);
+  TEST_ASSERT(osMemoryPoolGetCount(mp) == 0U);
+
+  while (osMessageQueueGet(mq, &msg, NULL, 0U) == osOK) {
+    msg_get++;
+  }
+  TEST_ASSERT(msg_put == msg_get);
+
+  (void)osMessageQueueDelete(mq);
+  (void)osMemoryPoolDelete(mp);
+  (void)osEventFlagsDelete(evf);
+  (void)osMutexDelete(mutex);
+  (void)osSemaphoreDelete(token_sem);
+  (void)osMessageQueueDelete(done_mq);
+}
+
+/**
+ * @brief       Thousands of one-shot and periodic timers with random periods
+ *              are started, restarted and stopped at random. Every timer must
+ *              call back exactly as its last operation requires.
+ */
+void TestStressTimers(void)
+{
+  osTimerAttr_t attr = {
+    .name    = "stress",
+    .cb_size = sizeof(osTimer_t),
+  };
+  uint32_t rnd = TestSeed();
+  uint32_t i;
+
+  for (i = 0U; i < STRESS_TIMERS; i++) {
+    timer[i].type  = ((TestRand(&rnd) & 1U) != 0U) ? osTimerPeriodic : osTimerOnce;
+    timer[i].state = TimerIdle;
+    timer_count[i] = 0U;
+
+    attr.cb_mem = &timer_cb[i];
+    timer_id[i] = osTimerNew(StressTimerFunc, timer[i].type, (void *)i, &attr);
+    TEST_ASSERT(timer_id[i] != NULL);
+    if (timer_id[i] == NULL) {
+      return;
+    }
+  }
+
+  for (uint32_t round = 0U; round < STRESS_TIMER_ROUNDS; round++) {
+    for (i = 0U; i < STRESS_TIMERS; i++) {
+      if ((TestRand(&rnd) % 4U) == 0U) {
+        StressTimerStop(i);
+      }
+      else {
+        StressTimerStart(i, &rnd);
+      }
+    }
+
+    /* Let some timers expire, then change the state of a random subset */
+    (void)osDelay(TestRand(&rnd) % TIMER_PERIOD_MAX);
+    for (uint32_t n = 0U; n < (STRESS_TIMERS / 4U); n++) {
+      i = TestRand(&rnd) % STRESS_TIMERS;
+      if ((TestRand(&rnd) & 1U) != 0U) {
+        StressTimerStop(i);
+      }
+      else {
+        StressTimerStart(i, &rnd);
+      }
+    }
+
+    /* Every started timer has expired at least once */
+    (void)osDelay(TIMER_PERIOD_MAX + 2U);
+
+    for (i = 0U; i < STRESS_TIMERS; i++) {
+      StressTimerCheck(i);
+    }
+  }
+
+  /* Stopped timers stay silent */
+  for (i = 0U; i < STRESS_TIMERS; i++) {
+    StressTimerStop(i);
+  }
+  (void)osDelay(TIMER_PERIOD_MAX + 2U);
+  for (i = 0U; i < STRESS_TIMERS; i++) {
+    StressTimerCheck(i);
+    TEST_ASSERT(osTimerDelete(timer_id[i]) == osOK);
+  }
+}
+
+/*------------------------------ End of file ---------------------------------*/
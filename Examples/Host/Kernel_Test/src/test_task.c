@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: mbOS real-time kernel
+ */
+
+/**
+ * @file
+ *
+ * Stackless task tests: a task waiting on a semaphore and a yielding task
+ * share one host thread, both have to run to their end.
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include "test.h"
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#define TASK_ROUNDS                   (8U)        ///< Waits and yields of each task
+#define TASK_WAIT                     (100U)      ///< Ticks to wait for the tasks
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static osSemaphoreId_t   task_sem;
+static volatile uint32_t wait_count;
+static volatile uint32_t yield_count;
+
+static osTaskHost_t      host_cb;
+static osTask_t          wait_task_cb;
+static osTask_t          yield_task_cb;
+static osSemaphore_t     sem_cb;
+static osThread_t        host_thread_cb;
+static uint64_t          host_stack[TEST_STACK_SIZE/8U];
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+static void TestTaskWait(void *task, void *argument)
+{
+  (void)argument;
+
+  osTaskBegin(task);
+
+  while (wait_count < TASK_ROUNDS) {
+    osTaskAwait(task, osSemaphoreAcquire(task_sem, osWaitForever));
+    TEST_ASSERT(osTaskResult(task) == (uint32_t)osOK);
+    wait_count++;
+  }
+
+  osTaskEnd(task);
+}
+
+static void TestTaskYield(void *task, void *argument)
+{
+  (void)argument;
+
+  osTaskBegin(task);
+
+  while (yield_count < TASK_ROUNDS) {
+    yield_count++;
+    osTaskYield(task);
+  }
+
+  osTaskEnd(task);
+}
+
+static void TestTaskHost(void *argument)
+{
+  (void)osTaskHostRun(argument);
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+void TestTask(void)
+{
+  const osTaskHostAttr_t host_attr = {
+    .name      = "host",
+    .attr_bits = 0U,
+    .cb_mem    = &host_cb,
+    .cb_size   = sizeof(host_cb),
+  };
+  const osSemaphoreAttr_t sem_attr = {
+    .name      = "task",
+    .attr_bits = 0U,
+    .cb_mem    = &sem_cb,
+    .cb_size   = sizeof(sem_cb),
+  };
+  const osThreadAttr_t thread_attr = {
+    .name       = "host",
+    .attr_bits  = osThreadDetached,
+    .cb_mem     = &host_thread_cb,
+    .cb_size    = sizeof(host_thread_cb),
+    .stack_mem  = &host_stack[0],
+    .stack_size = sizeof(host_stack),
+    .priority   = osPriorityNormal,
+    .threshold  = osPriorityNone,
+  };
+  osTaskAttr_t   task_attr = {
+    .name      = "wait",
+    .attr_bits = 0U,
+    .cb_mem    = &wait_task_cb,
+    .cb_size   = sizeof(wait_task_cb),
+    .priority  = osPriorityNormal,
+  };
+  osTaskHostId_t host_id;
+  osTaskId_t     wait_id;
+  osTaskId_t     yield_id;
+
+  wait_count  = 0U;
+  yield_count = 0U;
+
+  task_sem = osSemaphoreNew(TASK_ROUNDS, 0U, &sem_attr);
+  host_id  = osTaskHostNew(&host_attr);
+  TEST_ASSERT((task_sem != NULL) && (host_id != NULL));
+  if ((task_sem == NULL) || (host_id == NULL)) {
+    return;
+  }
+
+  wait_id = osTaskNew(host_id, TestTaskWait, NULL, &task_attr);
+  task_attr.name   = "yield";
+  task_attr.cb_mem = &yield_task_cb;
+  yield_id = osTaskNew(host_id, TestTaskYield, NULL, &task_attr);
+  TEST_ASSERT((wait_id != NULL) && (yield_id != NULL));
+
+  TEST_ASSERT(osThreadNew(TestTaskHost, host_id, &thread_attr) != NULL);
+
+  /* The host thread ran both tasks until the first wait */
+  TEST_ASSERT(osTaskGetState(wait_id) == osThreadBlocked);
+  TEST_ASSERT(osTaskGetState(yield_id) == osThreadInactive);
+  TEST_ASSERT(yield_count == TASK_ROUNDS);
+
+  for (uint32_t i = 0U; i < TASK_ROUNDS; i++) {
+    TEST_ASSERT(osSemaphoreRelease(task_sem) == osOK);
+  }
+
+  for (uint32_t i = 0U; (i < TASK_WAIT) && (wait_count < TASK_ROUNDS); i++) {
+    (void)osDelay(1U);
+  }
+
+  TEST_ASSERT(wait_count == TASK_ROUNDS);
+  TEST_ASSERT(osTaskGetState(wait_id) == osThreadInactive);
+}
+
+/*------------------------------ End of file ---------------------------------*/
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: mbOS real-time kernel
+ */
+
+/**
+ * @file
+ *
+ * Thread Pool tests: dispatched functions run on the workers and the workers
+ * refuse to be suspended or terminated.
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include "test.h"
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#define POOL_THREADS                  (2U)        ///< Worker threads of the pool
+#define POOL_JOBS                     (16U)       ///< Dispatched functions
+#define POOL_WAIT                     (100U)      ///< Ticks to wait for the jobs
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static volatile uint32_t job_count;
+
+static osThreadPool_t    pool_cb;
+static osThread_t        pool_thread_cb[POOL_THREADS];
+static uint64_t          pool_stack[POOL_THREADS][TEST_STACK_SIZE/8U];
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+static void TestPoolJob(void *argument)
+{
+  (void)argument;
+
+  job_count++;
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+void TestThreadPool(void)
+{
+  const osThreadPoolAttr_t attr = {
+    .name        = "pool",
+    .attr_bits   = 0U,
+    .cb_mem      = &pool_cb,
+    .cb_size     = sizeof(pool_cb),
+    .thread_mem  = &pool_thread_cb[0],
+    .thread_size = sizeof(pool_thread_cb),
+    .stack_mem   = &pool_stack[0][0],
+    .stack_size  = sizeof(pool_stack),
+    .priority    = osPriorityNormal,
+  };
+  osThreadPoolId_t pool_id;
+
+  job_count = 0U;
+
+  pool_id = osThreadPoolNew(POOL_THREADS, sizeof(pool_stack[0]), &attr);
+  TEST_ASSERT(pool_id != NULL);
+  if (pool_id == NULL) {
+    return;
+  }
+
+  /* Workers are owned by the pool */
+  for (uint32_t i = 0U; i < POOL_THREADS; i++) {
+    TEST_ASSERT(osThreadSuspend(&pool_thread_cb[i]) == osErrorResource);
+    TEST_ASSERT(osThreadTerminate(&pool_thread_cb[i]) == osErrorResource);
+  }
+
+  for (uint32_t i = 0U; i < POOL_JOBS; i++) {
+    TEST_ASSERT(osThreadPoolDispatch(pool_id, TestPoolJob, NULL, osWaitForever) == osOK);
+  }
+
+  for (uint32_t i = 0U; (i < POOL_WAIT) && (job_count < POOL_JOBS); i++) {
+    (void)osDelay(1U);
+  }
+
+  TEST_ASSERT(job_count == POOL_JOBS);
+  TEST_ASSERT(osThreadPoolGetIdleCount(pool_id) == POOL_THREADS);
+}
+
+/*------------------------------ End of file ---------------------------------*/
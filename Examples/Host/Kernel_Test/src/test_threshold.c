@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: mbOS real-time kernel
+ */
+
+/**
+ * @file
+ *
+ * Preemption threshold tests: a thread blocked by the threshold of the
+ * running thread has to run as soon as the threshold is lowered.
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include "test.h"
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static volatile uint32_t run_count;
+
+static osThread_t        thread_cb;
+static uint64_t          thread_stack[TEST_STACK_SIZE/8U];
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+static void TestThresholdThread(void *argument)
+{
+  (void)argument;
+
+  run_count++;
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+void TestThresholdLower(void)
+{
+  const osThreadAttr_t attr = {
+    .name       = "threshold",
+    .attr_bits  = osThreadDetached,
+    .cb_mem     = &thread_cb,
+    .cb_size    = sizeof(thread_cb),
+    .stack_mem  = &thread_stack[0],
+    .stack_size = sizeof(thread_stack),
+    .priority   = osPriorityNormal,
+    .threshold  = osPriorityNone,
+  };
+  osThreadId_t self = osThreadGetId();
+  osThreadId_t thread_id;
+
+  run_count = 0U;
+
+  TEST_ASSERT(osThreadSetThreshold(self, osPriorityAboveNormal) == osOK);
+
+  /* The threshold blocks the higher priority thread */
+  thread_id = osThreadNew(TestThresholdThread, NULL, &attr);
+  TEST_ASSERT(thread_id != NULL);
+  TEST_ASSERT(run_count == 0U);
+
+  /* A threshold equal to the thread priority keeps it blocked */
+  TEST_ASSERT(osThreadSetThreshold(self, osPriorityNormal) == osOK);
+  TEST_ASSERT(run_count == 0U);
+
+  /* Lowering the threshold below the thread priority preempts the caller */
+  TEST_ASSERT(osThreadSetThreshold(self, osPriorityNone) == osOK);
+  TEST_ASSERT(run_count == 1U);
+  TEST_ASSERT(osThreadGetState(thread_id) == osThreadError);
+}
+
+/*------------------------------ End of file ---------------------------------*/
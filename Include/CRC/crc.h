@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Description: CRC calculation with software and hardware backends.
+ */
+
+#ifndef CRC_H_
+#define CRC_H_
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdint.h>
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ *  defines and macros
+ ******************************************************************************/
+
+#ifndef CRC_HW
+#define CRC_HW                        (0U)        // Use the CRC unit of the device (requires a port)
+#endif
+
+#ifndef CRC_HW_MIN_SIZE
+#define CRC_HW_MIN_SIZE               (64U)       // Smaller blocks are computed in software
+#endif
+
+#ifndef CRC_DMA_MIN_SIZE
+#define CRC_DMA_MIN_SIZE              (1024U)     // Blocks fed to the CRC unit by DMA, if the port supports it
+#endif
+
+#ifndef CRC32_SLICE_BY_8
+#define CRC32_SLICE_BY_8              (1U)        // CRC-32 tables in flash: 1 - slicing-by-8 (8 KiB), 0 - bytewise (1 KiB)
+#endif
+
+/* CRC return codes */
+#define CRC_OK                        0
+#define CRC_ERROR                    -1
+#define CRC_ERROR_BUSY               -2           // CRC unit used by another caller
+#define CRC_ERROR_UNSUPPORTED        -3           // Algorithm not supported by the CRC unit
+#define CRC_PENDING                   1           // DMA transfer started
+
+/*******************************************************************************
+ *  typedefs and structures
+ ******************************************************************************/
+
+typedef enum CRC_Type {
+  CRC_TYPE_32 = 0,                  // CRC-32 (ISO-HDLC: Ethernet, zlib, PNG)
+  CRC_TYPE_16_CCITT,                // CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF)
+  CRC_TYPE_8,                       // CRC-8/SMBUS (poly 0x07, init 0x00)
+  CRC_TYPE_NUM
+} CRC_Type_t;
+
+/**
+ * @brief       CRC algorithm parameters.
+ */
+typedef struct CRC_Param_s {
+  uint32_t poly;                    // Polynomial, normal form
+  uint32_t init;                    // Initial register value
+  uint32_t xorout;                  // Value XORed to the final register
+  uint8_t  width;                   // Width in bits
+  uint8_t  reflect;                 // Input and output reflected, the register holds the reflected value
+} CRC_Param_t;
+
+/**
+ * @brief       Incremental CRC calculation.
+ */
+typedef struct CRC_Ctx_s {
+  const CRC_Param_t *param;
+  uint32_t           reg;           // Current register value
+} CRC_Ctx_t;
+
+/**
+ * @brief       Completion callback of a DMA fed block, called from interrupt.
+ * @param[in]   status  CRC_OK or CRC_ERROR
+ */
+typedef void (*CRC_PortCallback_t)(int32_t status);
+
+/*******************************************************************************
+ *  exported function prototypes
+ ******************************************************************************/
+
+/**
+ * @fn          int32_t CRC_Initialize(void)
+ * @brief       Initialize the CRC unit, after osKernelInitialize if DMA is
+ *              used. The software calculation needs no initialization, the
+ *              unit is used once this function has been called.
+ * @return      CRC_OK
+ */
+int32_t CRC_Initialize(void);
+
+/**
+ * @fn          void CRC_Start(CRC_Ctx_t *ctx, CRC_Type_t type)
+ * @brief       Start an incremental calculation.
+ * @param[out]  ctx   Pointer to the calculation context
+ * @param[in]   type  CRC algorithm
+ */
+void CRC_Start(CRC_Ctx_t *ctx, CRC_Type_t type);
+
+/**
+ * @fn          void CRC_Update(CRC_Ctx_t *ctx, const void *data, uint32_t len)
+ * @brief       Add data to an incremental calculation.
+ * @param[in]   ctx   Pointer to the calculation context
+ * @param[in]   data  Pointer to the data
+ * @param[in]   len   Data length in bytes
+ */
+void CRC_Update(CRC_Ctx_t *ctx, const void *data, uint32_t len);
+
+/**
+ * @fn          uint32_t CRC_Final(const CRC_Ctx_t *ctx)
+ * @brief       Get the result of an incremental calculation.
+ * @param[in]   ctx   Pointer to the calculation context
+ * @return      CRC value.
+ */
+uint32_t CRC_Final(const CRC_Ctx_t *ctx);
+
+/**
+ * @fn          uint32_t CRC_Calc(CRC_Type_t type, const void *data, uint32_t len)
+ * @brief       Calculate the CRC of a block.
+ * @param[in]   type  CRC algorithm
+ * @param[in]   data  Pointer to the data
+ * @param[in]   len   Data length in bytes
+ * @return      CRC value.
+ */
+uint32_t CRC_Calc(CRC_Type_t type, const void *data, uint32_t len);
+
+/*
+ * Hardware port, one implementation per device, used when CRC_HW != 0.
+ * Blocks handed to the port are word aligned and their length is a multiple
+ * of four, the CRC module calculates the remaining bytes in software.
+ */
+
+/**
+ * @fn          int32_t CRC_PortInitialize(void)
+ * @brief       Initialize the CRC unit.
+ * @return      CRC_OK or CRC_ERROR.
+ */
+int32_t CRC_PortInitialize(void);
+
+/**
+ * @fn          int32_t CRC_PortCalc(const CRC_Param_t *param, uint32_t *reg, const void *data, uint32_t len, CRC_PortCallback_t cb)
+ * @brief       Run a block through the CRC unit.
+ * @param[in]   param  CRC algorithm
+ * @param[in,out] reg  Register value
+ * @param[in]   data   Pointer to the data, word aligned
+ * @param[in]   len    Data length in bytes, multiple of four
+ * @param[in]   cb     Completion callback, NULL - no DMA. Ignored by ports
+ *                     without DMA and when called from an interrupt handler.
+ * @return      CRC_OK - done, reg updated
+ *              CRC_PENDING - DMA started, cb is called when it completes and
+ *                            CRC_PortFinish returns the result
+ *              CRC_ERROR_BUSY, CRC_ERROR_UNSUPPORTED - use software.
+ */
+int32_t CRC_PortCalc(const CRC_Param_t *param, uint32_t *reg, const void *data, uint32_t len, CRC_PortCallback_t cb);
+
+/**
+ * @fn          int32_t CRC_PortFinish(uint32_t *reg)
+ * @brief       Read the result of a DMA fed block and release the CRC unit.
+ * @param[out]  reg  Register value, unchanged on error
+ * @return      CRC_OK or CRC_ERROR.
+ */
+int32_t CRC_PortFinish(uint32_t *reg);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* CRC_H_ */
+
+/* ----------------------------- End of file ---------------------------------*/
@@ -101,10 +101,15 @@ uint32_t IRQ_GetMode (IRQn_ID_t irqn);
 /// \return interrupt ID number.
 IRQn_ID_t IRQ_GetActiveIRQ (void);
 
-/// Get ID number of current fast interrupt request (FIQ).
-/// \return interrupt ID number.
+/// Get the code of the current exception.
+/// \return exception code.
 IRQn_ID_t IRQ_GetActiveEXC (void);
 
+/// Get the handler of an exception.
+/// \param[in]     excn          exception code
+/// \return exception handler function address, never NULL.
+IRQHandler_t IRQ_GetExcHandler (IRQn_ID_t excn);
+
 /// Signal end of interrupt processing.
 /// \param[in]     irqn          interrupt ID number
 /// \return 0 on success, -1 on error.
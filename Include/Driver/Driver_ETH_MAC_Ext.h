@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: Ethernet MAC Driver extensions
+ */
+
+#ifndef DRIVER_ETH_MAC_EXT_H_
+#define DRIVER_ETH_MAC_EXT_H_
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <Driver/Driver_ETH_MAC.h>
+
+/*******************************************************************************
+ *  defines and macros
+ ******************************************************************************/
+
+/****** Ethernet MAC Control Codes (driver specific) *****/
+/*
+ * Zero-copy receive: ETH_MAC_RX_FRAME_BORROW hands out the DMA buffer of the
+ * frame reported by ARM_ETH_MAC_GetRxFrameSize and moves on to the next frame.
+ * The descriptor stays with the application until the buffer is given back
+ * with ETH_MAC_RX_FRAME_RETURN, buffers may be returned in any order. A frame
+ * with errors can not be borrowed and is discarded with ReadFrame(NULL, 0).
+ * The driver keeps a reserve of buffers with DMA and returns
+ * ARM_DRIVER_ERROR_BUSY when a borrow would take it, the frame is then read
+ * with ReadFrame.
+ *
+ * Zero-copy transmit: ETH_MAC_TX_BUFFER_GET returns the DMA buffer of the next
+ * transmit descriptor. A frame built there is sent by passing the same buffer
+ * to ARM_ETH_MAC_SendFrame, which then skips the copy. Fragments sent with
+ * ETH_MAC_TX_FRAME_NOCOPY are chained as descriptors of their own and read by
+ * DMA in place, their memory must stay valid until ETH_MAC_TX_RECLAIM reports
+ * the frame as transmitted. Frames are reclaimed in the order they were sent.
+ * A frame needing more descriptors than the driver has can never be sent, it
+ * is dropped and SendFrame returns ARM_DRIVER_ERROR. ETH_MAC_GET_TX_DESC_NUM
+ * reports the number of descriptors, every fragment may take one of them.
+ * ARM_ETH_MAC_FLUSH with ARM_ETH_MAC_FLUSH_TX drops a partly sent frame.
+ *
+ * Polled receive: with ETH_MAC_CONTROL_RX_POLL enabled the driver masks the
+ * receive interrupt after signaling ARM_ETH_MAC_EVENT_RX_FRAME. The receiving
+ * thread then reads the ring in batches of its own budget and calls
+ * ETH_MAC_RX_POLL_COMPLETE once GetRxFrameSize returns 0. The call unmasks the
+ * interrupt, or returns ARM_DRIVER_ERROR_BUSY when a frame arrived meanwhile
+ * and the thread has to keep polling.
+ */
+#define ETH_MAC_RX_FRAME_BORROW       (0x80UL)    ///< Borrow the buffer of the received frame; arg = pointer to \ref ETH_MAC_FRAME_BUF
+#define ETH_MAC_RX_FRAME_RETURN       (0x81UL)    ///< Return a borrowed receive buffer; arg = buffer address
+#define ETH_MAC_TX_BUFFER_GET         (0x82UL)    ///< Get the transmit buffer to fill in place; arg = pointer to \ref ETH_MAC_FRAME_BUF
+#define ETH_MAC_TX_RECLAIM            (0x83UL)    ///< Get the number of frames transmitted since the last call; arg = none
+#define ETH_MAC_CONTROL_RX_POLL       (0x84UL)    ///< Polled receive mode; arg: 0=disabled (default), 1=enabled
+#define ETH_MAC_RX_POLL_COMPLETE      (0x85UL)    ///< Receive ring drained, unmask the receive interrupt; arg = none
+#define ETH_MAC_GET_RX_STATS          (0x86UL)    ///< Get receive statistics; arg = pointer to \ref ETH_MAC_RX_STATS
+#define ETH_MAC_GET_TX_DESC_NUM       (0x87UL)    ///< Get the number of transmit descriptors; arg = none
+
+/****** Ethernet MAC Frame Transmit Flags (driver specific) *****/
+#define ETH_MAC_TX_FRAME_NOCOPY       (1UL << 31) ///< Fragment is read by DMA in place
+
+/*******************************************************************************
+ *  typedefs and structures
+ ******************************************************************************/
+
+/**
+ * @brief Ethernet MAC frame buffer.
+ */
+typedef struct _ETH_MAC_FRAME_BUF {
+  uint8_t                      *data;     ///< Buffer address
+  uint32_t                      len;      ///< Frame length (receive) or buffer size (transmit) in bytes
+} ETH_MAC_FRAME_BUF;
+
+/**
+ * @brief Ethernet MAC receive statistics, counted since power up.
+ */
+typedef struct _ETH_MAC_RX_STATS {
+  uint32_t                      frames;     ///< Frames read from the ring
+  uint32_t                      errors;     ///< Frames with errors read from the ring
+  uint32_t                      rbus;       ///< DMA suspended on a full ring (receive buffer unavailable)
+  uint32_t                      missed;     ///< Frames dropped by DMA or on receive FIFO overflow
+  uint32_t                      interrupts; ///< Receive interrupts
+  uint32_t                      batches;    ///< Completed poll batches
+  uint32_t                      batch_max;  ///< Largest poll batch in frames
+} ETH_MAC_RX_STATS;
+
+#endif /* DRIVER_ETH_MAC_EXT_H_ */
+
+/* ----------------------------- End of file ---------------------------------*/
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: SPI Driver extensions
+ */
+
+#ifndef DRIVER_SPI_EXT_H_
+#define DRIVER_SPI_EXT_H_
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <Driver/Driver_SPI.h>
+
+/*******************************************************************************
+ *  defines and macros
+ ******************************************************************************/
+
+/****** SPI Control Codes (driver specific) *****/
+/*
+ * Transfer list: the driver executes the segments one after another from its
+ * interrupt handlers and signals ARM_SPI_EVENT_TRANSFER_COMPLETE once, after
+ * the last segment. The segment array must stay valid until then. Chip select
+ * pins are toggled with GPIO writes and must be configured as outputs by the
+ * application. ARM_SPI_ABORT_TRANSFER releases the chip select of the current
+ * segment.
+ *
+ * A segment with SPI_SEGMENT_PAUSE stops the list after its data, the driver
+ * signals SPI_EVENT_SEGMENT_PAUSE and stays busy. The application waits as
+ * long as the device needs (osDelay, a timer) and continues the list with
+ * SPI_CONTROL_TRANSFER_RESUME. The driver never waits in its interrupt
+ * handlers. The pause flag of the last segment is ignored.
+ */
+#define SPI_CONTROL_TRANSFER_LIST     (0x80UL << ARM_SPI_CONTROL_Pos)     ///< Start a transfer list; arg = pointer to \ref SPI_TRANSFER_LIST
+#define SPI_CONTROL_TRANSFER_RESUME   (0x81UL << ARM_SPI_CONTROL_Pos)     ///< Continue a paused transfer list; arg: not used
+
+/****** SPI Event (driver specific) *****/
+#define SPI_EVENT_SEGMENT_PAUSE       (1UL << 14) ///< Transfer list paused after a segment with SPI_SEGMENT_PAUSE
+
+/****** SPI Segment chip select *****/
+#define SPI_SEGMENT_CS_ASSERT         (1U << 0)   ///< Drive the chip select low before the segment
+#define SPI_SEGMENT_CS_RELEASE        (1U << 1)   ///< Drive the chip select high after the segment
+
+/****** SPI Segment flags *****/
+#define SPI_SEGMENT_PAUSE             (1U << 0)   ///< Pause the list after the segment
+
+/*******************************************************************************
+ *  typedefs and structures
+ ******************************************************************************/
+
+/**
+ * @brief SPI transfer list segment.
+ */
+typedef struct _SPI_SEGMENT {
+  const void                   *data_out; ///< Data to send, NULL sends the default transfer value
+  void                         *data_in;  ///< Buffer for received data, NULL discards the data
+  uint32_t                      num;      ///< Number of data items
+  uint8_t                       cs;       ///< Chip select control: SPI_SEGMENT_CS_xxx
+  uint8_t                       cs_port;  ///< Chip select GPIO port
+  uint8_t                       cs_pin;   ///< Chip select GPIO pin
+  uint8_t                       flags;    ///< Segment flags: SPI_SEGMENT_xxx
+} SPI_SEGMENT;
+
+/**
+ * @brief SPI transfer list.
+ */
+typedef struct _SPI_TRANSFER_LIST {
+  const SPI_SEGMENT            *segment;  ///< Segment array
+  uint32_t                      num;      ///< Number of segments
+} SPI_TRANSFER_LIST;
+
+#endif /* DRIVER_SPI_EXT_H_ */
+
+/* ----------------------------- End of file ---------------------------------*/
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: USART Driver extensions
+ */
+
+#ifndef DRIVER_USART_EXT_H_
+#define DRIVER_USART_EXT_H_
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <Driver/Driver_USART.h>
+
+/*******************************************************************************
+ *  defines and macros
+ ******************************************************************************/
+
+/****** USART Control Codes (driver specific) *****/
+/*
+ * Continuous receive: when enabled the next ARM_USART_Receive(data, num) starts
+ * a circular DMA transfer into the ring buffer data of num items that never
+ * completes. New data is signaled with USART_EVENT_RX_DATA (half and full
+ * ring) and ARM_USART_EVENT_RX_TIMEOUT (idle line, receiver timeout) and is
+ * read in place with USART_GET_RX_SPANS and USART_RELEASE_RX_DATA.
+ * ARM_USART_ABORT_RECEIVE stops the ring.
+ */
+#define USART_CONTROL_RX_CONTINUOUS   (0x80UL << ARM_USART_CONTROL_Pos)   ///< Continuous receive mode; arg: 0=disabled, 1=enabled
+#define USART_GET_RX_SPANS            (0x81UL << ARM_USART_CONTROL_Pos)   ///< Get unread data of the ring; arg = pointer to \ref USART_RX_SPANS
+#define USART_RELEASE_RX_DATA         (0x82UL << ARM_USART_CONTROL_Pos)   ///< Release data read from the ring; arg = number of items
+#define USART_CONTROL_RX_TIMEOUT      (0x83UL << ARM_USART_CONTROL_Pos)   ///< Receiver timeout in bit periods; arg: 0=disabled
+
+/****** USART Event (driver specific) *****/
+#define USART_EVENT_RX_DATA           (1UL << 14) ///< New data in the continuous receive ring
+
+/*******************************************************************************
+ *  typedefs and structures
+ ******************************************************************************/
+
+/**
+ * @brief USART unread data of the continuous receive ring.
+ *
+ * The data is returned as up to two contiguous spans, the second one is used
+ * when the unread data wraps around the end of the ring.
+ */
+typedef struct _USART_RX_SPANS {
+  void                         *data[2];  ///< Span start
+  uint32_t                      num[2];   ///< Number of items in the span
+} USART_RX_SPANS;
+
+#endif /* DRIVER_USART_EXT_H_ */
+
+/* ----------------------------- End of file ---------------------------------*/
@@ -92,16 +92,29 @@ extern "C"
 /* Thread attributes (attr_bits in \ref osThreadAttr_t) */
 #define osThreadDetached              0x00000000U ///< Thread created in detached mode (default)
 #define osThreadJoinable              0x00000001U ///< Thread created in joinable mode
+#define osThreadRunToCompletion       0x00000008U ///< Thread runs to completion on a shared stack
+
+/* Interrupt thread attributes (attr_bits in \ref osIrqThreadAttr_t) */
+#define osIrqThreadMaskIrq            0x00000001U ///< Interrupt stays masked until the bottom half completes
+
+/* Stackless task continuation (\ref osTaskBegin) */
+#define osTaskLineEnd                 0xFFFFU     ///< Task function has completed.
 
 /* Mutex attributes */
 #define osMutexPrioInherit            (1UL<<0)    ///< Priority inherit protocol.
 #define osMutexRecursive              (1UL<<1)    ///< Recursive mutex.
 #define osMutexRobust                 (1UL<<2)    ///< Robust mutex.
+#define osMutexPrioCeiling            (1UL<<3)    ///< Immediate priority ceiling protocol.
+#define osMutexPrioBuckets            (1UL<<4)    ///< Priority bucketed wait queue.
+
+/* Semaphore attributes */
+#define osSemaphorePrioBuckets        (1UL<<0)    ///< Priority bucketed wait queue.
 
 /* OS Configuration flags */
 #define osConfigPrivilegedMode        (1UL<<0)    ///< Threads in Privileged mode
 #define osConfigStackCheck            (1UL<<1)    ///< Stack overrun checking
 #define osConfigStackWatermark        (1UL<<2)    ///< Stack usage Watermark
+#define osConfigDirectCall            (1UL<<3)    ///< Direct kernel calls from privileged threads
 
 /* Timeout value */
 #define osWaitForever                 (0xFFFFFFFF)
@@ -120,6 +133,16 @@ extern "C"
 #define osSemaphoreCbSize             sizeof(osSemaphore_t)
 #define osMemoryPoolCbSize            sizeof(osMemoryPool_t)
 #define osMessageQueueCbSize          sizeof(osMessageQueue_t)
+#define osThreadPoolCbSize            sizeof(osThreadPool_t)
+#define osWorkQueueCbSize             sizeof(osWorkQueue_t)
+#define osWorkCbSize                  sizeof(osWork_t)
+#define osIrqThreadCbSize             sizeof(osIrqThread_t)
+#define osTaskCbSize                  sizeof(osTask_t)
+#define osTaskHostCbSize              sizeof(osTaskHost_t)
+
+/// Additional control block memory for a priority bucketed wait queue
+/// (\ref osSemaphorePrioBuckets, \ref osMutexPrioBuckets).
+#define osWaitBucketsSize             sizeof(wait_buckets_t)
 
 /// Memory size in bytes for Memory Pool storage.
 /// \param         block_count   maximum number of memory blocks in memory pool.
@@ -231,12 +254,22 @@ typedef void (*osThreadFunc_t)(void *argument);
 /// Timer callback function.
 typedef void (*osTimerFunc_t)(void *argument);
 
+/// Entry point of a stackless task, called again at every continuation.
+typedef void (*osTaskFunc_t)(void *task, void *argument);
+
 /* Circular double-linked list queue */
 typedef struct queue_s {
   struct queue_s *next;
   struct queue_s *prev;
 } queue_t;
 
+/* Priority buckets of a wait queue, each bucket is a run of equal priority waiters */
+typedef struct wait_buckets_s {
+  uint32_t                        bmp;  ///< Bitmap of non-empty buckets
+  queue_t         *tail[NUM_PRIORITY];  ///< Last waiter in each bucket
+  uint16_t        count[NUM_PRIORITY];  ///< Number of waiters in each bucket (up to 65535)
+} wait_buckets_t;
+
 /* Timer Function Information */
 typedef struct osTimerFinfo {
   osTimerFunc_t                  func;  ///< Function Pointer
@@ -257,6 +290,11 @@ typedef struct winfo_flags {
   uint32_t options;
 } winfo_flags_t;
 
+typedef struct winfo_pool {
+  uint32_t func;
+  uint32_t argument;
+} winfo_pool_t;
+
 /*
  * Definition of wait information in thread control block
  */
@@ -266,6 +304,8 @@ typedef struct winfo_s {
     winfo_dataque_t dataque;
     winfo_flags_t   event;
     winfo_flags_t   thread;
+    winfo_pool_t    pool;
+    uint32_t        bucket;             ///< Priority bucket of a bucketed wait queue
   };
   uint32_t ret_val;
 } winfo_t;
@@ -291,43 +331,110 @@ typedef void *osMessageQueueId_t;
 /// \details Data Queue ID identifies the data queue.
 typedef void *osDataQueueId_t;
 
+/// \details Thread Pool ID identifies the thread pool.
+typedef void *osThreadPoolId_t;
+
+/// \details Work Queue ID identifies the work queue.
+typedef void *osWorkQueueId_t;
+
+/// \details Work ID identifies the work item.
+typedef void *osWorkId_t;
+
+/// \details Interrupt Thread ID identifies the threaded interrupt handler.
+typedef void *osIrqThreadId_t;
+
+/// \details Task ID identifies the stackless task.
+typedef void *osTaskId_t;
+
+/// \details Task Host ID identifies the stackless task host.
+typedef void *osTaskHostId_t;
+
 /// \details Memory Pool ID identifies the memory pool.
 typedef void *osMemoryPoolId_t;
 
-/* Thread Control Block */
+/* Thread Control Block (fields up to winfo are shared with osTask_t) */
 typedef struct osThread_s {
   uint32_t                        stk;  ///< Address of thread's top of stack
   uint32_t                 exc_return;
   queue_t                  thread_que;  ///< Queue is used to include thread in ready/wait lists
-  queue_t                   mutex_que;  ///< List of all mutexes that tack locked
   queue_t                   delay_que;  ///< Queue is used to include thread id delay list
   uint32_t                      delay;  ///< Delay Time
-  void                       *stk_mem;  ///< Base address of thread's stack space
-  uint32_t                   stk_size;  ///< Task's stack size (in bytes)
-  uint32_t                 time_slice;  ///< Task time slice
   int8_t                base_priority;  ///< Task base priority
   int8_t                     priority;  ///< Task current priority
-  uint16_t                   reserved;
+  int8_t                    threshold;  ///< Task preemption threshold
+  uint8_t                   preempted;  ///< Preempted with active threshold
   uint8_t                          id;  ///< ID for verification(is it a thread or another object?)
   uint8_t                       state;  ///< Task state
   uint8_t                       flags;  ///< Object Flags
   uint8_t                        attr;  ///< Object Attributes
-  queue_t                  post_queue;  ///< Post Processing queue
+  void                     *post_link;  ///< Post Processing list link
+  wait_buckets_t             *buckets;  ///< Priority buckets of the wait queue or NULL
   winfo_t                       winfo;  ///< Wait information
+  queue_t                   mutex_que;  ///< List of all mutexes that tack locked
+  void                       *stk_mem;  ///< Base address of thread's stack space
+  uint32_t                   stk_size;  ///< Task's stack size (in bytes)
+  uint32_t                 time_slice;  ///< Task time slice
   uint32_t               thread_flags;  ///< Thread Flags
   const char                    *name;  ///< Object Name
+  struct osTask_s               *task;  ///< Stackless task executed by the thread
+  struct osThread_s         *run_link;  ///< Next run-to-completion thread in the middle of a run
+  uint32_t                    run_top;  ///< Stack top of the current run, 0 at the entry point
+  osThreadFunc_t                 func;  ///< Run-to-completion thread function
+  void                      *argument;  ///< Run-to-completion thread function argument
+  uint32_t                  run_flags;  ///< Thread Flags pending when the current run started
 } osThread_t;
 
+/*
+ * Stackless Task Control Block. The fields up to winfo are shared with
+ * osThread_t, the wait functions handle a waiting task as a thread. Fields of
+ * a thread that a task never uses are kept at the end of osThread_t.
+ */
+typedef struct osTask_s {
+  uint32_t               reserved_stk;
+  uint32_t        reserved_exc_return;
+  queue_t                  thread_que;  ///< Queue is used to include task in ready/wait lists
+  queue_t                   delay_que;  ///< Queue is used to include task in delay list
+  uint32_t                      delay;  ///< Delay Time
+  uint8_t                     waiting;  ///< Wait state entered during the current run
+  int8_t                     priority;  ///< Task priority in wait queues
+  uint16_t                         lc;  ///< Continuation point
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Task state
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                        attr;  ///< Object Attributes
+  void                     *post_link;  ///< Post Processing list link
+  wait_buckets_t             *buckets;  ///< Priority buckets of the wait queue or NULL
+  winfo_t                       winfo;  ///< Wait information
+  osTaskFunc_t                   func;  ///< Task function
+  void                      *argument;  ///< Task function argument
+  struct osTaskHost_s           *host;  ///< Task host
+  const char                    *name;  ///< Object Name
+} osTask_t;
+
+/* Stackless Task Host Control Block */
+typedef struct osTaskHost_s {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t              reserved_state;  ///< Object State (not used)
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                    reserved;
+  void                     *post_link;  ///< Post Processing list link
+  queue_t                 ready_queue;  ///< Queue of tasks ready to continue
+  queue_t                  wait_queue;  ///< Host thread waiting for a ready task
+  osThread_t                  *thread;  ///< Thread executing the tasks
+  const char                    *name;  ///< Object Name
+} osTaskHost_t;
+
 /* Semaphore Control Block */
 typedef struct osSemaphore_s {
   uint8_t                          id;  ///< Object Identifier
   uint8_t              reserved_state;  ///< Object State (not used)
   uint8_t                       flags;  ///< Object Flags
   uint8_t                    reserved;
-  queue_t                  post_queue;  ///< Post Processing queue
+  void                     *post_link;  ///< Post Processing list link
   queue_t                  wait_queue;  ///< Waiting Threads queue
   uint16_t                      count;  ///< Current number of tokens
   uint16_t                  max_count;  ///< Maximum number of tokens
+  wait_buckets_t             *buckets;  ///< Priority buckets of the wait queue (optional)
   const char                    *name;  ///< Object Name
 } osSemaphore_t;
 
@@ -337,9 +444,11 @@ typedef struct osEventFlags_s {
   uint8_t              reserved_state;  ///< Object State (not used)
   uint8_t                       flags;  ///< Object Flags
   uint8_t                    reserved;
-  queue_t                  post_queue;  ///< Post Processing queue
+  void                     *post_link;  ///< Post Processing list link
   queue_t                  wait_queue;  ///< Waiting Threads queue
   uint32_t                event_flags;  ///< Initial value of the eventflag bit pattern
+  uint32_t                 wait_flags;  ///< Flags waited for by the waiting Threads (superset)
+  uint32_t                 post_flags;  ///< Flags set from ISR and not yet processed
   const char                    *name;  ///< Object Name
 } osEventFlags_t;
 
@@ -361,7 +470,7 @@ typedef struct osMemoryPool_s {
   uint8_t              reserved_state;  ///< Object State (not used)
   uint8_t                       flags;  ///< Object Flags
   uint8_t                    reserved;
-  queue_t                  post_queue;  ///< Post Processing queue
+  void                     *post_link;  ///< Post Processing list link
   queue_t                  wait_queue;  ///< Waiting Threads queue
   osMemoryPoolInfo_t             info;  ///< Memory Pool Info
   const char                    *name;  ///< Object Name
@@ -384,7 +493,7 @@ typedef struct osMessageQueue_s {
   uint8_t              reserved_state;  ///< Object State (not used)
   uint8_t                       flags;  ///< Object Flags
   uint8_t                    reserved;
-  queue_t                  post_queue;  ///< Post Processing queue
+  void                     *post_link;  ///< Post Processing list link
   queue_t              wait_put_queue;  ///< Queue of threads waiting to send a message
   queue_t              wait_get_queue;  ///< Queue of threads waiting to receive a message
   osMemoryPoolInfo_t          mp_info;  ///< Memory Pool Info
@@ -400,7 +509,7 @@ typedef struct osDataQueue_s {
   uint8_t              reserved_state;  ///< Object State (not used)
   uint8_t                       flags;  ///< Object Flags
   uint8_t                    reserved;
-  queue_t                  post_queue;  ///< Post Processing queue
+  void                     *post_link;  ///< Post Processing list link
   queue_t              wait_put_queue;  ///< Queue of threads waiting to send a data
   queue_t              wait_get_queue;  ///< Queue of threads waiting to receive a data
   uint32_t             max_data_count;  ///< Maximum number of Data
@@ -413,17 +522,77 @@ typedef struct osDataQueue_s {
   const char                    *name;  ///< Object Name
 } osDataQueue_t;
 
+/* Thread Pool Control Block */
+typedef struct osThreadPool_s {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t              reserved_state;  ///< Object State (not used)
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                    reserved;
+  void                     *post_link;  ///< Post Processing list link
+  queue_t                  idle_queue;  ///< Queue of worker threads waiting for a function
+  queue_t                  wait_queue;  ///< Queue of threads waiting for an idle worker
+  uint32_t               thread_count;  ///< Number of worker threads
+  uint32_t                 idle_count;  ///< Number of idle worker threads
+  const char                    *name;  ///< Object Name
+} osThreadPool_t;
+
+/* Work Queue Control Block */
+typedef struct osWorkQueue_s {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t              reserved_state;  ///< Object State (not used)
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                    reserved;
+  void                     *post_link;  ///< Post Processing list link
+  queue_t                  work_queue;  ///< Queue of work items ready to run
+  queue_t                 delay_queue;  ///< Queue of delayed work items sorted by time
+  queue_t                  wait_queue;  ///< Worker thread waiting for work
+  const char                    *name;  ///< Object Name
+} osWorkQueue_t;
+
+/* Work Item Control Block */
+typedef struct osWork_s {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                    reserved;
+  void                     *post_link;  ///< Post Processing list link
+  queue_t                    work_que;  ///< Queue is used to include work item in work queue lists
+  uint32_t                      delay;  ///< Delay requested from ISR
+  uint32_t                       time;  ///< Time the delayed work item is due
+  osThreadFunc_t                 func;  ///< Work function
+  void                      *argument;  ///< Work function argument
+  osWorkQueue_t                   *wq;  ///< Work queue running the work item
+  const char                    *name;  ///< Object Name
+} osWork_t;
+
+/* Interrupt Thread Control Block */
+typedef struct osIrqThread_s {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Interrupt line state
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                        attr;  ///< Object Attributes
+  void                     *post_link;  ///< Post Processing list link
+  queue_t                  wait_queue;  ///< Bottom half thread waiting for the interrupt
+  int32_t                        irqn;  ///< Interrupt masked until the bottom half completes
+  uint32_t                    pending;  ///< Interrupt signaled, bottom half has to run
+  osThreadFunc_t                 func;  ///< Bottom half function
+  void                      *argument;  ///< Bottom half function argument
+  const char                    *name;  ///< Object Name
+} osIrqThread_t;
+
 /* Mutex Control Block */
 typedef struct osMutex_s {
   uint8_t                          id;  ///< Object Identifier
   uint8_t              reserved_state;  ///< Object State (not used)
   uint8_t                       flags;  ///< Object Flags
   uint8_t                        attr;  ///< Object Attributes
-  queue_t                  post_queue;  ///< Post Processing queue
+  void                     *post_link;  ///< Post Processing list link
   queue_t                    wait_que;  ///< List of tasks that wait a mutex
   queue_t                   mutex_que;  ///< To include in thread's locked mutexes list (if any)
   osThread_t                  *holder;  ///< Current mutex owner(thread that locked mutex)
   uint32_t                        cnt;  ///< Lock counter
+  int8_t                      ceiling;  ///< Priority ceiling
+  wait_buckets_t             *buckets;  ///< Priority buckets of the wait queue (optional)
   const char                    *name;  ///< Object Name
 } osMutex_t;
 
@@ -455,6 +624,7 @@ typedef struct {
   void                    *stack_mem;   ///< memory for stack
   uint32_t                stack_size;   ///< size of stack
   osPriority_t              priority;   ///< initial thread priority (default: osPriorityNormal)
+  osPriority_t             threshold;   ///< preemption threshold (default: osPriorityNone - disabled)
 } osThreadAttr_t;
 
 /// Attributes structure for timer.
@@ -487,6 +657,7 @@ typedef struct {
   uint32_t                 attr_bits;   ///< attribute bits
   void                       *cb_mem;   ///< memory for control block
   uint32_t                   cb_size;   ///< size of provided memory for control block
+  osPriority_t               ceiling;   ///< priority ceiling (\ref osMutexPrioCeiling only)
 } osMutexAttr_t;
 
 /// Attributes structure for message queue.
@@ -509,6 +680,71 @@ typedef struct osDataQueueAttr_s {
   uint32_t                   dq_size;   ///< size of provided memory for data storage
 } osDataQueueAttr_t;
 
+/// Attributes structure for thread pool.
+typedef struct osThreadPoolAttr_s {
+  const char                   *name;   ///< name of the thread pool and its worker threads
+  uint32_t                 attr_bits;   ///< attribute bits
+  void                       *cb_mem;   ///< memory for control block
+  uint32_t                   cb_size;   ///< size of provided memory for control block
+  void                   *thread_mem;   ///< memory for worker thread control blocks
+  uint32_t               thread_size;   ///< size of provided memory for worker thread control blocks
+  void                    *stack_mem;   ///< memory for worker thread stacks
+  uint32_t                stack_size;   ///< size of provided memory for worker thread stacks
+  osPriority_t              priority;   ///< worker thread priority (default: osPriorityNormal)
+} osThreadPoolAttr_t;
+
+/// Attributes structure for work queue.
+typedef struct osWorkQueueAttr_s {
+  const char                   *name;   ///< name of the work queue and its worker thread
+  uint32_t                 attr_bits;   ///< attribute bits
+  void                       *cb_mem;   ///< memory for control block
+  uint32_t                   cb_size;   ///< size of provided memory for control block
+  void                   *thread_mem;   ///< memory for worker thread control block
+  uint32_t               thread_size;   ///< size of provided memory for worker thread control block
+  void                    *stack_mem;   ///< memory for worker thread stack
+  uint32_t                stack_size;   ///< size of worker thread stack
+  osPriority_t              priority;   ///< worker thread priority (default: osPriorityNormal)
+} osWorkQueueAttr_t;
+
+/// Attributes structure for work item.
+typedef struct osWorkAttr_s {
+  const char                   *name;   ///< name of the work item
+  uint32_t                 attr_bits;   ///< attribute bits
+  void                       *cb_mem;   ///< memory for control block
+  uint32_t                   cb_size;   ///< size of provided memory for control block
+} osWorkAttr_t;
+
+/// Attributes structure for interrupt thread.
+typedef struct osIrqThreadAttr_s {
+  const char                   *name;   ///< name of the interrupt thread
+  uint32_t                 attr_bits;   ///< attribute bits
+  void                       *cb_mem;   ///< memory for control block
+  uint32_t                   cb_size;   ///< size of provided memory for control block
+  void                   *thread_mem;   ///< memory for bottom half thread control block
+  uint32_t               thread_size;   ///< size of provided memory for bottom half thread control block
+  void                    *stack_mem;   ///< memory for bottom half thread stack
+  uint32_t                stack_size;   ///< size of bottom half thread stack
+  osPriority_t              priority;   ///< bottom half thread priority (default: osPriorityNormal)
+  int32_t                       irqn;   ///< interrupt number masked with \ref osIrqThreadMaskIrq
+} osIrqThreadAttr_t;
+
+/// Attributes structure for stackless task.
+typedef struct osTaskAttr_s {
+  const char                   *name;   ///< name of the task
+  uint32_t                 attr_bits;   ///< attribute bits
+  void                       *cb_mem;   ///< memory for control block
+  uint32_t                   cb_size;   ///< size of provided memory for control block
+  osPriority_t              priority;   ///< priority in wait queues (default: osPriorityNormal)
+} osTaskAttr_t;
+
+/// Attributes structure for stackless task host.
+typedef struct osTaskHostAttr_s {
+  const char                   *name;   ///< name of the task host
+  uint32_t                 attr_bits;   ///< attribute bits
+  void                       *cb_mem;   ///< memory for control block
+  uint32_t                   cb_size;   ///< size of provided memory for control block
+} osTaskHostAttr_t;
+
 /// Attributes structure for memory pool.
 typedef struct {
   const char                   *name;   ///< name of the memory pool
@@ -528,6 +764,7 @@ typedef struct osConfig_s {
   osThreadAttr_t           *idle_thread_attr;   ///< Idle Thread Attributes
   const
   osThreadAttr_t          *timer_thread_attr;   ///< Timer Thread Attributes
+  uint32_t                      isr_prio_max;   ///< Maximum syscall interrupt priority
 } osConfig_t;
 
 /*******************************************************************************
@@ -706,6 +943,9 @@ osStatus_t osTimerDelete(osTimerId_t timer_id);
  * @param[in]   argument  pointer that is passed to the thread function as start argument.
  * @param[in]   attr      thread attributes.
  * @return      thread ID for reference by other functions or NULL in case of error.
+ * @note        A thread created with \ref osThreadRunToCompletion starts a new
+ *              run while any Thread Flag is set. The flags pending when a run
+ *              starts are cleared when it returns.
  */
 osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr);
 
@@ -754,6 +994,8 @@ uint32_t osThreadGetStackSpace(osThreadId_t thread_id);
  * @param[in]   thread_id   thread ID obtained by \ref osThreadNew or \ref osThreadGetId.
  * @param[in]   priority    new priority value for the thread function.
  * @return      status code that indicates the execution status of the function.
+ * @note        Returns osErrorResource for a run-to-completion thread in the
+ *              middle of a run.
  */
 osStatus_t osThreadSetPriority(osThreadId_t thread_id, osPriority_t priority);
 
@@ -765,6 +1007,25 @@ osStatus_t osThreadSetPriority(osThreadId_t thread_id, osPriority_t priority);
  */
 osPriority_t osThreadGetPriority(osThreadId_t thread_id);
 
+/**
+ * @fn          osStatus_t osThreadSetThreshold(osThreadId_t thread_id, osPriority_t threshold)
+ * @brief       Change preemption threshold of a thread.
+ * @param[in]   thread_id   thread ID obtained by \ref osThreadNew or \ref osThreadGetId.
+ * @param[in]   threshold   new preemption threshold (osPriorityNone - disabled).
+ * @return      status code that indicates the execution status of the function.
+ * @note        Returns osErrorResource for a run-to-completion thread in the
+ *              middle of a run.
+ */
+osStatus_t osThreadSetThreshold(osThreadId_t thread_id, osPriority_t threshold);
+
+/**
+ * @fn          osPriority_t osThreadGetThreshold(osThreadId_t thread_id)
+ * @brief       Get preemption threshold of a thread.
+ * @param[in]   thread_id   thread ID obtained by \ref osThreadNew or \ref osThreadGetId.
+ * @return      preemption threshold of the specified thread (osPriorityNone - disabled).
+ */
+osPriority_t osThreadGetThreshold(osThreadId_t thread_id);
+
 /**
  * @fn          osStatus_t osThreadYield(void)
  * @brief       Pass control to next thread that is in state READY.
@@ -1114,6 +1375,218 @@ osStatus_t osDataQueueReset(osDataQueueId_t dq_id);
  */
 osStatus_t osDataQueueDelete(osDataQueueId_t dq_id);
 
+/*******************************************************************************
+ *  Thread Pool
+ ******************************************************************************/
+
+/**
+ * @fn          osThreadPoolId_t osThreadPoolNew(uint32_t thread_count, uint32_t stack_size, const osThreadPoolAttr_t *attr)
+ * @brief       Create a Thread Pool and start its worker threads.
+ * @param[in]   thread_count  number of worker threads.
+ * @param[in]   stack_size    stack size of each worker thread in bytes.
+ * @param[in]   attr          thread pool attributes.
+ * @return      thread pool ID for reference by other functions or NULL in case of error.
+ * @note        Worker threads cannot be suspended, resumed or terminated,
+ *              these functions return osErrorResource for them.
+ */
+osThreadPoolId_t osThreadPoolNew(uint32_t thread_count, uint32_t stack_size, const osThreadPoolAttr_t *attr);
+
+/**
+ * @fn          const char *osThreadPoolGetName(osThreadPoolId_t pool_id)
+ * @brief       Get name of a Thread Pool object.
+ * @param[in]   pool_id   thread pool ID obtained by \ref osThreadPoolNew.
+ * @return      name as null-terminated string or NULL in case of an error.
+ */
+const char *osThreadPoolGetName(osThreadPoolId_t pool_id);
+
+/**
+ * @fn          osStatus_t osThreadPoolDispatch(osThreadPoolId_t pool_id, osThreadFunc_t func, void *argument, uint32_t timeout)
+ * @brief       Run a function on an idle worker thread or timeout if all workers are busy.
+ * @param[in]   pool_id   thread pool ID obtained by \ref osThreadPoolNew.
+ * @param[in]   func      function executed by the worker thread.
+ * @param[in]   argument  pointer that is passed to the function.
+ * @param[in]   timeout   \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+ * @return      status code that indicates the execution status of the function.
+ */
+osStatus_t osThreadPoolDispatch(osThreadPoolId_t pool_id, osThreadFunc_t func, void *argument, uint32_t timeout);
+
+/**
+ * @fn          uint32_t osThreadPoolGetIdleCount(osThreadPoolId_t pool_id)
+ * @brief       Get number of idle worker threads in a Thread Pool.
+ * @param[in]   pool_id   thread pool ID obtained by \ref osThreadPoolNew.
+ * @return      number of idle worker threads or 0 in case of an error.
+ */
+uint32_t osThreadPoolGetIdleCount(osThreadPoolId_t pool_id);
+
+/*******************************************************************************
+ *  Work Queue
+ ******************************************************************************/
+
+/**
+ * @fn          osWorkQueueId_t osWorkQueueNew(const osWorkQueueAttr_t *attr)
+ * @brief       Create a Work Queue and start its worker thread.
+ * @param[in]   attr    work queue attributes.
+ * @return      work queue ID for reference by other functions or NULL in case of error.
+ */
+osWorkQueueId_t osWorkQueueNew(const osWorkQueueAttr_t *attr);
+
+/**
+ * @fn          const char *osWorkQueueGetName(osWorkQueueId_t wq_id)
+ * @brief       Get name of a Work Queue object.
+ * @param[in]   wq_id   work queue ID obtained by \ref osWorkQueueNew.
+ * @return      name as null-terminated string or NULL in case of an error.
+ */
+const char *osWorkQueueGetName(osWorkQueueId_t wq_id);
+
+/**
+ * @fn          osWorkId_t osWorkNew(osWorkQueueId_t wq_id, osThreadFunc_t func, void *argument, const osWorkAttr_t *attr)
+ * @brief       Create a Work item bound to a Work Queue.
+ * @param[in]   wq_id     work queue ID obtained by \ref osWorkQueueNew.
+ * @param[in]   func      function executed by the worker thread.
+ * @param[in]   argument  pointer that is passed to the function.
+ * @param[in]   attr      work item attributes.
+ * @return      work item ID for reference by other functions or NULL in case of error.
+ */
+osWorkId_t osWorkNew(osWorkQueueId_t wq_id, osThreadFunc_t func, void *argument, const osWorkAttr_t *attr);
+
+/**
+ * @fn          osStatus_t osWorkSubmit(osWorkId_t work_id, uint32_t delay)
+ * @brief       Submit a Work item, a submission of a pending item is merged with it.
+ * @param[in]   work_id   work item ID obtained by \ref osWorkNew.
+ * @param[in]   delay     delay in ticks before the item runs or 0 to run it at once.
+ * @return      status code that indicates the execution status of the function.
+ * @note        Can be called from Interrupt Service Routines.
+ */
+osStatus_t osWorkSubmit(osWorkId_t work_id, uint32_t delay);
+
+/**
+ * @fn          osStatus_t osWorkCancel(osWorkId_t work_id)
+ * @brief       Remove a pending Work item from its Work Queue.
+ * @param[in]   work_id   work item ID obtained by \ref osWorkNew.
+ * @return      status code that indicates the execution status of the function.
+ */
+osStatus_t osWorkCancel(osWorkId_t work_id);
+
+/*******************************************************************************
+ *  Interrupt Threads
+ ******************************************************************************/
+
+/**
+ * @fn          osIrqThreadId_t osIrqThreadNew(osThreadFunc_t func, void *argument, const osIrqThreadAttr_t *attr)
+ * @brief       Create a threaded interrupt handler and start its bottom half thread.
+ * @param[in]   func      bottom half function.
+ * @param[in]   argument  pointer that is passed to the bottom half function.
+ * @param[in]   attr      interrupt thread attributes.
+ * @return      interrupt thread ID for reference by other functions or NULL in case of error.
+ */
+osIrqThreadId_t osIrqThreadNew(osThreadFunc_t func, void *argument, const osIrqThreadAttr_t *attr);
+
+/**
+ * @fn          const char *osIrqThreadGetName(osIrqThreadId_t irq_id)
+ * @brief       Get name of an Interrupt Thread object.
+ * @param[in]   irq_id    interrupt thread ID obtained by \ref osIrqThreadNew.
+ * @return      name as null-terminated string or NULL in case of an error.
+ */
+const char *osIrqThreadGetName(osIrqThreadId_t irq_id);
+
+/**
+ * @fn          osStatus_t osIrqThreadSignal(osIrqThreadId_t irq_id)
+ * @brief       Run the bottom half, called by the top half after the hardware is acknowledged.
+ * @param[in]   irq_id    interrupt thread ID obtained by \ref osIrqThreadNew.
+ * @return      status code that indicates the execution status of the function.
+ * @note        Can be called from Interrupt Service Routines.
+ */
+osStatus_t osIrqThreadSignal(osIrqThreadId_t irq_id);
+
+/*******************************************************************************
+ *  Stackless Tasks
+ ******************************************************************************/
+
+/// Start of a stackless task function body, resumes at the last continuation point.
+/// Local variables of the task function are not preserved across waits.
+#define osTaskBegin(task)                                                      \
+  switch (((osTask_t *)(task))->lc) { case 0U:
+
+/// End of a stackless task function body, the task becomes inactive.
+#define osTaskEnd(task)                                                        \
+  } ((osTask_t *)(task))->lc = osTaskLineEnd; return
+
+/// Check if a stackless task entered wait state during the current run.
+#define osTaskIsWaiting(task)         (((osTask_t *)(task))->waiting != 0U)
+
+/// Result of the last \ref osTaskAwait call.
+#define osTaskResult(task)            (((osTask_t *)(task))->winfo.ret_val)
+
+/// Continuation points are stored as 16-bit source line numbers, a task
+/// function at line \ref osTaskLineEnd or beyond fails to compile.
+#define osTaskLineCheck()                                                      \
+  (void)sizeof(char[(__LINE__ < osTaskLineEnd) ? 1 : -1])
+
+/// Call a kernel function which may wait, the task continues here when the wait completes.
+#define osTaskAwait(task, call)                                                \
+  do {                                                                         \
+    uint32_t ret_ = (uint32_t)(call);                                          \
+    osTaskLineCheck();                                                         \
+    ((osTask_t *)(task))->lc = (uint16_t)__LINE__;                             \
+    if (osTaskIsWaiting(task)) {                                               \
+      return;                                                                  \
+    }                                                                          \
+    ((osTask_t *)(task))->winfo.ret_val = ret_;                                \
+    case __LINE__: ;                                                           \
+  } while (0)
+
+/// Pass control to the next ready task of the host.
+#define osTaskYield(task)                                                      \
+  do {                                                                         \
+    osTaskLineCheck();                                                         \
+    ((osTask_t *)(task))->lc = (uint16_t)__LINE__;                             \
+    return;                                                                    \
+    case __LINE__: ;                                                           \
+  } while (0)
+
+/**
+ * @fn          osTaskHostId_t osTaskHostNew(const osTaskHostAttr_t *attr)
+ * @brief       Create and Initialize a Task Host object.
+ * @param[in]   attr    task host attributes.
+ * @return      task host ID for reference by other functions or NULL in case of error.
+ */
+osTaskHostId_t osTaskHostNew(const osTaskHostAttr_t *attr);
+
+/**
+ * @fn          osStatus_t osTaskHostRun(osTaskHostId_t host_id)
+ * @brief       Execute ready tasks of a Task Host in the calling thread.
+ * @param[in]   host_id   task host ID obtained by \ref osTaskHostNew.
+ * @return      status code, returns only in case of an error.
+ */
+osStatus_t osTaskHostRun(osTaskHostId_t host_id);
+
+/**
+ * @fn          osTaskId_t osTaskNew(osTaskHostId_t host_id, osTaskFunc_t func, void *argument, const osTaskAttr_t *attr)
+ * @brief       Create a stackless task and make it ready in a Task Host.
+ * @param[in]   host_id   task host ID obtained by \ref osTaskHostNew.
+ * @param[in]   func      task function.
+ * @param[in]   argument  pointer that is passed to the task function.
+ * @param[in]   attr      task attributes.
+ * @return      task ID for reference by other functions or NULL in case of error.
+ */
+osTaskId_t osTaskNew(osTaskHostId_t host_id, osTaskFunc_t func, void *argument, const osTaskAttr_t *attr);
+
+/**
+ * @fn          const char *osTaskGetName(osTaskId_t task_id)
+ * @brief       Get name of a stackless task.
+ * @param[in]   task_id   task ID obtained by \ref osTaskNew.
+ * @return      name as null-terminated string or NULL in case of an error.
+ */
+const char *osTaskGetName(osTaskId_t task_id);
+
+/**
+ * @fn          osThreadState_t osTaskGetState(osTaskId_t task_id)
+ * @brief       Get current state of a stackless task.
+ * @param[in]   task_id   task ID obtained by \ref osTaskNew.
+ * @return      current task state of the specified task.
+ */
+osThreadState_t osTaskGetState(osTaskId_t task_id);
+
 /*******************************************************************************
  *  Event Flags
  ******************************************************************************/
@@ -1287,6 +1760,8 @@ const char *osMutexGetName(osMutexId_t mutex_id);
  * @param[in]   mutex_id  mutex ID obtained by \ref osMutexNew.
  * @param[in]   timeout   \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
  * @return      status code that indicates the execution status of the function.
+ * @note        Run-to-completion threads can not acquire \ref osMutexPrioInherit
+ *              or \ref osMutexPrioCeiling mutexes.
  */
 osStatus_t osMutexAcquire(osMutexId_t mutex_id, uint32_t timeout);
 
@@ -1295,6 +1770,10 @@ osStatus_t osMutexAcquire(osMutexId_t mutex_id, uint32_t timeout);
  * @brief       Release a Mutex that was acquired by \ref osMutexAcquire.
  * @param[in]   mutex_id  mutex ID obtained by \ref osMutexNew.
  * @return      status code that indicates the execution status of the function.
+ * @note        Releasing a \ref osMutexPrioInherit or \ref osMutexPrioCeiling
+ *              mutex recomputes the owner priority from the mutexes it still
+ *              holds. The cost grows with the number of mutexes held at the
+ *              same time, not with the number of waiting threads.
  */
 osStatus_t osMutexRelease(osMutexId_t mutex_id);
 
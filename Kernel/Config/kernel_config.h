@@ -47,6 +47,19 @@
 #endif
 
 //   </e>
+
+//   <o>Maximum syscall interrupt priority <0-15>
+//   <i> NVIC priority as passed to NVIC_SetPriority, not shifted:
+//   <i> 0 to (1 << __NVIC_PRIO_BITS) - 1, i.e. 0-15 with 4 priority bits.
+//   <i> Interrupts with higher priority (lower priority value) are never
+//   <i> masked by the kernel and must not call RTOS functions.
+//   <i> Used on ARMv7-M and ARMv8-M Mainline only.
+//   <i> Value 0 masks all interrupts in kernel critical sections.
+//   <i> Default: 0
+#ifndef OS_ISR_PRIO_MAX
+#define OS_ISR_PRIO_MAX             0
+#endif
+
 // </h>
 
 // <h>Thread Configuration
@@ -88,6 +101,15 @@
 #define OS_PRIVILEGE_MODE           1
 #endif
 
+//   <q>Direct kernel calls from privileged threads
+//   <i> Privileged threads call kernel functions directly with SVC, PendSV
+//   <i> and SysTick masked instead of executing the SVC instruction.
+//   <i> Thread switch is requested through PendSV.
+//   <i> Used on ARMv7-M and ARMv8-M Mainline only.
+#ifndef OS_DIRECT_CALL
+#define OS_DIRECT_CALL              0
+#endif
+
 // </h>
 
 // <h>Timer Configuration
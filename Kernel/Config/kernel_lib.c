@@ -40,6 +40,7 @@ static const osThreadAttr_t os_idle_thread_attr = {
   &os_idle_thread_stack[0],
   (uint32_t)sizeof(os_idle_thread_stack),
   osPriorityIdle,
+  osPriorityNone,
 };
 
 /* Timer Thread Control Block */
@@ -61,6 +62,7 @@ static const osThreadAttr_t os_timer_thread_attr = {
   &os_timer_thread_stack[0],
   (uint32_t)sizeof(os_timer_thread_stack),
   osPriorityISR,
+  osPriorityNone,
 };
 
 const osConfig_t osConfig __attribute__((section(".rodata"))) = {
@@ -73,6 +75,9 @@ const osConfig_t osConfig __attribute__((section(".rodata"))) = {
 #endif
 #if (OS_STACK_WATERMARK != 0)
   | osConfigStackWatermark
+#endif
+#if (OS_DIRECT_CALL != 0)
+  | osConfigDirectCall
 #endif
   ,
   (uint32_t)OS_TICK_FREQ,
@@ -83,6 +88,7 @@ const osConfig_t osConfig __attribute__((section(".rodata"))) = {
 #endif
   &os_idle_thread_attr,
   &os_timer_thread_attr,
+  (uint32_t)OS_ISR_PRIO_MAX,
 };
 
 /* Non weak reference to library irq module */
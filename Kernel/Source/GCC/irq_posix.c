@@ -0,0 +1,566 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: mbOS real-time kernel
+ */
+
+/**
+ * @file
+ *
+ * POSIX host port: service calls, context switch and OS tick.
+ *
+ * The port runs the kernel in a single 32-bit Linux process. The kernel keeps
+ * object addresses in 32-bit words, so the port builds only with gcc -m32 and
+ * a 32-bit C library (gcc-multilib); a 64-bit build is rejected by
+ * arch_posix.h. The tick interrupt is a timer signal, so masking the signal is
+ * the critical section and the signal handler is the interrupt context.
+ * Threads are ucontext_t contexts placed at the top of the thread stacks.
+ *
+ * The port also provides IRQ_COUNT software interrupt lines for tests. A line
+ * is pended with IRQ_SetPending and its handler runs from a second signal,
+ * which is masked together with the tick signal.
+ *
+ * By default the tick follows the wall clock (ITIMER_REAL). Define
+ * POSIX_TICK_VIRTUAL to count the process CPU time instead, the tick rate
+ * is then independent of the host load.
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <signal.h>
+#include <stddef.h>
+#include <sys/time.h>
+#include <ucontext.h>
+
+#include "Core/Posix/irq_posix.h"
+#include "Kernel/tick.h"
+#include "kernel_lib.h"
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#if (defined(POSIX_TICK_VIRTUAL) && (POSIX_TICK_VIRTUAL != 0))
+  #define TICK_SIGNAL                 SIGVTALRM
+  #define TICK_TIMER                  ITIMER_VIRTUAL
+#else
+  #define TICK_SIGNAL                 SIGALRM
+  #define TICK_TIMER                  ITIMER_REAL
+#endif
+
+#define TICK_CLOCK                    1000000U    // Timer resolution is 1 us
+
+#define IRQ_SIGNAL                    SIGUSR1
+#define IRQ_COUNT                     32U         // Number of software interrupt lines
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-exported)
+ ******************************************************************************/
+
+uint8_t irqLib;                                   // Non weak library reference
+uint8_t IRQ_NestLevel;                            // IRQ nesting level counter
+uint8_t IRQ_PendSV;                               // Pending SVC flag
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static IRQHandler_t tick_handler;
+static uint32_t     tick_interval;
+static uint32_t     tick_enabled;
+
+static IRQHandler_t irq_handler[IRQ_COUNT];
+static uint32_t     irq_enabled;
+static uint32_t     irq_pending;
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+/**
+ * @brief       Build the set of the interrupt signals.
+ * @param[out]  set   signal set.
+ */
+static void IrqSignalSet(sigset_t *set)
+{
+  (void)sigemptyset(set);
+  (void)sigaddset(set, TICK_SIGNAL);
+  (void)sigaddset(set, IRQ_SIGNAL);
+}
+
+/**
+ * @brief       Entry point of a thread context.
+ * @param[in]   func_addr   thread function.
+ * @param[in]   func_param  thread function argument.
+ * @param[in]   func_exit   function called when the thread function returns.
+ */
+static void ThreadStart(uint32_t func_addr, uint32_t func_param, uint32_t func_exit)
+{
+  sigset_t set;
+
+  /*
+   * The first switch to a thread happens in the kernel context. The context
+   * starts with the interrupt signals masked, an interrupt taken before the
+   * nesting level is dropped would leave the level one too high.
+   */
+  IRQ_NestLevel--;
+  IrqSignalSet(&set);
+  (void)sigprocmask(SIG_UNBLOCK, &set, NULL);
+
+  ((void (*)(void *))func_addr)((void *)func_param);
+  ((void (*)(void))func_exit)();
+}
+
+/**
+ * @brief       Execute the pending service and switch the thread context.
+ * @note        Called with the tick signal masked. Returns when the current
+ *              thread is switched in again.
+ */
+static void ContextSwitch(void)
+{
+  osThread_t *curr;
+  osThread_t *next;
+
+  while (IRQ_PendSV != 0U) {
+    IRQ_PendSV = 0U;
+    osPendSV_Handler();
+  }
+
+  curr = osInfo.thread.run.curr;
+  next = osInfo.thread.run.next;
+
+  if (curr == next) {
+    return;
+  }
+
+  osInfo.thread.run.curr = next;
+
+  if (curr == NULL) {
+    /* Context of the current thread is discarded */
+    (void)setcontext((ucontext_t *)next->stk);
+  }
+  else {
+    (void)swapcontext((ucontext_t *)curr->stk, (ucontext_t *)next->stk);
+  }
+}
+
+/**
+ * @brief       Tick signal handler, the interrupt context of the port.
+ * @param[in]   sig   signal number.
+ */
+static void TickSignalHandler(int sig)
+{
+  (void)sig;
+
+  IRQ_NestLevel++;
+
+  if (tick_handler != NULL) {
+    tick_handler();
+  }
+
+  ContextSwitch();
+
+  IRQ_NestLevel--;
+}
+
+/**
+ * @brief       Software interrupt signal handler, runs the pending enabled lines.
+ * @param[in]   sig   signal number.
+ */
+static void IrqSignalHandler(int sig)
+{
+  IRQHandler_t handler;
+  uint32_t     active;
+  uint32_t     irqn;
+
+  (void)sig;
+
+  IRQ_NestLevel++;
+
+  for (;;) {
+    active = irq_pending & irq_enabled;
+    if (active == 0U) {
+      break;
+    }
+    irqn = (uint32_t)__builtin_ctz(active);
+    irq_pending &= ~(1UL << irqn);
+
+    handler = irq_handler[irqn];
+    if (handler != NULL) {
+      handler();
+    }
+  }
+
+  ContextSwitch();
+
+  IRQ_NestLevel--;
+}
+
+/**
+ * @brief       Load the interval timer.
+ * @param[in]   interval  timer interval in microseconds, 0 stops the timer.
+ */
+static void TickTimerLoad(uint32_t interval)
+{
+  struct itimerval timer;
+
+  timer.it_interval.tv_sec  = (time_t)(interval / TICK_CLOCK);
+  timer.it_interval.tv_usec = (suseconds_t)(interval % TICK_CLOCK);
+  timer.it_value            = timer.it_interval;
+
+  (void)setitimer(TICK_TIMER, &timer, NULL);
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+/**
+ * @fn          uint32_t IrqMaskSave(void)
+ * @brief       Mask the interrupt signals.
+ * @return      previous mask state.
+ */
+uint32_t IrqMaskSave(void)
+{
+  sigset_t set;
+  sigset_t old;
+
+  /* The signal is always masked in the kernel context */
+  if (IRQ_NestLevel != 0U) {
+    return (1U);
+  }
+
+  IrqSignalSet(&set);
+  (void)sigprocmask(SIG_BLOCK, &set, &old);
+
+  return ((uint32_t)sigismember(&old, TICK_SIGNAL));
+}
+
+/**
+ * @fn          void IrqMaskRestore(uint32_t)
+ * @brief       Restore the interrupt signals mask.
+ * @param[in]   mask  mask state returned by IrqMaskSave.
+ */
+void IrqMaskRestore(uint32_t mask)
+{
+  sigset_t set;
+
+  if (mask == 0U) {
+    IrqSignalSet(&set);
+    (void)sigprocmask(SIG_UNBLOCK, &set, NULL);
+  }
+}
+
+/**
+ * @fn          uint32_t StackInit(StackAttr_t*, bool)
+ * @brief       Build the initial context of a thread at the top of its stack.
+ * @param[in]   attr        stack attributes.
+ * @param[in]   privileged  not used.
+ * @return      address of the thread context.
+ */
+uint32_t StackInit(StackAttr_t *attr, bool privileged)
+{
+  ucontext_t *ctx;
+  uint32_t    top;
+
+  (void)privileged;
+
+  top = (attr->stk_mem + attr->stk_size - (uint32_t)sizeof(ucontext_t)) & ~15U;
+  ctx = (ucontext_t *)top;
+
+  (void)getcontext(ctx);
+  ctx->uc_stack.ss_sp   = (void *)attr->stk_mem;
+  ctx->uc_stack.ss_size = top - attr->stk_mem;
+  ctx->uc_link          = NULL;
+  IrqSignalSet(&ctx->uc_sigmask);
+  makecontext(ctx, (void (*)(void))ThreadStart, 3,
+              attr->func_addr, attr->func_param, attr->func_exit);
+
+  return (top);
+}
+
+/**
+ * @fn          uint32_t SvcCall(uint32_t, uint32_t, uint32_t, uint32_t, uint32_t)
+ * @brief       Execute a kernel service in the kernel context.
+ * @param[in]   param1  service argument 1.
+ * @param[in]   param2  service argument 2.
+ * @param[in]   param3  service argument 3.
+ * @param[in]   param4  service argument 4.
+ * @param[in]   func    service function.
+ * @return      service return value.
+ */
+uint32_t SvcCall(uint32_t param1, uint32_t param2, uint32_t param3, uint32_t param4, uint32_t func)
+{
+  sigset_t set;
+  sigset_t old;
+  uint32_t ret;
+
+  IrqSignalSet(&set);
+  (void)sigprocmask(SIG_BLOCK, &set, &old);
+  IRQ_NestLevel++;
+
+  ret = ((uint32_t (*)(uint32_t, uint32_t, uint32_t, uint32_t))func)(param1, param2, param3, param4);
+
+  ContextSwitch();
+
+  IRQ_NestLevel--;
+  (void)sigprocmask(SIG_SETMASK, &old, NULL);
+
+  return (ret);
+}
+
+/*******************************************************************************
+ *  OS Tick
+ ******************************************************************************/
+
+int32_t osTickSetup(uint32_t freq, IRQHandler_t handler)
+{
+  struct sigaction action;
+
+  if ((freq == 0U) || (freq > TICK_CLOCK)) {
+    return (-1);
+  }
+
+  tick_handler  = handler;
+  tick_interval = TICK_CLOCK / freq;
+  tick_enabled  = 0U;
+
+  action.sa_handler = TickSignalHandler;
+  action.sa_flags   = SA_RESTART;
+  IrqSignalSet(&action.sa_mask);
+
+  if (sigaction(TICK_SIGNAL, &action, NULL) != 0) {
+    return (-1);
+  }
+
+  return (0);
+}
+
+void osTickEnable(void)
+{
+  tick_enabled = 1U;
+  TickTimerLoad(tick_interval);
+}
+
+void osTickDisable(void)
+{
+  tick_enabled = 0U;
+  TickTimerLoad(0U);
+}
+
+void osTickEnableIRQ(void)
+{
+  sigset_t set;
+
+  (void)sigemptyset(&set);
+  (void)sigaddset(&set, TICK_SIGNAL);
+  (void)sigprocmask(SIG_UNBLOCK, &set, NULL);
+}
+
+void osTickDisableIRQ(void)
+{
+  sigset_t set;
+
+  (void)sigemptyset(&set);
+  (void)sigaddset(&set, TICK_SIGNAL);
+  (void)sigprocmask(SIG_BLOCK, &set, NULL);
+}
+
+void osTickAcknowledgeIRQ(void)
+{
+}
+
+uint32_t osTickGetClock(void)
+{
+  return (TICK_CLOCK);
+}
+
+uint32_t osTickGetInterval(void)
+{
+  return (tick_interval);
+}
+
+uint32_t osTickGetCount(void)
+{
+  struct itimerval timer;
+  uint32_t         remain;
+
+  if (tick_enabled == 0U) {
+    return (0U);
+  }
+
+  (void)getitimer(TICK_TIMER, &timer);
+  remain = ((uint32_t)timer.it_value.tv_sec * TICK_CLOCK) + (uint32_t)timer.it_value.tv_usec;
+  if (remain > tick_interval) {
+    remain = tick_interval;
+  }
+
+  return (tick_interval - remain);
+}
+
+uint32_t osTickGetOverflow(void)
+{
+  sigset_t set;
+
+  /* A tick signal waits while the kernel context runs */
+  (void)sigpending(&set);
+
+  return ((uint32_t)sigismember(&set, TICK_SIGNAL));
+}
+
+/*******************************************************************************
+ *  Software interrupt lines
+ ******************************************************************************/
+
+/**
+ * @brief       Raise the interrupt signal if an enabled line is pending.
+ * @note        Called with the interrupt signals masked, the signal is
+ *              delivered when they are unmasked.
+ */
+static void IrqRaise(void)
+{
+  if ((irq_pending & irq_enabled) != 0U) {
+    (void)raise(IRQ_SIGNAL);
+  }
+}
+
+int32_t IRQ_Initialize(void)
+{
+  struct sigaction action;
+  uint32_t         mask;
+  int              status;
+
+  mask = IrqMaskSave();
+
+  for (uint32_t i = 0U; i < IRQ_COUNT; i++) {
+    irq_handler[i] = NULL;
+  }
+  irq_enabled = 0U;
+  irq_pending = 0U;
+
+  action.sa_handler = IrqSignalHandler;
+  action.sa_flags   = SA_RESTART;
+  IrqSignalSet(&action.sa_mask);
+  status = sigaction(IRQ_SIGNAL, &action, NULL);
+
+  IrqMaskRestore(mask);
+
+  return ((status == 0) ? 0 : -1);
+}
+
+int32_t IRQ_SetHandler(IRQn_ID_t irqn, IRQHandler_t handler)
+{
+  if ((irqn < 0) || ((uint32_t)irqn >= IRQ_COUNT)) {
+    return (-1);
+  }
+
+  irq_handler[irqn] = handler;
+
+  return (0);
+}
+
+IRQHandler_t IRQ_GetHandler(IRQn_ID_t irqn)
+{
+  if ((irqn < 0) || ((uint32_t)irqn >= IRQ_COUNT)) {
+    return (NULL);
+  }
+
+  return (irq_handler[irqn]);
+}
+
+int32_t IRQ_Enable(IRQn_ID_t irqn)
+{
+  uint32_t mask;
+
+  if ((irqn < 0) || ((uint32_t)irqn >= IRQ_COUNT)) {
+    return (-1);
+  }
+
+  mask = IrqMaskSave();
+  irq_enabled |= (1UL << (uint32_t)irqn);
+  IrqRaise();
+  IrqMaskRestore(mask);
+
+  return (0);
+}
+
+int32_t IRQ_Disable(IRQn_ID_t irqn)
+{
+  uint32_t mask;
+
+  if ((irqn < 0) || ((uint32_t)irqn >= IRQ_COUNT)) {
+    return (-1);
+  }
+
+  mask = IrqMaskSave();
+  irq_enabled &= ~(1UL << (uint32_t)irqn);
+  IrqMaskRestore(mask);
+
+  return (0);
+}
+
+uint32_t IRQ_GetEnableState(IRQn_ID_t irqn)
+{
+  if ((irqn < 0) || ((uint32_t)irqn >= IRQ_COUNT)) {
+    return (0U);
+  }
+
+  return ((irq_enabled >> (uint32_t)irqn) & 1U);
+}
+
+int32_t IRQ_SetPending(IRQn_ID_t irqn)
+{
+  uint32_t mask;
+
+  if ((irqn < 0) || ((uint32_t)irqn >= IRQ_COUNT)) {
+    return (-1);
+  }
+
+  mask = IrqMaskSave();
+  irq_pending |= (1UL << (uint32_t)irqn);
+  IrqRaise();
+  IrqMaskRestore(mask);
+
+  return (0);
+}
+
+uint32_t IRQ_GetPending(IRQn_ID_t irqn)
+{
+  if ((irqn < 0) || ((uint32_t)irqn >= IRQ_COUNT)) {
+    return (0U);
+  }
+
+  return ((irq_pending >> (uint32_t)irqn) & 1U);
+}
+
+int32_t IRQ_ClearPending(IRQn_ID_t irqn)
+{
+  uint32_t mask;
+
+  if ((irqn < 0) || ((uint32_t)irqn >= IRQ_COUNT)) {
+    return (-1);
+  }
+
+  mask = IrqMaskSave();
+  irq_pending &= ~(1UL << (uint32_t)irqn);
+  IrqMaskRestore(mask);
+
+  return (0);
+}
+
+/*------------------------------ End of file ---------------------------------*/
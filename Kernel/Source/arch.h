@@ -92,6 +92,10 @@ typedef struct StackAttr_s {
 
 #include "arch_riscv.h"
 
+#elif (defined(__unix__) && (__unix__ != 0))
+
+#include "arch_posix.h"
+
 #else
   #error Unknown target.
 #endif
@@ -100,10 +104,23 @@ typedef struct StackAttr_s {
 /* Minimal thread stack size in bytes */
 #define MIN_THREAD_STK_SIZE           64U
 
+#if (defined(DIRECT_CALL) && (DIRECT_CALL != 0))
+
+#define SVC_0(func)                                   (uint32_t)(IsDirectCall() ? direct_0((uint32_t)(func)) : svc_0((uint32_t)(func)))
+#define SVC_1(param1, func)                           (uint32_t)(IsDirectCall() ? direct_1((uint32_t)(param1), (uint32_t)(func)) : svc_1((uint32_t)(param1), (uint32_t)(func)))
+#define SVC_2(param1, param2, func)                   (uint32_t)(IsDirectCall() ? direct_2((uint32_t)(param1), (uint32_t)(param2), (uint32_t)(func)) : svc_2((uint32_t)(param1), (uint32_t)(param2), (uint32_t)(func)))
+#define SVC_3(param1, param2, param3, func)           (uint32_t)(IsDirectCall() ? direct_3((uint32_t)(param1), (uint32_t)(param2), (uint32_t)(param3), (uint32_t)(func)) : svc_3((uint32_t)(param1), (uint32_t)(param2), (uint32_t)(param3), (uint32_t)(func)))
+#define SVC_4(param1, param2, param3, param4, func)   (uint32_t)(IsDirectCall() ? direct_4((uint32_t)(param1), (uint32_t)(param2), (uint32_t)(param3), (uint32_t)(param4), (uint32_t)(func)) : svc_4((uint32_t)(param1), (uint32_t)(param2), (uint32_t)(param3), (uint32_t)(param4), (uint32_t)(func)))
+
+#else
+
 #define SVC_0(func)                                   (uint32_t)svc_0((uint32_t)(func))
 #define SVC_1(param1, func)                           (uint32_t)svc_1((uint32_t)(param1), (uint32_t)(func))
 #define SVC_2(param1, param2, func)                   (uint32_t)svc_2((uint32_t)(param1), (uint32_t)(param2), (uint32_t)(func))
 #define SVC_3(param1, param2, param3, func)           (uint32_t)svc_3((uint32_t)(param1), (uint32_t)(param2), (uint32_t)(param3), (uint32_t)(func))
 #define SVC_4(param1, param2, param3, param4, func)   (uint32_t)svc_4((uint32_t)(param1), (uint32_t)(param2), (uint32_t)(param3), (uint32_t)(param4), (uint32_t)(func))
 
+
+#endif
+
 #endif  // _ARCH_H_
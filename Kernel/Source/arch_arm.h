@@ -33,6 +33,9 @@ extern uint8_t IRQ_PendSV;
 extern uint32_t DisableIRQ(void);
 extern     void RestoreIRQ(uint32_t);
 
+extern  int32_t IRQ_Enable(int32_t irqn);
+extern  int32_t IRQ_Disable(int32_t irqn);
+
 /*******************************************************************************
  *  defines and macros
  ******************************************************************************/
@@ -59,6 +62,14 @@ extern     void RestoreIRQ(uint32_t);
 #define BEGIN_CRITICAL_SECTION        uint32_t mode = DisableIRQ();
 #define END_CRITICAL_SECTION          RestoreIRQ(mode);
 
+#define SystemIsrMask(prio)           (0U)
+#define IsIrqPrioAllowed(mask)        true
+
+/* Interrupt lines are masked through the interrupt controller driver */
+#define IRQ_LINE_MASK                 1
+#define IrqLineDisable(irqn)          (void)IRQ_Disable(irqn)
+#define IrqLineEnable(irqn)           (void)IRQ_Enable(irqn)
+
 #if defined(__CC_ARM)
   #define SVC_INDIRECT_REG            r12
 #elif defined(__ICCARM__)
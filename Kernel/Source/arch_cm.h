@@ -45,6 +45,9 @@
 #define SysTick_BASE        (SCS_BASE + 0x0010UL)   /*!< SysTick Base Address */
 
 #define SCB                 ((SCB_Type *)SCB_BASE)  /*!< SCB configuration struct */
+#define NVIC_IP             ((volatile uint8_t *)(SCS_BASE + 0x0400UL)) /*!< NVIC Interrupt Priority Registers */
+#define NVIC_ISER           ((volatile uint32_t *)(SCS_BASE + 0x0100UL)) /*!< NVIC Interrupt Set Enable Registers */
+#define NVIC_ICER           ((volatile uint32_t *)(SCS_BASE + 0x0180UL)) /*!< NVIC Interrupt Clear Enable Registers */
 #define SysTick             ((SysTick_Type *)SysTick_BASE)  /*!< SysTick configuration struct */
 
 #if   ((defined(__ARM_ARCH_7M__)      && (__ARM_ARCH_7M__      != 0)) ||       \
@@ -78,10 +81,50 @@
 
 #endif
 
+#if   ((defined(__ARM_ARCH_7M__)      && (__ARM_ARCH_7M__      != 0)) ||       \
+       (defined(__ARM_ARCH_7EM__)     && (__ARM_ARCH_7EM__     != 0)) ||       \
+       (defined(__ARM_ARCH_8M_MAIN__) && (__ARM_ARCH_8M_MAIN__ != 0)) ||       \
+       (defined(__ARM_ARCH_8M_BASE__) && (__ARM_ARCH_8M_BASE__ != 0)))
+
+/* Exclusive access instructions (LDREX/STREX) are available */
+#define EXCLUSIVE_ACCESS              1
+
+#endif
+
+/* Interrupt lines may be masked by the kernel */
+#define IRQ_LINE_MASK                 1
+
+/* Run-to-completion threads may share a stack */
+#define SHARED_STACK                  1
+
+#if   ((defined(__ARM_ARCH_7EM__)     && (__ARM_ARCH_7EM__     != 0)) ||       \
+       (defined(__ARM_ARCH_8M_MAIN__) && (__ARM_ARCH_8M_MAIN__ != 0)))
+#define CONTEXT_SAVE_SIZE             (96U)     /* R4..R11 and S16..S31 */
+#else
+#define CONTEXT_SAVE_SIZE             (32U)     /* R4..R11 */
+#endif
+
+#if   ((defined(__ARM_ARCH_7M__)      && (__ARM_ARCH_7M__      != 0)) ||       \
+       (defined(__ARM_ARCH_7EM__)     && (__ARM_ARCH_7EM__     != 0)) ||       \
+       (defined(__ARM_ARCH_8M_MAIN__) && (__ARM_ARCH_8M_MAIN__ != 0)))
+
+#define BEGIN_CRITICAL_SECTION        uint32_t irq_mask = IrqMaskSave(osInfo.isr_mask);
+#define END_CRITICAL_SECTION          IrqMaskRestore(osInfo.isr_mask, irq_mask);
+
+/* Kernel functions may be called directly from privileged threads */
+#define DIRECT_CALL                   1
+
+#else
+
 #define BEGIN_CRITICAL_SECTION        uint32_t primask = __get_PRIMASK(); \
                                       __disable_irq();
 #define END_CRITICAL_SECTION          __set_PRIMASK(primask);
 
+#define SystemIsrMask(prio)           (0U)
+#define IsIrqPrioAllowed(mask)        true
+
+#endif
+
 /*******************************************************************************
  *  typedefs and structures
  ******************************************************************************/
@@ -268,6 +311,132 @@ void SystemIsrInit(void)
 #endif
 }
 
+#if   ((defined(__ARM_ARCH_7M__)      && (__ARM_ARCH_7M__      != 0)) ||       \
+       (defined(__ARM_ARCH_7EM__)     && (__ARM_ARCH_7EM__     != 0)) ||       \
+       (defined(__ARM_ARCH_8M_MAIN__) && (__ARM_ARCH_8M_MAIN__ != 0)))
+
+/**
+ * @fn          uint32_t SystemIsrMask(uint32_t)
+ * @brief       Convert maximum syscall interrupt priority to BASEPRI value.
+ * @param[in]   prio  maximum syscall interrupt priority, unshifted NVIC priority
+ *                    0 .. (1 << __NVIC_PRIO_BITS) - 1 (0 - mask all interrupts).
+ * @return      BASEPRI value or 0 if critical sections use PRIMASK.
+ */
+__STATIC_INLINE
+uint32_t SystemIsrMask(uint32_t prio)
+{
+  uint32_t n;
+
+  if (prio == 0U) {
+    return (0U);
+  }
+
+  /* Determine number of not implemented priority bits */
+  SCB->SHP[SCB_PENDSV_PRIO] = 0xFFU;
+  n = 32U - (uint32_t)__CLZ(~(SCB->SHP[SCB_PENDSV_PRIO] | 0xFFFFFF00U));
+
+  return ((prio << n) & 0xFFU);
+}
+
+/**
+ * @fn          bool IsIrqPrioAllowed(uint32_t)
+ * @brief       Check if active exception is allowed to call RTOS functions.
+ * @param[in]   mask  BASEPRI value used for critical sections.
+ * @return      true=allowed, false=priority above maximum syscall priority
+ */
+__STATIC_INLINE
+bool IsIrqPrioAllowed(uint32_t mask)
+{
+  uint32_t exc = __get_IPSR();
+  uint32_t prio;
+
+  if ((mask == 0U) || (exc == 0U)) {
+    return (true);
+  }
+
+  if (exc >= 16U) {
+    prio = NVIC_IP[exc - 16U];
+  }
+  else if (exc >= 4U) {
+    prio = SCB->SHP[exc - 4U];
+  }
+  else {
+    /* NMI and HardFault */
+    return (false);
+  }
+
+  return (prio >= mask);
+}
+
+/**
+ * @fn          uint32_t IrqMaskSave(uint32_t)
+ * @brief       Mask kernel aware interrupts.
+ * @param[in]   mask  BASEPRI value or 0 to mask all interrupts.
+ * @return      previous BASEPRI or PRIMASK value.
+ */
+__STATIC_FORCEINLINE
+uint32_t IrqMaskSave(uint32_t mask)
+{
+  uint32_t prev;
+
+  if (mask != 0U) {
+    prev = __get_BASEPRI();
+    __set_BASEPRI_MAX(mask);
+  }
+  else {
+    prev = __get_PRIMASK();
+    __disable_irq();
+  }
+
+  return (prev);
+}
+
+/**
+ * @fn          void IrqMaskRestore(uint32_t, uint32_t)
+ * @brief       Restore interrupt mask saved by \ref IrqMaskSave.
+ * @param[in]   mask  BASEPRI value or 0 to mask all interrupts.
+ * @param[in]   prev  value returned by \ref IrqMaskSave.
+ */
+__STATIC_FORCEINLINE
+void IrqMaskRestore(uint32_t mask, uint32_t prev)
+{
+  if (mask != 0U) {
+    __set_BASEPRI(prev);
+  }
+  else {
+    __set_PRIMASK(prev);
+  }
+}
+
+/**
+ * @fn          uint32_t DirectCallLock(void)
+ * @brief       Mask SVC, PendSV and SysTick for a direct kernel call.
+ * @return      previous BASEPRI value.
+ */
+__STATIC_FORCEINLINE
+uint32_t DirectCallLock(void)
+{
+  uint32_t prev = __get_BASEPRI();
+
+  __set_BASEPRI_MAX(SCB->SHP[SCB_SVCALL_PRIO]);
+
+  return (prev);
+}
+
+/**
+ * @fn          void DirectCallUnlock(uint32_t)
+ * @brief       Restore interrupt mask saved by \ref DirectCallLock.
+ * @param[in]   prev  value returned by \ref DirectCallLock.
+ */
+__STATIC_FORCEINLINE
+void DirectCallUnlock(uint32_t prev)
+{
+  __set_BASEPRI(prev);
+  __ISB();
+}
+
+#endif
+
 /**
  * @fn          void setPrivilegedMode(uint32_t)
  * @brief
@@ -296,6 +465,41 @@ void PendServCallReq(void)
   SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
 }
 
+/**
+ * @fn          void IrqLineDisable(int32_t)
+ * @brief       Disable a device interrupt in the NVIC.
+ * @param[in]   irqn  device interrupt number.
+ */
+__STATIC_FORCEINLINE
+void IrqLineDisable(int32_t irqn)
+{
+  NVIC_ICER[(uint32_t)irqn >> 5U] = (1UL << ((uint32_t)irqn & 0x1FU));
+  __DSB();
+  __ISB();
+}
+
+/**
+ * @fn          void IrqLineEnable(int32_t)
+ * @brief       Enable a device interrupt in the NVIC.
+ * @param[in]   irqn  device interrupt number.
+ */
+__STATIC_FORCEINLINE
+void IrqLineEnable(int32_t irqn)
+{
+  NVIC_ISER[(uint32_t)irqn >> 5U] = (1UL << ((uint32_t)irqn & 0x1FU));
+}
+
+/**
+ * @fn          uint32_t ThreadStackGet(void)
+ * @brief       Get stack pointer of the thread interrupted by the kernel.
+ * @return      PSP value.
+ */
+__STATIC_FORCEINLINE
+uint32_t ThreadStackGet(void)
+{
+  return (__get_PSP());
+}
+
 __STATIC_INLINE
 uint32_t StackInit(StackAttr_t *attr, bool privileged)
 {
@@ -52,6 +52,9 @@ extern     void RestoreIRQ(uint32_t);
 #define BEGIN_CRITICAL_SECTION        uint32_t mode = DisableIRQ();
 #define END_CRITICAL_SECTION          RestoreIRQ(mode);
 
+#define SystemIsrMask(prio)           (0U)
+#define IsIrqPrioAllowed(mask)        true
+
 /*******************************************************************************
  *  exported functions
  ******************************************************************************/
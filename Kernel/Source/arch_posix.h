@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ARCH_POSIX_H_
+#define ARCH_POSIX_H_
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * The kernel stores object addresses in 32-bit words (service call arguments,
+ * thread stack pointers, wait results). Build with gcc -m32 and a 32-bit
+ * C library, a 64-bit build truncates the pointers.
+ */
+#if (UINTPTR_MAX != 0xFFFFFFFFU)
+  #error The POSIX port requires 32-bit pointers, build with gcc -m32.
+#endif
+
+extern uint8_t IRQ_NestLevel;
+extern uint8_t IRQ_PendSV;
+
+extern uint32_t IrqMaskSave(void);
+extern void     IrqMaskRestore(uint32_t mask);
+extern uint32_t StackInit(StackAttr_t *attr, bool privileged);
+extern uint32_t SvcCall(uint32_t param1, uint32_t param2, uint32_t param3, uint32_t param4, uint32_t func);
+
+extern int32_t IRQ_Enable(int32_t irqn);
+extern int32_t IRQ_Disable(int32_t irqn);
+
+/*******************************************************************************
+ *  defines and macros
+ ******************************************************************************/
+
+#ifndef   __STATIC_INLINE
+  #define __STATIC_INLINE             static inline
+#endif
+#ifndef   __STATIC_FORCEINLINE
+  #define __STATIC_FORCEINLINE        __attribute__((always_inline)) static inline
+#endif
+#ifndef   __NO_RETURN
+  #define __NO_RETURN                 __attribute__((__noreturn__))
+#endif
+#ifndef   __WEAK
+  #define __WEAK                      __attribute__((weak))
+#endif
+
+#define INIT_EXC_RETURN               0UL
+#define OS_TICK_HANDLER               osTick_Handler
+
+#define IsIrqMasked()                 false
+#define IsPrivileged()                false
+#define SystemIsrInit()
+#define setPrivilegedMode(flag)
+
+/* The tick and the software interrupt lines are masked together */
+#define BEGIN_CRITICAL_SECTION        uint32_t mask = IrqMaskSave();
+#define END_CRITICAL_SECTION          IrqMaskRestore(mask);
+
+#define SystemIsrMask(prio)           (0U)
+#define IsIrqPrioAllowed(mask)        true
+
+/* Software interrupt lines of the port */
+#define IRQ_LINE_MASK                 1
+#define IrqLineDisable(irqn)          (void)IRQ_Disable(irqn)
+#define IrqLineEnable(irqn)           (void)IRQ_Enable(irqn)
+
+/*******************************************************************************
+ *  exported functions
+ ******************************************************************************/
+
+/**
+ * @fn          uint32_t __CLZ(uint32_t)
+ * @brief       Count leading zeros.
+ * @param[in]   value  value to count the leading zeros.
+ * @return      number of leading zeros in value.
+ */
+__STATIC_FORCEINLINE
+uint32_t __CLZ(uint32_t value)
+{
+  if (value == 0U) {
+    return (32U);
+  }
+
+  return ((uint32_t)__builtin_clz(value));
+}
+
+/**
+ * @fn          bool IsIrqMode(void)
+ * @brief       Check if in IRQ Mode
+ * @return      true=IRQ, false=thread
+ */
+__STATIC_INLINE
+bool IsIrqMode(void)
+{
+  return (IRQ_NestLevel > 0U);
+}
+
+/**
+ * @fn          void PendServCallReq(void)
+ * @brief       Set Pending SV (Service Call) Flag.
+ */
+__STATIC_FORCEINLINE
+void PendServCallReq(void)
+{
+  IRQ_PendSV = 1U;
+}
+
+__STATIC_FORCEINLINE
+uint32_t svc_0(uint32_t func)
+{
+  return (SvcCall(0U, 0U, 0U, 0U, func));
+}
+
+__STATIC_FORCEINLINE
+uint32_t svc_1(uint32_t param1, uint32_t func)
+{
+  return (SvcCall(param1, 0U, 0U, 0U, func));
+}
+
+__STATIC_FORCEINLINE
+uint32_t svc_2(uint32_t param1, uint32_t param2, uint32_t func)
+{
+  return (SvcCall(param1, param2, 0U, 0U, func));
+}
+
+__STATIC_FORCEINLINE
+uint32_t svc_3(uint32_t param1, uint32_t param2, uint32_t param3, uint32_t func)
+{
+  return (SvcCall(param1, param2, param3, 0U, func));
+}
+
+__STATIC_FORCEINLINE
+uint32_t svc_4(uint32_t param1, uint32_t param2, uint32_t param3, uint32_t param4, uint32_t func)
+{
+  return (SvcCall(param1, param2, param3, param4, func));
+}
+
+#endif /* ARCH_POSIX_H_ */
@@ -17,6 +17,15 @@
  * limitations under the License.
  */
 
+/*
+ * RISC-V port, Machine mode on a single hart.
+ *
+ * The kernel state has one run slot and one ready list without a lock, and a
+ * critical section only clears MIE of the hart it runs on. Other harts of a
+ * multi-hart part must stay parked by the startup code and must not call
+ * kernel functions.
+ */
+
 #ifndef ARCH_RISCV_H_
 #define ARCH_RISCV_H_
 
@@ -28,9 +37,12 @@
 #include <Core/Riscv/compiler.h>
 #include <Core/Riscv/core_riscv.h>
 
-extern uint8_t IRQ_NestLevel;
+extern uint32_t IRQ_NestLevel;
 extern uint8_t IRQ_PendSV;
 
+extern int32_t IRQ_Enable(int32_t irqn);
+extern int32_t IRQ_Disable(int32_t irqn);
+
 /*******************************************************************************
  *  defines and macros
  ******************************************************************************/
@@ -46,6 +58,14 @@ extern uint8_t IRQ_PendSV;
 #define BEGIN_CRITICAL_SECTION        uint32_t mode = CSR_READ_CLEAR(CSR_MSTATUS, MSTATUS_MIE);
 #define END_CRITICAL_SECTION          CSR_WRITE(CSR_MSTATUS, mode);
 
+#define SystemIsrMask(prio)           (0U)
+#define IsIrqPrioAllowed(mask)        true
+
+/* Interrupt lines are masked through the interrupt controller driver */
+#define IRQ_LINE_MASK                 1
+#define IrqLineDisable(irqn)          (void)IRQ_Disable(irqn)
+#define IrqLineEnable(irqn)           (void)IRQ_Enable(irqn)
+
 /*******************************************************************************
  *  exported functions
  ******************************************************************************/
@@ -71,44 +91,50 @@ void PendServCallReq(void)
   IRQ_PendSV = 1U;
 }
 
+/**
+ * @brief       Build the initial trap frame of a thread, see Trap_Handler.
+ * @param[in]   attr        stack attributes.
+ * @param[in]   privileged  not used, threads run in Machine mode.
+ * @return      stack pointer of the thread.
+ */
 __STATIC_INLINE
 uint32_t StackInit(StackAttr_t *attr, bool privileged)
 {
-  uint32_t psr;
-//  bool     thumb = (attr->func_addr & 1U) != 0U;
-
-  if (privileged) {
-//    if (thumb) {
-//      psr = CPSR_MODE_SYSTEM | CPSR_T_Msk;
-//    } else {
-//      psr = CPSR_MODE_SYSTEM;
-//    }
-//  } else {
-//    if (thumb) {
-//      psr = CPSR_MODE_USER   | CPSR_T_Msk;
-//    } else {
-//      psr = CPSR_MODE_USER;
-//    }
-  }
-
+  (void) privileged;
   uint32_t *stk = (uint32_t *)(attr->stk_mem + attr->stk_size);
 
-  *(--stk) = psr;                               //-- xPSR
-  *(--stk) = attr->func_addr;                   //-- Entry Point (PC)
-  *(--stk) = attr->func_exit;                   //-- R14 (LR)
-  *(--stk) = 0x12121212L;                       //-- R12
-  *(--stk) = 0x03030303L;                       //-- R3
-  *(--stk) = 0x02020202L;                       //-- R2
-  *(--stk) = 0x01010101L;                       //-- R1
-  *(--stk) = attr->func_param;                  //-- R0 - thread's function argument
-  *(--stk) = 0x11111111L;                       //-- R11
-  *(--stk) = 0x10101010L;                       //-- R10
-  *(--stk) = 0x09090909L;                       //-- R9
-  *(--stk) = 0x08080808L;                       //-- R8
-  *(--stk) = 0x07070707L;                       //-- R7
-  *(--stk) = 0x06060606L;                       //-- R6
-  *(--stk) = 0x05050505L;                       //-- R5
-  *(--stk) = 0x04040404L;                       //-- R4
+  *(--stk) = 0UL;                               //-- reserved
+  *(--stk) = 0UL;                               //-- reserved
+  *(--stk) = MSTATUS_MPP | MSTATUS_MPIE;        //-- mstatus: Machine mode, interrupts enabled
+  *(--stk) = attr->func_addr;                   //-- mepc - Entry Point
+  *(--stk) = 0x31313131UL;                      //-- t6
+  *(--stk) = 0x30303030UL;                      //-- t5
+  *(--stk) = 0x29292929UL;                      //-- t4
+  *(--stk) = 0x28282828UL;                      //-- t3
+  *(--stk) = 0x27272727UL;                      //-- s11
+  *(--stk) = 0x26262626UL;                      //-- s10
+  *(--stk) = 0x25252525UL;                      //-- s9
+  *(--stk) = 0x24242424UL;                      //-- s8
+  *(--stk) = 0x23232323UL;                      //-- s7
+  *(--stk) = 0x22222222UL;                      //-- s6
+  *(--stk) = 0x21212121UL;                      //-- s5
+  *(--stk) = 0x20202020UL;                      //-- s4
+  *(--stk) = 0x19191919UL;                      //-- s3
+  *(--stk) = 0x18181818UL;                      //-- s2
+  *(--stk) = 0x17171717UL;                      //-- a7
+  *(--stk) = 0x16161616UL;                      //-- a6
+  *(--stk) = 0x15151515UL;                      //-- a5
+  *(--stk) = 0x14141414UL;                      //-- a4
+  *(--stk) = 0x13131313UL;                      //-- a3
+  *(--stk) = 0x12121212UL;                      //-- a2
+  *(--stk) = 0x11111111UL;                      //-- a1
+  *(--stk) = attr->func_param;                  //-- a0 - thread's function argument
+  *(--stk) = 0x09090909UL;                      //-- s1
+  *(--stk) = 0x08080808UL;                      //-- s0
+  *(--stk) = 0x07070707UL;                      //-- t2
+  *(--stk) = 0x06060606UL;                      //-- t1
+  *(--stk) = 0x05050505UL;                      //-- t0
+  *(--stk) = attr->func_exit;                   //-- ra
 
   return ((uint32_t)stk);
 }
@@ -126,7 +126,7 @@ static osDataQueueId_t svcDataQueueNew(uint32_t data_count, uint32_t data_size,
 
   QueueReset(&dq->wait_put_queue);
   QueueReset(&dq->wait_get_queue);
-  QueueReset(&dq->post_queue);
+  dq->post_link = NULL;
 
   return (dq);
 }
@@ -173,7 +173,7 @@ static osStatus_t svcDataQueuePut(osDataQueueId_t dq_id, const void *data_ptr, u
         /* Suspend current Thread */
         status = krnThreadWaitEnter(ThreadWaitingQueuePut, &dq->wait_put_queue, timeout);
         if (status != osErrorTimeout) {
-          ThreadGetRunning()->winfo.dataque.data_ptr = (uint32_t)data_ptr;
+          ThreadGetWaiter()->winfo.dataque.data_ptr = (uint32_t)data_ptr;
         }
       }
       else {
@@ -216,7 +216,7 @@ static osStatus_t svcDataQueueGet(osDataQueueId_t dq_id, void *data_ptr, uint32_
       /* Suspend current Thread */
       status = krnThreadWaitEnter(ThreadWaitingQueueGet, &dq->wait_get_queue, timeout);
       if (status != osErrorTimeout) {
-        ThreadGetRunning()->winfo.dataque.data_ptr = (uint32_t)data_ptr;
+        ThreadGetWaiter()->winfo.dataque.data_ptr = (uint32_t)data_ptr;
       }
     }
     else {
@@ -337,6 +337,11 @@ osStatus_t isrDataQueuePut(osDataQueueId_t dq_id, const void *data_ptr, uint32_t
   osDataQueue_t    *dq = dq_id;
   osStatus_t        status;
 
+  /* Check interrupt priority */
+  if (!IsrCallAllowed()) {
+    return (osErrorISR);
+  }
+
   /* Check parameters */
   if ((dq       == NULL) || (dq->id  != ID_DATA_QUEUE) ||
       (data_ptr == NULL) || (timeout != 0U)) {
@@ -363,6 +368,11 @@ osStatus_t isrDataQueueGet(osDataQueueId_t dq_id, void *data_ptr, uint32_t timeo
   osDataQueue_t    *dq = dq_id;
   osStatus_t        status;
 
+  /* Check interrupt priority */
+  if (!IsrCallAllowed()) {
+    return (osErrorISR);
+  }
+
   /* Check parameters */
   if ((dq       == NULL) || (dq->id  != ID_DATA_QUEUE) ||
       (data_ptr == NULL) || (timeout != 0U)) {
@@ -89,6 +89,59 @@ uint32_t EventFlagsCheck(osEventFlags_t *evf, uint32_t flags, uint32_t options)
   return (pattern);
 }
 
+/**
+ * @brief       Wakeup the waiting Threads satisfied by the set flags.
+ * @param[in]   evf           event flags object.
+ * @param[in]   flags         flags that have been set.
+ * @param[in]   event_flags   event flags after setting.
+ * @return      event flags after the waiting Threads cleared their flags.
+ */
+static
+uint32_t EventFlagsWakeup(osEventFlags_t *evf, uint32_t flags, uint32_t event_flags)
+{
+  uint32_t        wait_flags;
+  uint32_t        pattern;
+  queue_t        *que;
+  osThread_t     *thread;
+  winfo_flags_t  *winfo;
+
+  /* Waiting Threads were not satisfied before, only the set flags can change it */
+  if ((evf->wait_flags & flags) == 0U) {
+    return (event_flags);
+  }
+
+  wait_flags = 0U;
+
+  que = evf->wait_queue.next;
+  while (que != &evf->wait_queue) {
+    thread = GetThreadByQueue(que);
+    que = que->next;
+    winfo = &thread->winfo.event;
+
+    /* Skip Threads not waiting for any of the set flags */
+    if ((winfo->flags & flags) != 0U) {
+      pattern = EventFlagsCheck(evf, winfo->flags, winfo->options);
+      if (pattern != 0U) {
+        if ((winfo->options & osFlagsNoClear) == 0U) {
+          event_flags = pattern & ~winfo->flags;
+        }
+        else {
+          event_flags = pattern;
+        }
+        krnThreadWaitExit(thread, pattern, DISPATCH_NO);
+        continue;
+      }
+    }
+
+    wait_flags |= winfo->flags;
+  }
+
+  /* Drop flags of Threads that are not waiting anymore */
+  evf->wait_flags = wait_flags;
+
+  return (event_flags);
+}
+
 /*******************************************************************************
  *  function implementations (scope: module-local)
  ******************************************************************************/
@@ -113,9 +166,11 @@ static osEventFlagsId_t svcEventFlagsNew(const osEventFlagsAttr_t *attr)
   evf->flags = 0U;
   evf->name = attr->name;
   evf->event_flags = 0U;
+  evf->wait_flags = 0U;
+  evf->post_flags = 0U;
 
   QueueReset(&evf->wait_queue);
-  QueueReset(&evf->post_queue);
+  evf->post_link = NULL;
 
   return (evf);
 }
@@ -136,9 +191,6 @@ static uint32_t svcEventFlagsSet(osEventFlagsId_t ef_id, uint32_t flags)
 {
   osEventFlags_t *evf = (osEventFlags_t *)ef_id;
   uint32_t        event_flags;
-  uint32_t        pattern;
-  queue_t        *que;
-  osThread_t     *thread;
 
   /* Check parameters */
   if (evf == NULL || evf->id != ID_EVENT_FLAGS) {
@@ -149,22 +201,7 @@ static uint32_t svcEventFlagsSet(osEventFlagsId_t ef_id, uint32_t flags)
   event_flags = EventFlagsSet(evf, flags);
 
   /* Check if Threads are waiting for Event Flags */
-  que = evf->wait_queue.next;
-  while (que != &evf->wait_queue) {
-    thread = GetThreadByQueue(que);
-    que = que->next;
-
-    pattern = EventFlagsCheck(evf, thread->winfo.event.flags, thread->winfo.event.options);
-    if (pattern) {
-      if (!(thread->winfo.event.options & osFlagsNoClear)) {
-        event_flags = pattern & ~thread->winfo.event.flags;
-      }
-      else {
-        event_flags = pattern;
-      }
-      krnThreadWaitExit(thread, pattern, DISPATCH_NO);
-    }
-  }
+  event_flags = EventFlagsWakeup(evf, flags, event_flags);
 
   SchedDispatch(NULL);
 
@@ -220,9 +257,10 @@ static uint32_t svcEventFlagsWait(osEventFlagsId_t ef_id, uint32_t flags, uint32
     if (timeout != 0U) {
       event_flags = (uint32_t)krnThreadWaitEnter(ThreadWaitingEventFlags, &evf->wait_queue, timeout);
       if (event_flags != (uint32_t)osErrorTimeout) {
-        winfo          = &ThreadGetRunning()->winfo.event;
+        winfo          = &ThreadGetWaiter()->winfo.event;
         winfo->options = options;
         winfo->flags   = flags;
+        evf->wait_flags |= flags;
       }
     }
     else {
@@ -261,6 +299,11 @@ uint32_t isrEventFlagsSet(osEventFlagsId_t ef_id, uint32_t flags)
   osEventFlags_t *evf = (osEventFlags_t *)ef_id;
   uint32_t        event_flags;
 
+  /* Check interrupt priority */
+  if (!IsrCallAllowed()) {
+    return (osFlagsErrorISR);
+  }
+
   /* Check parameters */
   if (evf == NULL || evf->id != ID_EVENT_FLAGS) {
     return (osFlagsErrorParameter);
@@ -269,6 +312,12 @@ uint32_t isrEventFlagsSet(osEventFlagsId_t ef_id, uint32_t flags)
   /* Set Event Flags */
   event_flags = EventFlagsSet(evf, flags);
 
+  BEGIN_CRITICAL_SECTION
+
+  evf->post_flags |= flags;
+
+  END_CRITICAL_SECTION
+
   /* Register post ISR processing */
   krnPostProcess((osObject_t *)evf);
 
@@ -281,6 +330,11 @@ uint32_t isrEventFlagsWait(osEventFlagsId_t ef_id, uint32_t flags, uint32_t opti
   osEventFlags_t *evf = (osEventFlags_t *)ef_id;
   uint32_t        event_flags;
 
+  /* Check interrupt priority */
+  if (!IsrCallAllowed()) {
+    return (osFlagsErrorISR);
+  }
+
   /* Check parameters */
   if (evf == NULL || evf->id != ID_EVENT_FLAGS || timeout != 0U) {
     return (osFlagsErrorParameter);
@@ -305,21 +359,17 @@ uint32_t isrEventFlagsWait(osEventFlagsId_t ef_id, uint32_t flags, uint32_t opti
  */
 void krnEventFlagsPostProcess(osEventFlags_t *evf)
 {
-  uint32_t    pattern;
-  queue_t    *que;
-  osThread_t *thread;
+  uint32_t flags;
 
-  /* Check if Threads are waiting for Event Flags */
-  que = evf->wait_queue.next;
-  while (que != &evf->wait_queue) {
-    thread = GetThreadByQueue(que);
-    que = que->next;
+  BEGIN_CRITICAL_SECTION
 
-    pattern = EventFlagsCheck(evf, thread->winfo.event.flags, thread->winfo.event.options);
-    if (pattern) {
-      krnThreadWaitExit(thread, pattern, DISPATCH_NO);
-    }
-  }
+  flags = evf->post_flags;
+  evf->post_flags = 0U;
+
+  END_CRITICAL_SECTION
+
+  /* Check if Threads are waiting for Event Flags */
+  (void)EventFlagsWakeup(evf, flags, 0U);
 }
 
 /*******************************************************************************
@@ -0,0 +1,380 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: mbOS real-time kernel
+ */
+
+/**
+ * @file
+ *
+ * Kernel system routines.
+ *
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include "kernel_lib.h"
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+/*
+ * Interrupt line states, kept in the state field and changed only in critical
+ * sections. The flags field belongs to the post processing (FLAGS_POST_PROC).
+ */
+#define IrqMasked             0x01U   ///< Line masked by the top half, bottom half not started
+#define IrqUnmask             0x02U   ///< Running bottom half has to unmask the line
+
+/*******************************************************************************
+ *  function prototypes (scope: module-local)
+ ******************************************************************************/
+
+static osStatus_t svcIrqThreadWait(osIrqThreadId_t irq_id, uint32_t done);
+
+/*******************************************************************************
+ *  Helper functions
+ ******************************************************************************/
+
+/**
+ * @brief       Bottom half thread of a threaded interrupt handler.
+ * @param[in]   argument  interrupt thread object.
+ */
+__NO_RETURN
+static void IrqThreadWorker(void *argument)
+{
+  osIrqThread_t *irq  = argument;
+  uint32_t       done = 0U;
+
+  for (;;) {
+    /* Wait for the interrupt */
+    if ((osStatus_t)SVC_2(irq, done, svcIrqThreadWait) == osOK) {
+      irq->func(irq->argument);
+      done = 1U;
+    }
+    else {
+      done = 0U;
+    }
+  }
+}
+
+/**
+ * @brief       Take the pending interrupt signal.
+ * @param[in]   irq   interrupt thread object.
+ * @return      true - interrupt was signaled, false - otherwise.
+ */
+static bool IrqThreadPendingTake(osIrqThread_t *irq)
+{
+  uint32_t pending;
+
+  BEGIN_CRITICAL_SECTION
+
+  pending = irq->pending;
+  irq->pending = 0U;
+
+  /* The bottom half about to run owns the line masked by the top half */
+  if ((irq->state & IrqMasked) != 0U) {
+    irq->state &= ~IrqMasked;
+    irq->state |=  IrqUnmask;
+  }
+
+  END_CRITICAL_SECTION
+
+  return (pending != 0U);
+}
+
+#if (defined(IRQ_LINE_MASK) && (IRQ_LINE_MASK != 0))
+/**
+ * @brief       Unmask the line if the completed bottom half was started by a masking top half.
+ * @param[in]   irq   interrupt thread object.
+ */
+static void IrqThreadUnmask(osIrqThread_t *irq)
+{
+  bool unmask;
+
+  BEGIN_CRITICAL_SECTION
+
+  unmask = ((irq->state & IrqUnmask) != 0U);
+  irq->state &= ~IrqUnmask;
+
+  END_CRITICAL_SECTION
+
+  if (unmask) {
+    IrqLineEnable(irq->irqn);
+  }
+}
+#endif
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+static osIrqThreadId_t svcIrqThreadNew(osThreadFunc_t func, void *argument, const osIrqThreadAttr_t *attr)
+{
+  osIrqThread_t  *irq;
+  osPriority_t    priority;
+  osThreadAttr_t  thread_attr;
+
+  /* Check parameters */
+  if ((func == NULL) || (attr == NULL)                ||
+      (attr->cb_mem == NULL)                          ||
+      (((uint32_t)attr->cb_mem & 3U) != 0U)           ||
+      (attr->cb_size < sizeof(osIrqThread_t))         ||
+      (attr->thread_mem == NULL)                      ||
+      (((uint32_t)attr->thread_mem & 3U) != 0U)       ||
+      (attr->thread_size < sizeof(osThread_t)))
+  {
+    return (NULL);
+  }
+
+  if ((attr->attr_bits & osIrqThreadMaskIrq) != 0U) {
+#if (defined(IRQ_LINE_MASK) && (IRQ_LINE_MASK != 0))
+    if (attr->irqn < 0) {
+      return (NULL);
+    }
+#else
+    return (NULL);
+#endif
+  }
+
+  priority = attr->priority;
+  if (priority == osPriorityNone) {
+    priority = osPriorityNormal;
+  }
+  else if ((priority < osPriorityIdle) || (priority > osPriorityISR)) {
+    return (NULL);
+  }
+
+  irq = attr->cb_mem;
+
+  /* Initialize control block */
+  irq->id       = ID_IRQ_THREAD;
+  irq->state    = 0U;
+  irq->flags    = 0U;
+  irq->attr     = (uint8_t)attr->attr_bits;
+  irq->irqn     = attr->irqn;
+  irq->pending  = 0U;
+  irq->func     = func;
+  irq->argument = argument;
+  irq->name     = attr->name;
+
+  QueueReset(&irq->wait_queue);
+  irq->post_link = NULL;
+
+  /* Create bottom half thread */
+  thread_attr.name       = attr->name;
+  thread_attr.attr_bits  = osThreadDetached;
+  thread_attr.cb_mem     = attr->thread_mem;
+  thread_attr.cb_size    = attr->thread_size;
+  thread_attr.stack_mem  = attr->stack_mem;
+  thread_attr.stack_size = attr->stack_size;
+  thread_attr.priority   = priority;
+  thread_attr.threshold  = osPriorityNone;
+
+  if (krnThreadNew(IrqThreadWorker, irq, &thread_attr) == NULL) {
+    irq->id = ID_INVALID;
+    return (NULL);
+  }
+
+  return (irq);
+}
+
+static const char *svcIrqThreadGetName(osIrqThreadId_t irq_id)
+{
+  osIrqThread_t *irq = irq_id;
+
+  /* Check parameters */
+  if ((irq == NULL) || (irq->id != ID_IRQ_THREAD)) {
+    return (NULL);
+  }
+
+  return (irq->name);
+}
+
+static osStatus_t svcIrqThreadSignal(osIrqThreadId_t irq_id)
+{
+  osIrqThread_t *irq = irq_id;
+
+  /* Check parameters */
+  if ((irq == NULL) || (irq->id != ID_IRQ_THREAD)) {
+    return (osErrorParameter);
+  }
+
+  irq->pending = 1U;
+
+  /* Wakeup the bottom half thread */
+  if (!isQueueEmpty(&irq->wait_queue)) {
+    krnThreadWaitExit(GetThreadByQueue(irq->wait_queue.next), (uint32_t)osOK, DISPATCH_YES);
+  }
+
+  return (osOK);
+}
+
+/**
+ * @brief       Finish the bottom half and wait for the next interrupt.
+ * @param[in]   irq_id  interrupt thread object.
+ * @param[in]   done    bottom half function has completed.
+ * @return      osOK when the bottom half has to run, osThreadWait otherwise.
+ */
+static osStatus_t svcIrqThreadWait(osIrqThreadId_t irq_id, uint32_t done)
+{
+  osIrqThread_t *irq = irq_id;
+
+#if (defined(IRQ_LINE_MASK) && (IRQ_LINE_MASK != 0))
+  if (done != 0U) {
+    /*
+     * Unmask the interrupt masked by the top half. Signals posted from
+     * thread mode never masked the line, it stays as the application left it.
+     */
+    IrqThreadUnmask(irq);
+  }
+#else
+  (void)done;
+#endif
+
+  if (IrqThreadPendingTake(irq)) {
+    return (osOK);
+  }
+
+  return (krnThreadWaitEnter(ThreadWaitingIrqThread, &irq->wait_queue, osWaitForever));
+}
+
+/*******************************************************************************
+ *  ISR Calls
+ ******************************************************************************/
+
+__STATIC_INLINE
+osStatus_t isrIrqThreadSignal(osIrqThreadId_t irq_id)
+{
+  osIrqThread_t *irq = irq_id;
+
+  /* Check interrupt priority */
+  if (!IsrCallAllowed()) {
+    return (osErrorISR);
+  }
+
+  /* Check parameters */
+  if ((irq == NULL) || (irq->id != ID_IRQ_THREAD)) {
+    return (osErrorParameter);
+  }
+
+#if (defined(IRQ_LINE_MASK) && (IRQ_LINE_MASK != 0))
+  if ((irq->attr & osIrqThreadMaskIrq) != 0U) {
+    /* Keep the interrupt masked until the bottom half completes */
+    BEGIN_CRITICAL_SECTION
+
+    IrqLineDisable(irq->irqn);
+    irq->state |= IrqMasked;
+
+    END_CRITICAL_SECTION
+  }
+#endif
+
+  irq->pending = 1U;
+
+  /* Register post ISR processing */
+  krnPostProcess((osObject_t *)irq);
+
+  return (osOK);
+}
+
+/*******************************************************************************
+ *  Post ISR processing
+ ******************************************************************************/
+
+/**
+ * @fn          void krnIrqThreadPostProcess(osIrqThread_t*)
+ * @brief       Interrupt Thread post ISR processing.
+ * @param[in]   irq  interrupt thread object.
+ */
+void krnIrqThreadPostProcess(osIrqThread_t *irq)
+{
+  /* Wakeup the bottom half thread */
+  if ((irq->pending != 0U) && !isQueueEmpty(&irq->wait_queue)) {
+    krnThreadWaitExit(GetThreadByQueue(irq->wait_queue.next), (uint32_t)osOK, DISPATCH_NO);
+  }
+}
+
+/*******************************************************************************
+ *  Public API
+ ******************************************************************************/
+
+/**
+ * @fn          osIrqThreadId_t osIrqThreadNew(osThreadFunc_t func, void *argument, const osIrqThreadAttr_t *attr)
+ * @brief       Create a threaded interrupt handler and start its bottom half thread.
+ * @param[in]   func      bottom half function.
+ * @param[in]   argument  pointer that is passed to the bottom half function.
+ * @param[in]   attr      interrupt thread attributes.
+ * @return      interrupt thread ID for reference by other functions or NULL in case of error.
+ */
+osIrqThreadId_t osIrqThreadNew(osThreadFunc_t func, void *argument, const osIrqThreadAttr_t *attr)
+{
+  osIrqThreadId_t irq_id;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    irq_id = NULL;
+  }
+  else {
+    irq_id = (osIrqThreadId_t)SVC_3(func, argument, attr, svcIrqThreadNew);
+  }
+
+  return (irq_id);
+}
+
+/**
+ * @fn          const char *osIrqThreadGetName(osIrqThreadId_t irq_id)
+ * @brief       Get name of an Interrupt Thread object.
+ * @param[in]   irq_id    interrupt thread ID obtained by \ref osIrqThreadNew.
+ * @return      name as null-terminated string or NULL in case of an error.
+ */
+const char *osIrqThreadGetName(osIrqThreadId_t irq_id)
+{
+  const char *name;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    name = NULL;
+  }
+  else {
+    name = (const char *)SVC_1(irq_id, svcIrqThreadGetName);
+  }
+
+  return (name);
+}
+
+/**
+ * @fn          osStatus_t osIrqThreadSignal(osIrqThreadId_t irq_id)
+ * @brief       Run the bottom half, called by the top half after the hardware is acknowledged.
+ * @param[in]   irq_id    interrupt thread ID obtained by \ref osIrqThreadNew.
+ * @return      status code that indicates the execution status of the function.
+ * @note        Can be called from Interrupt Service Routines.
+ */
+osStatus_t osIrqThreadSignal(osIrqThreadId_t irq_id)
+{
+  osStatus_t status;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    status = isrIrqThreadSignal(irq_id);
+  }
+  else {
+    status = (osStatus_t)SVC_1(irq_id, svcIrqThreadSignal);
+  }
+
+  return (status);
+}
+
+/*------------------------------ End of file ---------------------------------*/
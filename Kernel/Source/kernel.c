@@ -49,7 +49,9 @@ static osStatus_t svcKernelInitialize(void)
 
   QueueReset(&osInfo.timer_queue);
   QueueReset(&osInfo.delay_queue);
-  QueueReset(&osInfo.post_queue);
+
+  /* Setup interrupt mask for critical sections */
+  osInfo.isr_mask = SystemIsrMask(osConfig.isr_prio_max);
 
   osInfo.kernel.state = osKernelReady;
 
@@ -305,7 +307,8 @@ osStatus_t osKernelStart(void)
     status = osErrorISR;
   }
   else {
-    status = (osStatus_t)SVC_0(svcKernelStart);
+    /* Kernel start switches to the thread stack, always call through SVC */
+    status = (osStatus_t)svc_0((uint32_t)svcKernelStart);
   }
 
   return (status);
@@ -46,10 +46,17 @@
 #define ID_MESSAGE_QUEUE            (uint8_t)0x1C
 #define ID_MESSAGE                  (uint8_t)0x1D
 #define ID_DATA_QUEUE               (uint8_t)0x1E
-
-/* Object Flags definitions */
+#define ID_THREAD_POOL              (uint8_t)0x3C
+#define ID_TASK                     (uint8_t)0x4B
+#define ID_TASK_HOST                (uint8_t)0x4D
+#define ID_WORK_QUEUE               (uint8_t)0x57
+#define ID_WORK                     (uint8_t)0x58
+#define ID_IRQ_THREAD               (uint8_t)0x69
+
+/* Object Flags definitions, change them only with krnObjectFlagsSet/Clear */
 #define FLAGS_POST_PROC             (uint8_t)(1U << 0U)
 #define FLAGS_TIMER_PROC            (uint8_t)(1U << 1U)
+#define FLAGS_POOL_WORKER           (uint8_t)(1U << 2U)   ///< Thread is a Thread Pool worker
 
 /* Thread State definitions */
 #define ThreadStateMask             (0x0FU)
@@ -68,6 +75,10 @@
 #define ThreadWaitingQueueGet       ((uint8_t)(ThreadBlocked | 0x60U))
 #define ThreadWaitingQueuePut       ((uint8_t)(ThreadBlocked | 0x70U))
 #define ThreadWaitingDelay          ((uint8_t)(ThreadBlocked | 0x80U))
+#define ThreadWaitingThreadPool     ((uint8_t)(ThreadBlocked | 0x90U))
+#define ThreadWaitingTaskHost       ((uint8_t)(ThreadBlocked | 0xA0U))
+#define ThreadWaitingWorkQueue      ((uint8_t)(ThreadBlocked | 0xB0U))
+#define ThreadWaitingIrqThread      ((uint8_t)(ThreadBlocked | 0xC0U))
 
 #define container_of(ptr, type, member) ((type *)(void *)((uint8_t *)(ptr) - offsetof(type, member)))
 
@@ -77,7 +88,7 @@
 #define GetMutexByQueque(que)       container_of(que, osMutex_t, mutex_que)
 #define GetTimerByQueue(que)        container_of(que, osTimer_t, timer_que)
 #define GetMessageByQueue(que)      container_of(que, osMessage_t, msg_que)
-#define GetObjectByQueue(que)       container_of(que, osObject_t, post_queue)
+#define GetWorkByQueue(que)         container_of(que, osWork_t, work_que)
 
 #define osThreadWait                (-16)
 
@@ -103,7 +114,10 @@ typedef struct KernelInfo_s {
   queue_t             ready_list[NUM_PRIORITY];   ///< all ready to run(RUNNABLE) tasks
   queue_t                          timer_queue;
   queue_t                          delay_queue;
-  queue_t                           post_queue;   ///< ISR Post Processing queue
+  void                              *post_list;   ///< ISR Post Processing list
+  uint32_t                            isr_mask;   ///< Interrupt mask for critical sections
+  uint32_t                         preempt_bmp;   ///< Priorities of threads preempted with active threshold
+  osThread_t                         *run_list;   ///< Run-to-completion threads in the middle of a run, innermost first
 } KernelInfo_t;
 
 typedef enum {
@@ -117,7 +131,7 @@ typedef struct osObject_s {
   uint8_t                       state;  ///< Object State
   uint8_t                       flags;  ///< Object Flags
   uint8_t                    reserved;
-  queue_t                  post_queue;  ///< Post Processing queue
+  void                     *post_link;  ///< Post Processing list link
 } osObject_t;
 
 /*******************************************************************************
@@ -138,6 +152,22 @@ extern KernelInfo_t osInfo;             ///< Kernel Runtime Information
  */
 bool krnThreadStartup(void);
 
+/**
+ * @brief       Create a thread from kernel context.
+ * @param[in]   func      thread function.
+ * @param[in]   argument  pointer that is passed to the thread function as start argument.
+ * @param[in]   attr      thread attributes.
+ * @return      thread ID or NULL in case of error.
+ */
+osThreadId_t krnThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr);
+
+/**
+ * @brief       Terminate a thread from kernel context.
+ * @param[in]   thread    thread object.
+ * @return      status code that indicates the execution status of the function.
+ */
+osStatus_t krnThreadTerminate(osThread_t *thread);
+
 /**
  * @brief       Exit Thread wait state.
  * @param[out]  thread    thread object.
@@ -153,6 +183,15 @@ void krnThreadWaitExit(osThread_t *thread, uint32_t ret_val, dispatch_t dispatch
  */
 osStatus_t krnThreadWaitEnter(uint8_t state, queue_t *wait_que, uint32_t timeout);
 
+/**
+ * @brief       Enter Thread wait state with an optionally bucketed wait queue.
+ * @param[in]   state     New thread state.
+ * @param[out]  wait_que  Pointer to wait queue.
+ * @param[in]   buckets   Priority buckets of the wait queue or NULL.
+ * @param[in]   timeout   Timeout
+ */
+osStatus_t krnThreadWaitEnterBuckets(uint8_t state, queue_t *wait_que, wait_buckets_t *buckets, uint32_t timeout);
+
 /**
  * @brief
  * @param wait_que
@@ -166,6 +205,12 @@ void krnThreadWaitDelete(queue_t *que);
  */
 void krnThreadSetPriority(osThread_t *thread, int8_t priority);
 
+/**
+ * @brief       Start a new run of a run-to-completion thread on its shared stack.
+ * @param[in]   thread    thread object.
+ */
+void krnThreadRunStart(osThread_t *thread);
+
 /**
  * @brief       Dispatch specified Thread or Ready Thread with Highest Priority.
  * @param[in]   thread  thread object or NULL.
@@ -198,6 +243,111 @@ osThread_t *ThreadGetRunning(void)
   return (osInfo.thread.run.curr);
 }
 
+/**
+ * @brief       Get object entering wait state: running thread or its stackless task.
+ * @return      running thread or task control block sharing the thread layout.
+ */
+__STATIC_FORCEINLINE
+osThread_t *ThreadGetWaiter(void)
+{
+  osThread_t *thread = osInfo.thread.run.curr;
+
+  return ((thread->task != NULL) ? (osThread_t *)(void *)thread->task : thread);
+}
+
+/**
+ * @brief       Check if RTOS functions may be called from the active interrupt.
+ * @return      true - allowed, false - interrupt priority above maximum syscall priority.
+ */
+__STATIC_FORCEINLINE
+bool IsrCallAllowed(void)
+{
+  return (IsIrqPrioAllowed(osInfo.isr_mask));
+}
+
+#if (defined(DIRECT_CALL) && (DIRECT_CALL != 0))
+
+/**
+ * @brief       Check if kernel functions are called directly instead of SVC.
+ * @return      true - direct call, false - call through SVC.
+ */
+__STATIC_FORCEINLINE
+bool IsDirectCall(void)
+{
+  return (((osConfig.flags & osConfigDirectCall) != 0U) && IsPrivileged());
+}
+
+/**
+ * @brief       Finish direct kernel call and request thread switch via PendSV.
+ * @param[in]   lock  value returned by \ref DirectCallLock.
+ */
+__STATIC_FORCEINLINE
+void DirectCallExit(uint32_t lock)
+{
+  if (osInfo.thread.run.curr != osInfo.thread.run.next) {
+    PendServCallReq();
+  }
+
+  DirectCallUnlock(lock);
+}
+
+__STATIC_FORCEINLINE
+uint32_t direct_0(uint32_t func)
+{
+  uint32_t lock = DirectCallLock();
+  uint32_t ret  = ((uint32_t (*)(void))func)();
+
+  DirectCallExit(lock);
+
+  return (ret);
+}
+
+__STATIC_FORCEINLINE
+uint32_t direct_1(uint32_t param1, uint32_t func)
+{
+  uint32_t lock = DirectCallLock();
+  uint32_t ret  = ((uint32_t (*)(uint32_t))func)(param1);
+
+  DirectCallExit(lock);
+
+  return (ret);
+}
+
+__STATIC_FORCEINLINE
+uint32_t direct_2(uint32_t param1, uint32_t param2, uint32_t func)
+{
+  uint32_t lock = DirectCallLock();
+  uint32_t ret  = ((uint32_t (*)(uint32_t, uint32_t))func)(param1, param2);
+
+  DirectCallExit(lock);
+
+  return (ret);
+}
+
+__STATIC_FORCEINLINE
+uint32_t direct_3(uint32_t param1, uint32_t param2, uint32_t param3, uint32_t func)
+{
+  uint32_t lock = DirectCallLock();
+  uint32_t ret  = ((uint32_t (*)(uint32_t, uint32_t, uint32_t))func)(param1, param2, param3);
+
+  DirectCallExit(lock);
+
+  return (ret);
+}
+
+__STATIC_FORCEINLINE
+uint32_t direct_4(uint32_t param1, uint32_t param2, uint32_t param3, uint32_t param4, uint32_t func)
+{
+  uint32_t lock = DirectCallLock();
+  uint32_t ret  = ((uint32_t (*)(uint32_t, uint32_t, uint32_t, uint32_t))func)(param1, param2, param3, param4);
+
+  DirectCallExit(lock);
+
+  return (ret);
+}
+
+#endif
+
 
 /* Queue */
 
@@ -262,6 +412,16 @@ void QueueRemoveEntry(queue_t *entry)
 }
 
 
+/* Stackless Task */
+
+/**
+ * @brief       Make a waiting task ready and wakeup its host thread.
+ * @param[in]   task      task object.
+ * @param[in]   dispatch  dispatch the host thread.
+ */
+void krnTaskReady(osTask_t *task, dispatch_t dispatch);
+
+
 /* Timer */
 
 void krnTimerInsert(osTimer_t *timer, uint32_t time);
@@ -344,6 +504,18 @@ void krnDataQueuePostProcess(osDataQueue_t *dq);
  */
 void krnMemoryPoolPostProcess(osMemoryPool_t *mp);
 
+/**
+ * @brief       Work item post ISR processing.
+ * @param[in]   work  work item object.
+ */
+void krnWorkPostProcess(osWork_t *work);
+
+/**
+ * @brief       Interrupt Thread post ISR processing.
+ * @param[in]   irq  interrupt thread object.
+ */
+void krnIrqThreadPostProcess(osIrqThread_t *irq);
+
 /*******************************************************************************
  *  System Library functions
  ******************************************************************************/
@@ -351,5 +523,7 @@ void krnMemoryPoolPostProcess(osMemoryPool_t *mp);
 extern void osTick_Handler(void);
 extern void osPendSV_Handler(void);
 extern void krnPostProcess(osObject_t *object);
+extern void krnObjectFlagsSet(osObject_t *object, uint8_t flags);
+extern void krnObjectFlagsClear(osObject_t *object, uint8_t flags);
 
 #endif /* _KERNEL_LIB_H_ */
@@ -179,7 +179,7 @@ static osMemoryPoolId_t svcMemoryPoolNew(uint32_t block_count, uint32_t block_si
   mp->flags = 0U;
   mp->name = attr->name;
   QueueReset(&mp->wait_queue);
-  QueueReset(&mp->post_queue);
+  mp->post_link = NULL;
   krnMemoryPoolInit(block_count, block_size, mp_mem, &mp->info);
 
   return (mp);
@@ -319,6 +319,11 @@ void *isrMemoryPoolAlloc(osMemoryPoolId_t mp_id, uint32_t timeout)
   osMemoryPool_t *mp = mp_id;
   void           *block;
 
+  /* Check interrupt priority */
+  if (!IsrCallAllowed()) {
+    return (NULL);
+  }
+
   /* Check parameters */
   if ((mp == NULL) || (mp->id != ID_MEMORYPOOL) || (timeout != 0U)) {
     return (NULL);
@@ -336,6 +341,11 @@ osStatus_t isrMemoryPoolFree(osMemoryPoolId_t mp_id, void *block)
   osMemoryPool_t *mp = mp_id;
   osStatus_t      status;
 
+  /* Check interrupt priority */
+  if (!IsrCallAllowed()) {
+    return (osErrorISR);
+  }
+
   /* Check parameters */
   if ((mp == NULL) || (mp->id != ID_MEMORYPOOL)) {
     return (osErrorParameter);
@@ -150,7 +150,7 @@ static osMessageQueueId_t svcMessageQueueNew(uint32_t msg_count, uint32_t msg_si
   QueueReset(&mq->wait_put_queue);
   QueueReset(&mq->wait_get_queue);
   QueueReset(&mq->msg_queue);
-  QueueReset(&mq->post_queue);
+  mq->post_link = NULL;
   krnMemoryPoolInit(msg_count, block_size, mq_mem, &mq->mp_info);
 
   return (mq);
@@ -205,7 +205,7 @@ static osStatus_t svcMessageQueuePut(osMessageQueueId_t mq_id, const void *msg_p
         /* Suspend current Thread */
         status = krnThreadWaitEnter(ThreadWaitingQueuePut, &mq->wait_put_queue, timeout);
         if (status != osErrorTimeout) {
-          winfo           = &ThreadGetRunning()->winfo.msgque;
+          winfo           = &ThreadGetWaiter()->winfo.msgque;
           winfo->msg      = (void *)msg_ptr;
           winfo->msg_prio = (uint32_t)msg_prio;
         }
@@ -256,7 +256,7 @@ static osStatus_t svcMessageQueueGet(osMessageQueueId_t mq_id, void *msg_ptr, ui
       /* Suspend current Thread */
       status = krnThreadWaitEnter(ThreadWaitingQueueGet, &mq->wait_get_queue, timeout);
       if (status != osErrorTimeout) {
-        winfo           = &ThreadGetRunning()->winfo.msgque;
+        winfo           = &ThreadGetWaiter()->winfo.msgque;
         winfo->msg      = msg_ptr;
         winfo->msg_prio = (uint32_t)msg_prio;
       }
@@ -382,6 +382,11 @@ osStatus_t isrMessageQueuePut(osMessageQueueId_t mq_id, const void *msg_ptr, uin
   osMessage_t      *msg;
   osStatus_t        status;
 
+  /* Check interrupt priority */
+  if (!IsrCallAllowed()) {
+    return (osErrorISR);
+  }
+
   /* Check parameters */
   if ((mq      == NULL) || (mq->id  != ID_MESSAGE_QUEUE) ||
       (msg_ptr == NULL) || (timeout != 0U)) {
@@ -410,6 +415,11 @@ osStatus_t isrMessageQueueGet(osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *
   osMessage_t      *msg;
   osStatus_t        status;
 
+  /* Check interrupt priority */
+  if (!IsrCallAllowed()) {
+    return (osErrorISR);
+  }
+
   /* Check parameters */
   if ((mq      == NULL) || (mq->id  != ID_MESSAGE_QUEUE) ||
       (msg_ptr == NULL) || (timeout != 0U)) {
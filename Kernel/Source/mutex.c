@@ -36,6 +36,12 @@
 
 #define osMutexLockLimit              (255U)
 
+/*******************************************************************************
+ *  function prototypes (scope: module-local)
+ ******************************************************************************/
+
+static void MutexOwnerSet(osMutex_t *mutex, osThread_t *thread);
+
 /*******************************************************************************
  *  Library functions
  ******************************************************************************/
@@ -59,9 +65,7 @@ void krnMutexOwnerRelease(queue_t *que)
         /* Wakeup waiting Thread with highest Priority */
         thread = GetThreadByQueue(mutex->wait_que.next);
         krnThreadWaitExit(thread, (uint32_t)osOK, DISPATCH_NO);
-        mutex->holder = thread;
-        mutex->cnt = 1U;
-        QueueAppend(&thread->mutex_que, &mutex->mutex_que);
+        MutexOwnerSet(mutex, thread);
       }
     }
   }
@@ -71,6 +75,29 @@ void krnMutexOwnerRelease(queue_t *que)
  *  Helper functions
  ******************************************************************************/
 
+/**
+ * @brief       Make a Thread the owner of a Mutex.
+ * @param[in]   mutex   mutex object.
+ * @param[in]   thread  new owner thread.
+ */
+static void MutexOwnerSet(osMutex_t *mutex, osThread_t *thread)
+{
+  mutex->holder = thread;
+  mutex->cnt = 1U;
+  QueueAppend(&thread->mutex_que, &mutex->mutex_que);
+
+  /* Immediate priority ceiling: raise the owner without looking at waiters */
+  if (((mutex->attr & osMutexPrioCeiling) != 0U) && (thread->priority < mutex->ceiling)) {
+    krnThreadSetPriority(thread, mutex->ceiling);
+  }
+}
+
+/**
+ * @brief       Restore the Thread priority after a Mutex release.
+ * @param[in]   thread  thread object.
+ * @note        Visits every mutex the thread still holds and only the first
+ *              waiter of each, O(n) in the number of mutexes held.
+ */
 static void RestoreThreadPriority(osThread_t *thread)
 {
   osMutex_t  *mutex;
@@ -84,7 +111,12 @@ static void RestoreThreadPriority(osThread_t *thread)
     que = thread->mutex_que.next;
     while (que != &thread->mutex_que) {
       mutex = GetMutexByQueque(que);
-      if (!isQueueEmpty(&mutex->wait_que)) {
+      if ((mutex->attr & osMutexPrioCeiling) != 0U) {
+        if (mutex->ceiling > priority) {
+          priority = mutex->ceiling;
+        }
+      }
+      else if (!isQueueEmpty(&mutex->wait_que)) {
         wthread = GetThreadByQueue(mutex->wait_que.next);
         if (wthread->priority > priority) {
           priority = wthread->priority;
@@ -117,6 +149,20 @@ static osMutexId_t svcMutexNew(const osMutexAttr_t *attr)
     return (NULL);
   }
 
+  /* Check memory for priority buckets */
+  if (((attr->attr_bits & osMutexPrioBuckets) != 0U) &&
+      (attr->cb_size < (sizeof(osMutex_t) + sizeof(wait_buckets_t)))) {
+    return (NULL);
+  }
+
+  /* Check priority ceiling, it excludes priority inheritance */
+  if ((attr->attr_bits & osMutexPrioCeiling) != 0U) {
+    if (((attr->attr_bits & osMutexPrioInherit) != 0U) ||
+        (attr->ceiling < osPriorityIdle) || (attr->ceiling > osPriorityISR)) {
+      return (NULL);
+    }
+  }
+
   /* Initialize control block */
   mutex->id     = ID_MUTEX;
   mutex->flags  = 0U;
@@ -124,9 +170,26 @@ static osMutexId_t svcMutexNew(const osMutexAttr_t *attr)
   mutex->name   = attr->name;
   mutex->holder = NULL;
   mutex->cnt    = 0U;
+  mutex->post_link = NULL;
+
+  if ((attr->attr_bits & osMutexPrioCeiling) != 0U) {
+    mutex->ceiling = (int8_t)attr->ceiling;
+  }
+  else {
+    mutex->ceiling = (int8_t)osPriorityNone;
+  }
+
+  /* Priority buckets follow the control block */
+  if ((attr->attr_bits & osMutexPrioBuckets) != 0U) {
+    mutex->buckets = (wait_buckets_t *)(void *)(mutex + 1);
+    mutex->buckets->bmp = 0U;
+  }
+  else {
+    mutex->buckets = NULL;
+  }
+
   QueueReset(&mutex->wait_que);
   QueueReset(&mutex->mutex_que);
-  QueueReset(&mutex->post_queue);
 
   return (mutex);
 }
@@ -159,12 +222,21 @@ static osStatus_t svcMutexAcquire(osMutexId_t mutex_id, uint32_t timeout)
     return (osError);
   }
 
+  /* Runs on a shared stack are nested by priority, it must not change */
+  if (((mutex->attr & (osMutexPrioInherit | osMutexPrioCeiling)) != 0U) &&
+      ((running_thread->attr & osThreadRunToCompletion) != 0U)) {
+    return (osErrorParameter);
+  }
+
+  /* Check if running Thread priority exceeds the priority ceiling */
+  if (((mutex->attr & osMutexPrioCeiling) != 0U) && (running_thread->base_priority > mutex->ceiling)) {
+    return (osErrorParameter);
+  }
+
   /* Check if Mutex is not locked */
   if (mutex->cnt == 0U) {
     /* Acquire Mutex */
-    mutex->holder = running_thread;
-    mutex->cnt = 1U;
-    QueueAppend(&running_thread->mutex_que, &mutex->mutex_que);
+    MutexOwnerSet(mutex, running_thread);
     status = osOK;
   }
   else {
@@ -180,8 +252,8 @@ static osStatus_t svcMutexAcquire(osMutexId_t mutex_id, uint32_t timeout)
       }
     }
     else {
-      /* Check if timeout is specified */
-      if (timeout != 0U) {
+      /* Check if timeout is specified, stackless tasks can not wait for a mutex */
+      if ((timeout != 0U) && (running_thread->task == NULL)) {
         /* Check if Priority inheritance protocol is enabled */
         if ((mutex->attr & osMutexPrioInherit) != 0U) {
           /* Raise priority of owner Task if lower than priority of running Task */
@@ -190,7 +262,7 @@ static osStatus_t svcMutexAcquire(osMutexId_t mutex_id, uint32_t timeout)
           }
         }
         /* Suspend current Thread */
-        status = krnThreadWaitEnter(ThreadWaitingMutex, &mutex->wait_que, timeout);
+        status = krnThreadWaitEnterBuckets(ThreadWaitingMutex, &mutex->wait_que, mutex->buckets, timeout);
       }
       else {
         status = osErrorResource;
@@ -236,7 +308,7 @@ static osStatus_t svcMutexRelease(osMutexId_t mutex_id)
     QueueRemoveEntry(&mutex->mutex_que);
 
     /* Restore owner Thread priority */
-    if ((mutex->attr & osMutexPrioInherit) != 0U) {
+    if ((mutex->attr & (osMutexPrioInherit | osMutexPrioCeiling)) != 0U) {
       RestoreThreadPriority(running_thread);
     }
 
@@ -245,9 +317,7 @@ static osStatus_t svcMutexRelease(osMutexId_t mutex_id)
       /* Wakeup waiting Thread with highest Priority */
       thread = GetThreadByQueue(mutex->wait_que.next);
       krnThreadWaitExit(thread, (uint32_t)osOK, DISPATCH_NO);
-      mutex->holder = thread;
-      mutex->cnt = 1U;
-      QueueAppend(&thread->mutex_que, &mutex->mutex_que);
+      MutexOwnerSet(mutex, thread);
     }
 
     SchedDispatch(NULL);
@@ -287,7 +357,7 @@ static osStatus_t svcMutexDelete(osMutexId_t mutex_id)
     QueueRemoveEntry(&mutex->mutex_que);
 
     /* Restore owner Thread priority */
-    if ((mutex->attr & osMutexPrioInherit) != 0U) {
+    if ((mutex->attr & (osMutexPrioInherit | osMutexPrioCeiling)) != 0U) {
       RestoreThreadPriority(mutex->holder);
     }
 
@@ -31,6 +31,7 @@ static osThread_t* ThreadHighestPrioGet(void)
 {
   int8_t priority;
   osThread_t *thread;
+  osThread_t *preempted;
 
   if (osInfo.ready_to_run_bmp == 0U) {
     return (NULL);
@@ -39,12 +40,48 @@ static osThread_t* ThreadHighestPrioGet(void)
   priority = (int8_t)((NUM_PRIORITY - 1U) - __CLZ(osInfo.ready_to_run_bmp));
   thread = GetThreadByQueue(osInfo.ready_list[priority].next);
 
+  if (osInfo.preempt_bmp != 0U) {
+    /* Resume preempted Thread if its threshold still blocks the ready Thread */
+    priority  = (int8_t)((NUM_PRIORITY - 1U) - __CLZ(osInfo.preempt_bmp));
+    preempted = GetThreadByQueue(osInfo.ready_list[priority].next);
+    if (preempted->threshold >= thread->priority) {
+      thread = preempted;
+    }
+  }
+
   return (thread);
 }
 
+/**
+ * @brief       Get priority that must be exceeded to preempt the thread.
+ * @param[in]   thread  thread object.
+ * @return      greater of the thread priority and preemption threshold.
+ */
+__STATIC_FORCEINLINE
+int8_t ThreadPreemptPrio(osThread_t *thread)
+{
+  return ((thread->threshold > thread->priority) ? thread->threshold : thread->priority);
+}
+
+__STATIC_FORCEINLINE
+void ThreadPreemptedClear(osThread_t *thread)
+{
+  if (thread->preempted != 0U) {
+    thread->preempted = 0U;
+    osInfo.preempt_bmp &= ~(1UL << (thread->priority - 1));
+  }
+}
+
 __STATIC_FORCEINLINE
 void ThreadSwitch(osThread_t *thread)
 {
+  ThreadPreemptedClear(thread);
+#if (defined(SHARED_STACK) && (SHARED_STACK != 0))
+  if (((thread->attr & osThreadRunToCompletion) != 0U) && (thread->run_top == 0U)) {
+    /* Start a new run from the entry point */
+    krnThreadRunStart(thread);
+  }
+#endif
   thread->state = ThreadRunning;
   osInfo.thread.run.next = thread;
 }
@@ -56,6 +93,7 @@ void ThreadSwitch(osThread_t *thread)
 void SchedDispatch(osThread_t *thread)
 {
   osThread_t *thread_next;
+  queue_t    *que;
 
   if (osInfo.kernel.state == osKernelRunning) {
     if (thread == NULL) {
@@ -71,9 +109,17 @@ void SchedDispatch(osThread_t *thread)
       return;
     }
 
-    if (thread->priority > thread_next->priority) {
+    if (thread->priority > ThreadPreemptPrio(thread_next)) {
       /* Preempt running Thread */
       thread_next->state = ThreadReady;
+      if (thread_next->threshold > thread_next->priority) {
+        /* Resume it first at its priority and before Threads below its threshold */
+        que = &osInfo.ready_list[thread_next->priority - 1];
+        QueueRemoveEntry(&thread_next->thread_que);
+        QueueAppend(que->next, &thread_next->thread_que);
+        thread_next->preempted = 1U;
+        osInfo.preempt_bmp |= (1UL << (thread_next->priority - 1));
+      }
       ThreadSwitch(thread);
     }
   }
@@ -89,6 +135,11 @@ void SchedYield(osThread_t *thread)
   queue_t *que;
   int8_t  priority;
 
+  /* Run-to-completion thread is not rotated in the middle of a run */
+  if (thread->run_top != 0U) {
+    return;
+  }
+
   priority = thread->priority - 1;
   que = &osInfo.ready_list[priority];
 
@@ -129,6 +180,7 @@ void SchedThreadReadyDel(osThread_t *thread, uint8_t thread_state)
 
   /* Remove the thread from ready queue */
   QueueRemoveEntry(&thread->thread_que);
+  ThreadPreemptedClear(thread);
 
   thread->state = thread_state;
   if (isQueueEmpty(&osInfo.ready_list[priority])) {
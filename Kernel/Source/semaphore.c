@@ -109,6 +109,12 @@ static osSemaphoreId_t svcSemaphoreNew(uint32_t max_count, uint32_t initial_coun
     return (NULL);
   }
 
+  /* Check memory for priority buckets */
+  if (((attr->attr_bits & osSemaphorePrioBuckets) != 0U) &&
+      (attr->cb_size < (sizeof(osSemaphore_t) + sizeof(wait_buckets_t)))) {
+    return (NULL);
+  }
+
   sem = attr->cb_mem;
 
   /* Initialize control block */
@@ -118,8 +124,17 @@ static osSemaphoreId_t svcSemaphoreNew(uint32_t max_count, uint32_t initial_coun
   sem->count      = (uint16_t)initial_count;
   sem->max_count  = (uint16_t)max_count;
 
+  /* Priority buckets follow the control block */
+  if ((attr->attr_bits & osSemaphorePrioBuckets) != 0U) {
+    sem->buckets = (wait_buckets_t *)(void *)(sem + 1);
+    sem->buckets->bmp = 0U;
+  }
+  else {
+    sem->buckets = NULL;
+  }
+
   QueueReset(&sem->wait_queue);
-  QueueReset(&sem->post_queue);
+  sem->post_link = NULL;
 
   return (sem);
 }
@@ -150,7 +165,7 @@ static osStatus_t svcSemaphoreAcquire(osSemaphoreId_t semaphore_id, uint32_t tim
   status = SemaphoreTokenDecrement(sem);
   if ((status == osErrorResource) && (timeout != 0U)) {
     /* No token available */
-    status = krnThreadWaitEnter(ThreadWaitingSemaphore, &sem->wait_queue, timeout);
+    status = krnThreadWaitEnterBuckets(ThreadWaitingSemaphore, &sem->wait_queue, sem->buckets, timeout);
   }
 
   return (status);
@@ -219,6 +234,11 @@ osStatus_t isrSemaphoreAcquire(osSemaphoreId_t semaphore_id, uint32_t timeout)
   osSemaphore_t *sem = semaphore_id;
   osStatus_t status;
 
+  /* Check interrupt priority */
+  if (!IsrCallAllowed()) {
+    return (osErrorISR);
+  }
+
   /* Check parameters */
   if ((sem == NULL) || (sem->id != ID_SEMAPHORE) || (timeout != 0U)) {
     return (osErrorParameter);
@@ -236,6 +256,11 @@ osStatus_t isrSemaphoreRelease(osSemaphoreId_t semaphore_id)
   osSemaphore_t *sem = semaphore_id;
   osStatus_t status;
 
+  /* Check interrupt priority */
+  if (!IsrCallAllowed()) {
+    return (osErrorISR);
+  }
+
   /* Check parameters */
   if ((sem == NULL) || (sem->id != ID_SEMAPHORE)) {
     return (osErrorParameter);
@@ -36,48 +36,72 @@
  ******************************************************************************/
 
 /**
- * @fn          void post_queue_put(osObject_t*)
- * @brief       Put Object into ISR Queue.
+ * @fn          void post_list_put(osObject_t*)
+ * @brief       Put Object into ISR Post Processing list.
  * @param[in]   object  object.
  */
-static void post_queue_put(osObject_t *object)
+static void post_list_put(osObject_t *object)
 {
+#if (defined(EXCLUSIVE_ACCESS) && (EXCLUSIVE_ACCESS != 0))
+  uint8_t  flags;
+  uint32_t head;
+
+  /* Set pending flag, skip the object if it is already in the list */
+  do {
+    flags = __LDREXB(&object->flags);
+    if ((flags & FLAGS_POST_PROC) != 0U) {
+      __CLREX();
+      return;
+    }
+  } while (__STREXB((uint8_t)(flags | FLAGS_POST_PROC), &object->flags) != 0U);
+
+  /* Add the object to the head of post ISR list */
+  do {
+    head = __LDREXW((volatile uint32_t *)&osInfo.post_list);
+    object->post_link = (void *)head;
+  } while (__STREXW((uint32_t)object, (volatile uint32_t *)&osInfo.post_list) != 0U);
+#else
   BEGIN_CRITICAL_SECTION
 
   if ((object->flags & FLAGS_POST_PROC) == 0U) {
     object->flags |= FLAGS_POST_PROC;
-    /* Add the object to the end of post ISR queue */
-    QueueAppend(&osInfo.post_queue, &object->post_queue);
+    /* Add the object to the head of post ISR list */
+    object->post_link = osInfo.post_list;
+    osInfo.post_list  = object;
   }
 
   END_CRITICAL_SECTION
+#endif
 }
 
 /**
- * @fn          osObject_t post_queue_get*(void)
- * @brief       Get Object from ISR Queue.
- * @return      object or NULL.
+ * @fn          osObject_t *post_list_get(void)
+ * @brief       Take all Objects from ISR Post Processing list.
+ * @return      list of objects in the order they were posted or NULL.
  */
-static osObject_t* post_queue_get(void)
+static osObject_t *post_list_get(void)
 {
-  queue_t    *que;
-  osObject_t *obj;
+  osObject_t *head;
+  osObject_t *next;
+  osObject_t *list;
 
   BEGIN_CRITICAL_SECTION
 
-  que = &osInfo.post_queue;
-
-  if (!isQueueEmpty(que)) {
-    obj = GetObjectByQueue(QueueExtract(que));
-    obj->flags &= ~FLAGS_POST_PROC;
-  }
-  else {
-    obj = NULL;
-  }
+  head = osInfo.post_list;
+  osInfo.post_list = NULL;
 
   END_CRITICAL_SECTION
 
-  return (obj);
+  /* Reverse the list to restore posting order */
+  list = NULL;
+  while (head != NULL) {
+    next = head->post_link;
+    head->post_link = list;
+    list = head;
+    head = next;
+  }
+
+  return (list);
 }
 
 /*******************************************************************************
@@ -143,12 +167,16 @@ void osTick_Handler(void)
 void osPendSV_Handler(void)
 {
   osObject_t *object;
+  osObject_t *list;
 
-  for (;;) {
-    object = post_queue_get();
-    if (object == NULL) {
-      break;
-    }
+  list = post_list_get();
+
+  while (list != NULL) {
+    object = list;
+    list = object->post_link;
+
+    /* Object may be posted again from now on */
+    krnObjectFlagsClear(object, FLAGS_POST_PROC);
 
     switch (object->id) {
       case ID_THREAD:
@@ -175,6 +203,14 @@ void osPendSV_Handler(void)
         krnDataQueuePostProcess((osDataQueue_t *)object);
         break;
 
+      case ID_WORK:
+        krnWorkPostProcess((osWork_t *)object);
+        break;
+
+      case ID_IRQ_THREAD:
+        krnIrqThreadPostProcess((osIrqThread_t *)object);
+        break;
+
       default:
         break;
     }
@@ -189,6 +225,52 @@ void osPendSV_Handler(void)
  */
 void krnPostProcess(osObject_t *object)
 {
-  post_queue_put(object);
+  post_list_put(object);
   PendServCallReq();
 }
+
+/**
+ * @brief       Set Object Flags.
+ * @param[in]   object  generic object.
+ * @param[in]   flags   flags to set.
+ * @note        An ISR may post the object at any time, so every write to the
+ *              flags byte is atomic with respect to post_list_put.
+ */
+void krnObjectFlagsSet(osObject_t *object, uint8_t flags)
+{
+#if (defined(EXCLUSIVE_ACCESS) && (EXCLUSIVE_ACCESS != 0))
+  uint8_t value;
+
+  do {
+    value = __LDREXB(&object->flags);
+  } while (__STREXB((uint8_t)(value | flags), &object->flags) != 0U);
+#else
+  BEGIN_CRITICAL_SECTION
+
+  object->flags |= flags;
+
+  END_CRITICAL_SECTION
+#endif
+}
+
+/**
+ * @brief       Clear Object Flags.
+ * @param[in]   object  generic object.
+ * @param[in]   flags   flags to clear.
+ */
+void krnObjectFlagsClear(osObject_t *object, uint8_t flags)
+{
+#if (defined(EXCLUSIVE_ACCESS) && (EXCLUSIVE_ACCESS != 0))
+  uint8_t value;
+
+  do {
+    value = __LDREXB(&object->flags);
+  } while (__STREXB((uint8_t)(value & ~flags), &object->flags) != 0U);
+#else
+  BEGIN_CRITICAL_SECTION
+
+  object->flags &= (uint8_t)~flags;
+
+  END_CRITICAL_SECTION
+#endif
+}
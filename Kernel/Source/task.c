@@ -0,0 +1,359 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: mbOS real-time kernel
+ */
+
+/**
+ * @file
+ *
+ * Kernel system routines.
+ *
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include "kernel_lib.h"
+
+/*******************************************************************************
+ *  Helper functions
+ ******************************************************************************/
+
+/**
+ * @brief       Append a task to the ready queue of its host.
+ * @param[in]   task  task object.
+ * @return      true - host thread has to be woken up, false - otherwise.
+ */
+static bool TaskReadyAdd(osTask_t *task)
+{
+  osTaskHost_t *host = task->host;
+
+  /* Remove the task from any queue */
+  QueueRemoveEntry(&task->thread_que);
+
+  task->state = ThreadReady;
+  QueueAppend(&host->ready_queue, &task->thread_que);
+
+  return (!isQueueEmpty(&host->wait_queue));
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+static osTaskHostId_t svcTaskHostNew(const osTaskHostAttr_t *attr)
+{
+  osTaskHost_t *host;
+
+  /* Check parameters */
+  if ((attr == NULL)                         ||
+      (attr->cb_mem == NULL)                 ||
+      (((uint32_t)attr->cb_mem & 3U) != 0U)  ||
+      (attr->cb_size < sizeof(osTaskHost_t)))
+  {
+    return (NULL);
+  }
+
+  host = attr->cb_mem;
+
+  /* Initialize control block */
+  host->id     = ID_TASK_HOST;
+  host->flags  = 0U;
+  host->name   = attr->name;
+  host->thread = NULL;
+
+  QueueReset(&host->ready_queue);
+  QueueReset(&host->wait_queue);
+  host->post_link = NULL;
+
+  return (host);
+}
+
+/**
+ * @brief       Finish the task executed by the running thread and start the
+ *              next ready task of the host.
+ * @param[in]   host_id   task host object.
+ * @return      osOK - next task started, osThreadWait - no ready tasks,
+ *              error code otherwise.
+ */
+static osStatus_t svcTaskHostSwitch(osTaskHostId_t host_id)
+{
+  osTaskHost_t *host = host_id;
+  osThread_t   *thread;
+  osTask_t     *task;
+
+  /* Check parameters */
+  if ((host == NULL) || (host->id != ID_TASK_HOST)) {
+    return (osErrorParameter);
+  }
+
+  thread = ThreadGetRunning();
+
+  /* Only one thread may execute tasks of the host */
+  if (host->thread == NULL) {
+    host->thread = thread;
+  }
+  else if (host->thread != thread) {
+    return (osErrorResource);
+  }
+
+  /* Finish the previous task */
+  task = thread->task;
+  if (task != NULL) {
+    thread->task  = NULL;
+    task->waiting = 0U;
+    if (task->state == ThreadRunning) {
+      if (task->lc == osTaskLineEnd) {
+        task->state = ThreadInactive;
+      }
+      else {
+        /* Task yielded */
+        (void)TaskReadyAdd(task);
+      }
+    }
+  }
+
+  if (isQueueEmpty(&host->ready_queue)) {
+    /* Wait for a task to become ready */
+    return (krnThreadWaitEnter(ThreadWaitingTaskHost, &host->wait_queue, osWaitForever));
+  }
+
+  /* Start the next task */
+  task = (osTask_t *)(void *)GetThreadByQueue(QueueExtract(&host->ready_queue));
+  task->state  = ThreadRunning;
+  thread->task = task;
+
+  return (osOK);
+}
+
+static osTaskId_t svcTaskNew(osTaskHostId_t host_id, osTaskFunc_t func, void *argument, const osTaskAttr_t *attr)
+{
+  osTaskHost_t *host = host_id;
+  osTask_t     *task;
+  osPriority_t  priority;
+
+  /* Check parameters */
+  if ((host == NULL) || (host->id != ID_TASK_HOST) || (func == NULL) ||
+      (attr == NULL)                                              ||
+      (attr->cb_mem == NULL)                                      ||
+      (((uint32_t)attr->cb_mem & 3U) != 0U)                       ||
+      (attr->cb_size < sizeof(osTask_t)))
+  {
+    return (NULL);
+  }
+
+  priority = attr->priority;
+  if (priority == osPriorityNone) {
+    priority = osPriorityNormal;
+  }
+  else if ((priority < osPriorityIdle) || (priority > osPriorityISR)) {
+    return (NULL);
+  }
+
+  task = attr->cb_mem;
+
+  /* Initialize control block */
+  task->id        = ID_TASK;
+  task->flags     = 0U;
+  task->attr      = (uint8_t)attr->attr_bits;
+  task->waiting   = 0U;
+  task->priority  = (int8_t)priority;
+  task->lc        = 0U;
+  task->delay     = 0U;
+  task->func      = func;
+  task->argument  = argument;
+  task->host      = host;
+  task->name      = attr->name;
+  task->post_link = NULL;
+
+  QueueReset(&task->thread_que);
+  QueueReset(&task->delay_que);
+  task->buckets = NULL;
+
+  if (TaskReadyAdd(task)) {
+    krnThreadWaitExit(GetThreadByQueue(host->wait_queue.next), (uint32_t)osOK, DISPATCH_YES);
+  }
+
+  return (task);
+}
+
+static const char *svcTaskGetName(osTaskId_t task_id)
+{
+  osTask_t *task = task_id;
+
+  /* Check parameters */
+  if ((task == NULL) || (task->id != ID_TASK)) {
+    return (NULL);
+  }
+
+  return (task->name);
+}
+
+static osThreadState_t svcTaskGetState(osTaskId_t task_id)
+{
+  osTask_t *task = task_id;
+
+  /* Check parameters */
+  if ((task == NULL) || (task->id != ID_TASK)) {
+    return (osThreadError);
+  }
+
+  return ((osThreadState_t)(task->state & ThreadStateMask));
+}
+
+/*******************************************************************************
+ *  Library functions
+ ******************************************************************************/
+
+/**
+ * @brief       Make a waiting task ready and wakeup its host thread.
+ * @param[in]   task      task object.
+ * @param[in]   dispatch  dispatch the host thread.
+ */
+void krnTaskReady(osTask_t *task, dispatch_t dispatch)
+{
+  osTaskHost_t *host = task->host;
+
+  if (TaskReadyAdd(task)) {
+    krnThreadWaitExit(GetThreadByQueue(host->wait_queue.next), (uint32_t)osOK, dispatch);
+  }
+}
+
+/*******************************************************************************
+ *  Public API
+ ******************************************************************************/
+
+/**
+ * @fn          osTaskHostId_t osTaskHostNew(const osTaskHostAttr_t *attr)
+ * @brief       Create and Initialize a Task Host object.
+ * @param[in]   attr    task host attributes.
+ * @return      task host ID for reference by other functions or NULL in case of error.
+ */
+osTaskHostId_t osTaskHostNew(const osTaskHostAttr_t *attr)
+{
+  osTaskHostId_t host_id;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    host_id = NULL;
+  }
+  else {
+    host_id = (osTaskHostId_t)SVC_1(attr, svcTaskHostNew);
+  }
+
+  return (host_id);
+}
+
+/**
+ * @fn          osStatus_t osTaskHostRun(osTaskHostId_t host_id)
+ * @brief       Execute ready tasks of a Task Host in the calling thread.
+ * @param[in]   host_id   task host ID obtained by \ref osTaskHostNew.
+ * @return      status code, returns only in case of an error.
+ */
+osStatus_t osTaskHostRun(osTaskHostId_t host_id)
+{
+  osStatus_t  status;
+  osTask_t   *task;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    return (osErrorISR);
+  }
+
+  for (;;) {
+    status = (osStatus_t)SVC_1(host_id, svcTaskHostSwitch);
+    if (status == osThreadWait) {
+      status = (osStatus_t)ThreadGetRunning()->winfo.ret_val;
+    }
+
+    if (status != osOK) {
+      break;
+    }
+
+    /* Continue the task until it waits, yields or ends */
+    task = ThreadGetRunning()->task;
+    if (task != NULL) {
+      task->func(task, task->argument);
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @fn          osTaskId_t osTaskNew(osTaskHostId_t host_id, osTaskFunc_t func, void *argument, const osTaskAttr_t *attr)
+ * @brief       Create a stackless task and make it ready in a Task Host.
+ * @param[in]   host_id   task host ID obtained by \ref osTaskHostNew.
+ * @param[in]   func      task function.
+ * @param[in]   argument  pointer that is passed to the task function.
+ * @param[in]   attr      task attributes.
+ * @return      task ID for reference by other functions or NULL in case of error.
+ */
+osTaskId_t osTaskNew(osTaskHostId_t host_id, osTaskFunc_t func, void *argument, const osTaskAttr_t *attr)
+{
+  osTaskId_t task_id;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    task_id = NULL;
+  }
+  else {
+    task_id = (osTaskId_t)SVC_4(host_id, func, argument, attr, svcTaskNew);
+  }
+
+  return (task_id);
+}
+
+/**
+ * @fn          const char *osTaskGetName(osTaskId_t task_id)
+ * @brief       Get name of a stackless task.
+ * @param[in]   task_id   task ID obtained by \ref osTaskNew.
+ * @return      name as null-terminated string or NULL in case of an error.
+ */
+const char *osTaskGetName(osTaskId_t task_id)
+{
+  const char *name;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    name = NULL;
+  }
+  else {
+    name = (const char *)SVC_1(task_id, svcTaskGetName);
+  }
+
+  return (name);
+}
+
+/**
+ * @fn          osThreadState_t osTaskGetState(osTaskId_t task_id)
+ * @brief       Get current state of a stackless task.
+ * @param[in]   task_id   task ID obtained by \ref osTaskNew.
+ * @return      current task state of the specified task.
+ */
+osThreadState_t osTaskGetState(osTaskId_t task_id)
+{
+  osThreadState_t state;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    state = svcTaskGetState(task_id);
+  }
+  else {
+    state = (osThreadState_t)SVC_1(task_id, svcTaskGetState);
+  }
+
+  return (state);
+}
+
+/*------------------------------ End of file ---------------------------------*/
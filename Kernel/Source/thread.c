@@ -87,6 +87,116 @@ static uint32_t ThreadFlagsCheck(osThread_t *thread, uint32_t flags, uint32_t op
   return (pattern);
 }
 
+/**
+ * @brief       Remove a run-to-completion thread from the list of active runs.
+ * @param[in]   thread  thread object.
+ */
+static void ThreadRunDetach(osThread_t *thread)
+{
+  osThread_t **link;
+
+  if (thread->run_top == 0U) {
+    return;
+  }
+
+  for (link = &osInfo.run_list; *link != NULL; link = &(*link)->run_link) {
+    if (*link == thread) {
+      *link = thread->run_link;
+      break;
+    }
+  }
+
+  thread->run_link = NULL;
+  thread->run_top  = 0U;
+}
+
+/**
+ * @brief       Insert a thread into a priority bucketed wait queue.
+ * @param[in]   buckets   priority buckets of the wait queue.
+ * @param[in]   wait_que  wait queue.
+ * @param[in]   thread    thread object.
+ */
+static void WaitBucketsInsert(wait_buckets_t *buckets, queue_t *wait_que, osThread_t *thread)
+{
+  queue_t  *que;
+  uint32_t  bucket;
+  uint32_t  mask;
+  uint32_t  higher;
+
+  bucket = (uint32_t)thread->priority - 1U;
+  mask   = 1UL << bucket;
+
+  if ((buckets->bmp & mask) != 0U) {
+    /* Append to the end of the own bucket */
+    que = buckets->tail[bucket]->next;
+    buckets->count[bucket]++;
+  }
+  else {
+    /* Start a new bucket after the lowest non-empty bucket of higher priority */
+    higher = buckets->bmp & ~((mask << 1) - 1UL);
+    if (higher != 0U) {
+      que = buckets->tail[31U - __CLZ(higher & (0U - higher))]->next;
+    }
+    else {
+      que = wait_que->next;
+    }
+    buckets->count[bucket] = 1U;
+    buckets->bmp |= mask;
+  }
+
+  QueueAppend(que, &thread->thread_que);
+  buckets->tail[bucket] = &thread->thread_que;
+
+  thread->buckets      = buckets;
+  thread->winfo.bucket = bucket;
+}
+
+/**
+ * @brief       Remove a thread from the priority buckets of its wait queue,
+ *              the caller removes it from the wait queue itself.
+ * @param[in]   thread  thread object.
+ */
+static void WaitBucketsRemove(osThread_t *thread)
+{
+  wait_buckets_t *buckets = thread->buckets;
+  uint32_t        bucket;
+
+  if (buckets == NULL) {
+    return;
+  }
+
+  bucket = thread->winfo.bucket;
+  if (--buckets->count[bucket] == 0U) {
+    buckets->bmp &= ~(1UL << bucket);
+  }
+  else if (buckets->tail[bucket] == &thread->thread_que) {
+    buckets->tail[bucket] = thread->thread_que.prev;
+  }
+
+  thread->buckets = NULL;
+}
+
+#if (defined(SHARED_STACK) && (SHARED_STACK != 0))
+
+static uint32_t svcThreadRunComplete(void);
+
+/**
+ * @brief       Entry point of a run-to-completion thread.
+ * @param[in]   argument  thread object.
+ */
+__NO_RETURN
+static void ThreadRunEntry(void *argument)
+{
+  osThread_t *thread = argument;
+
+  for (;;) {
+    thread->func(thread->argument);
+    (void)svc_0((uint32_t)svcThreadRunComplete);
+  }
+}
+
+#endif
+
 /**
  * @brief       OS Idle Thread.
  * @param[in]   argument
@@ -111,6 +221,7 @@ static osThreadId_t svcThreadNew(osThreadFunc_t func, void *argument, const osTh
   void         *stack_mem;
   uint32_t      stack_size;
   osPriority_t  priority;
+  osPriority_t  threshold;
 
   if ((func == NULL) || (attr == NULL)) {
     return (NULL);
@@ -120,6 +231,7 @@ static osThreadId_t svcThreadNew(osThreadFunc_t func, void *argument, const osTh
   stack_mem  = attr->stack_mem;
   stack_size = attr->stack_size;
   priority   = attr->priority;
+  threshold  = attr->threshold;
 
   if ((thread == NULL) || (attr->cb_size < sizeof(osThread_t))) {
     return (NULL);
@@ -140,6 +252,22 @@ static osThreadId_t svcThreadNew(osThreadFunc_t func, void *argument, const osTh
     return (NULL);
   }
 
+  if ((threshold != osPriorityNone) &&
+      ((threshold < osPriorityIdle) || (threshold > osPriorityISR))) {
+    return (NULL);
+  }
+
+  if ((attr->attr_bits & osThreadRunToCompletion) != 0U) {
+#if (defined(SHARED_STACK) && (SHARED_STACK != 0))
+    /* Direct calls keep using the thread stack below the frame of a new run */
+    if ((osConfig.flags & osConfigDirectCall) != 0U) {
+      return (NULL);
+    }
+#else
+    return (NULL);
+#endif
+  }
+
   /* Init thread control block */
   thread->exc_return    = INIT_EXC_RETURN;
   thread->stk_mem       = stack_mem;
@@ -147,22 +275,41 @@ static osThreadId_t svcThreadNew(osThreadFunc_t func, void *argument, const osTh
   thread->time_slice    = 0U;
   thread->base_priority = (int8_t)priority;
   thread->priority      = (int8_t)priority;
+  thread->threshold     = (int8_t)threshold;
+  thread->preempted     = 0U;
   thread->id            = ID_THREAD;
   thread->flags         = 0U;
   thread->attr          = attr->attr_bits;
   thread->delay         = 0U;
   thread->thread_flags  = 0U;
+  thread->task          = NULL;
+  thread->run_link      = NULL;
+  thread->run_top       = 0U;
+  thread->func          = func;
+  thread->argument      = argument;
+  thread->run_flags     = 0U;
   thread->name          = attr->name;
+  thread->post_link     = NULL;
 
   QueueReset(&thread->thread_que);
   QueueReset(&thread->delay_que);
   QueueReset(&thread->mutex_que);
-  QueueReset(&thread->post_queue);
+  thread->buckets = NULL;
+
+  if ((attr->attr_bits & osThreadRunToCompletion) != 0U) {
+    /* Stack frame is created when a run starts, the stack may be in use */
+    SchedThreadReadyAdd(thread);
+    SchedDispatch(thread);
+
+    return (thread);
+  }
 
-  /* Fill all thread stack space by FILL_STACK_VAL */
-  uint32_t *ptr = stack_mem;
-  for (uint32_t i = stack_size/sizeof(uint32_t); i != 0U; --i) {
-    *ptr++ = FILL_STACK_VALUE;
+  if ((osConfig.flags & osConfigStackWatermark) != 0U) {
+    /* Fill all thread stack space by FILL_STACK_VAL */
+    uint32_t *ptr = stack_mem;
+    for (uint32_t i = stack_size/sizeof(uint32_t); i != 0U; --i) {
+      *ptr++ = FILL_STACK_VALUE;
+    }
   }
 
   /* Init thread stack */
@@ -243,6 +390,11 @@ uint32_t svcThreadGetStackSpace(osThreadId_t thread_id)
     return (0U);
   }
 
+  /* Stack is filled only with watermark enabled */
+  if ((osConfig.flags & osConfigStackWatermark) == 0U) {
+    return (0U);
+  }
+
   stack = thread->stk_mem;
   for (; space < thread->stk_size; space += sizeof(uint32_t)) {
     if (*stack++ != FILL_STACK_VALUE) {
@@ -263,8 +415,8 @@ static osStatus_t svcThreadSetPriority(osThreadId_t thread_id, osPriority_t prio
     return (osErrorParameter);
   }
 
-  /* Check object state */
-  if (thread->state == ThreadTerminated) {
+  /* Check object state, runs on a shared stack are nested by priority */
+  if ((thread->state == ThreadTerminated) || (thread->run_top != 0U)) {
     return (osErrorResource);
   }
 
@@ -296,6 +448,54 @@ static osPriority_t svcThreadGetPriority(osThreadId_t thread_id)
   return (priority);
 }
 
+static osStatus_t svcThreadSetThreshold(osThreadId_t thread_id, osPriority_t threshold)
+{
+  osThread_t *thread = (osThread_t *)thread_id;
+
+  /* Check parameters */
+  if ((thread == NULL) || (thread->id != ID_THREAD)) {
+    return (osErrorParameter);
+  }
+
+  if ((threshold != osPriorityNone) &&
+      ((threshold < osPriorityIdle) || (threshold > osPriorityISR))) {
+    return (osErrorParameter);
+  }
+
+  /* Check object state, runs on a shared stack are nested by priority */
+  if ((thread->state == ThreadTerminated) || (thread->run_top != 0U)) {
+    return (osErrorResource);
+  }
+
+  if (thread->threshold > (int8_t)threshold) {
+    thread->threshold = (int8_t)threshold;
+    /* Lowered threshold may allow preemption of the running or a preempted thread */
+    SchedDispatch(NULL);
+  }
+  else {
+    thread->threshold = (int8_t)threshold;
+  }
+
+  return (osOK);
+}
+
+static osPriority_t svcThreadGetThreshold(osThreadId_t thread_id)
+{
+  osThread_t *thread = (osThread_t *)thread_id;
+
+  /* Check parameters */
+  if ((thread == NULL) || (thread->id != ID_THREAD)) {
+    return (osPriorityError);
+  }
+
+  /* Check object state */
+  if (thread->state == ThreadTerminated) {
+    return (osPriorityError);
+  }
+
+  return ((osPriority_t)thread->threshold);
+}
+
 static osStatus_t svcThreadYield(void)
 {
   if (osInfo.kernel.state == osKernelRunning) {
@@ -317,6 +517,12 @@ osStatus_t svcThreadSuspend(osThreadId_t thread_id)
     return (osErrorParameter);
   }
 
+  /* Run-to-completion thread keeps its stack frame until the run ends,
+     a Thread Pool keeps count of its idle workers */
+  if ((thread->run_top != 0U) || ((thread->flags & FLAGS_POOL_WORKER) != 0U)) {
+    return (osErrorResource);
+  }
+
   switch (thread->state & ThreadStateMask) {
     case ThreadRunning:
       if (osInfo.kernel.state != osKernelRunning ||
@@ -337,6 +543,7 @@ osStatus_t svcThreadSuspend(osThreadId_t thread_id)
       /* Remove the thread from delay queue */
       QueueRemoveEntry(&thread->delay_que);
       /* Remove the thread from wait queue */
+      WaitBucketsRemove(thread);
       QueueRemoveEntry(&thread->thread_que);
       break;
 
@@ -359,8 +566,9 @@ static osStatus_t svcThreadResume(osThreadId_t thread_id)
     return (osErrorParameter);
   }
 
-  /* Check object state */
-  if ((thread->state & ThreadStateMask) != ThreadBlocked) {
+  /* Check object state, a Thread Pool keeps count of its idle workers */
+  if (((thread->state & ThreadStateMask) != ThreadBlocked) ||
+      ((thread->flags & FLAGS_POOL_WORKER) != 0U)) {
     return (osErrorResource);
   }
 
@@ -391,6 +599,9 @@ static void svcThreadExit(void)
   thread->id = ID_INVALID;
 
   SchedDispatch(NULL);
+
+  /* Registers are still saved on the stack, so a new run starts below them */
+  ThreadRunDetach(thread);
 }
 
 static osStatus_t svcThreadTerminate(osThreadId_t thread_id)
@@ -403,6 +614,11 @@ static osStatus_t svcThreadTerminate(osThreadId_t thread_id)
     return (osErrorParameter);
   }
 
+  /* Workers belong to their Thread Pool */
+  if ((thread->flags & FLAGS_POOL_WORKER) != 0U) {
+    return (osErrorResource);
+  }
+
   /* Check object state */
   switch (thread->state & ThreadStateMask) {
     case ThreadRunning:
@@ -423,6 +639,7 @@ static osStatus_t svcThreadTerminate(osThreadId_t thread_id)
       /* Remove the thread from delay queue */
       QueueRemoveEntry(&thread->delay_que);
       /* Remove the thread from wait queue */
+      WaitBucketsRemove(thread);
       QueueRemoveEntry(&thread->thread_que);
       break;
 
@@ -440,6 +657,9 @@ static osStatus_t svcThreadTerminate(osThreadId_t thread_id)
     thread->id = ID_INVALID;
 
     SchedDispatch(NULL);
+
+    /* Registers are still saved on the stack, so a new run starts below them */
+    ThreadRunDetach(thread);
   }
 
   return (status);
@@ -528,7 +748,7 @@ static uint32_t svcThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t ti
   /* Check Thread Flags */
   thread_flags = ThreadFlagsCheck(thread, flags, options);
   if (thread_flags == 0U) {
-    if (timeout != 0U) {
+    if ((timeout != 0U) && (thread->task == NULL)) {
       thread_flags = (uint32_t)krnThreadWaitEnter(ThreadWaitingThreadFlags, NULL, timeout);
       if (thread_flags != (uint32_t)osErrorTimeout) {
         winfo          = &thread->winfo.thread;
@@ -544,6 +764,46 @@ static uint32_t svcThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t ti
   return (thread_flags);
 }
 
+#if (defined(SHARED_STACK) && (SHARED_STACK != 0))
+
+/**
+ * @brief       Finish a run of the running run-to-completion thread.
+ * @return      stacked R0 value, the SVC handler stores it back into a stack
+ *              frame that may already belong to the next run.
+ */
+static uint32_t svcThreadRunComplete(void)
+{
+  osThread_t    *thread;
+  winfo_flags_t *winfo;
+
+  thread = ThreadGetRunning();
+
+  /* Flags pending at the start of the run are consumed */
+  BEGIN_CRITICAL_SECTION
+
+  thread->thread_flags &= ~thread->run_flags;
+
+  END_CRITICAL_SECTION
+
+  /* Run again while Thread Flags are pending */
+  if (thread->thread_flags == 0U) {
+    ThreadRunDetach(thread);
+
+    /* Block at the entry point until any Thread Flag is set */
+    (void)krnThreadWaitEnter(ThreadWaitingThreadFlags, NULL, osWaitForever);
+    winfo          = &thread->winfo.thread;
+    winfo->options = osFlagsWaitAny | osFlagsNoClear;
+    winfo->flags   = osThreadFlagsMask;
+
+    /* Stack frame is discarded, registers need not be saved */
+    osInfo.thread.run.curr = NULL;
+  }
+
+  return (*(uint32_t *)ThreadStackGet());
+}
+
+#endif
+
 /*******************************************************************************
  *  ISR Calls
  ******************************************************************************/
@@ -554,6 +814,11 @@ uint32_t isrThreadFlagsSet(osThreadId_t thread_id, uint32_t flags)
   osThread_t *thread = thread_id;
   uint32_t    thread_flags;
 
+  /* Check interrupt priority */
+  if (!IsrCallAllowed()) {
+    return (osFlagsErrorISR);
+  }
+
   /* Check parameters */
   if (thread == NULL || thread->id != ID_THREAD) {
     return (osFlagsErrorParameter);
@@ -632,6 +897,31 @@ bool krnThreadStartup(void)
   return (ret);
 }
 
+/**
+ * @brief       Create a thread from kernel context.
+ * @param[in]   func      thread function.
+ * @param[in]   argument  pointer that is passed to the thread function as start argument.
+ * @param[in]   attr      thread attributes.
+ * @return      thread ID or NULL in case of error.
+ */
+osThreadId_t krnThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr)
+{
+  return (svcThreadNew(func, argument, attr));
+}
+
+/**
+ * @brief       Terminate a thread from kernel context.
+ * @param[in]   thread    thread object.
+ * @return      status code that indicates the execution status of the function.
+ */
+osStatus_t krnThreadTerminate(osThread_t *thread)
+{
+  /* Kernel services terminate the workers they own */
+  krnObjectFlagsClear((osObject_t *)&thread->id, FLAGS_POOL_WORKER);
+
+  return (svcThreadTerminate(thread));
+}
+
 /**
  * @brief       Exit Thread wait state.
  * @param[out]  thread    thread object.
@@ -641,8 +931,18 @@ void krnThreadWaitExit(osThread_t *thread, uint32_t ret_val, dispatch_t dispatch
 {
   thread->winfo.ret_val = ret_val;
 
+  /* Wait queue entry is removed below, keep the priority buckets consistent */
+  WaitBucketsRemove(thread);
+
   /* Remove the thread from delay queue */
   QueueRemoveEntry(&thread->delay_que);
+
+  if (thread->id == ID_TASK) {
+    /* Stackless task continues in its host thread */
+    krnTaskReady((osTask_t *)(void *)thread, dispatch);
+    return;
+  }
+
   SchedThreadReadyAdd(thread);
   if (dispatch != DISPATCH_NO) {
     SchedDispatch(thread);
@@ -656,6 +956,18 @@ void krnThreadWaitExit(osThread_t *thread, uint32_t ret_val, dispatch_t dispatch
  * @param[in]   timeout   Timeout
  */
 osStatus_t krnThreadWaitEnter(uint8_t state, queue_t *wait_que, uint32_t timeout)
+{
+  return (krnThreadWaitEnterBuckets(state, wait_que, NULL, timeout));
+}
+
+/**
+ * @brief       Enter Thread wait state with an optionally bucketed wait queue.
+ * @param[in]   state     New thread state.
+ * @param[out]  wait_que  Pointer to wait queue.
+ * @param[in]   buckets   Priority buckets of the wait queue or NULL.
+ * @param[in]   timeout   Timeout
+ */
+osStatus_t krnThreadWaitEnterBuckets(uint8_t state, queue_t *wait_que, wait_buckets_t *buckets, uint32_t timeout)
 {
   queue_t    *que;
   queue_t    *delay_queue;
@@ -665,11 +977,25 @@ osStatus_t krnThreadWaitEnter(uint8_t state, queue_t *wait_que, uint32_t timeout
     return (osErrorTimeout);
   }
 
-  thread = ThreadGetRunning();
-  SchedThreadReadyDel(thread, state);
+  thread = ThreadGetWaiter();
+  if (thread->id == ID_TASK) {
+    /* Host thread keeps running, the task returns to it */
+    ((osTask_t *)(void *)thread)->waiting = 1U;
+    thread->state = state;
+  }
+  else if (thread->run_top != 0U) {
+    /* Run-to-completion thread may block only at its entry point */
+    return (osErrorResource);
+  }
+  else {
+    SchedThreadReadyDel(thread, state);
+  }
 
   /* Add to the wait queue */
-  if (wait_que != NULL) {
+  if (buckets != NULL) {
+    WaitBucketsInsert(buckets, wait_que, thread);
+  }
+  else if (wait_que != NULL) {
     for (que = wait_que->next; que != wait_que; que = que->next) {
       if (thread->priority > GetThreadByQueue(que)->priority) {
         break;
@@ -729,6 +1055,52 @@ void krnThreadSetPriority(osThread_t *thread, int8_t priority)
   }
 }
 
+#if (defined(SHARED_STACK) && (SHARED_STACK != 0))
+
+/**
+ * @brief       Start a new run of a run-to-completion thread on its shared stack.
+ * @param[in]   thread    thread object.
+ */
+void krnThreadRunStart(osThread_t *thread)
+{
+  osThread_t *member;
+  uint32_t    top;
+
+  top = (uint32_t)thread->stk_mem + thread->stk_size;
+
+  /* Runs are nested, start below the innermost run on the same stack */
+  for (member = osInfo.run_list; member != NULL; member = member->run_link) {
+    if (member->stk_mem == thread->stk_mem) {
+      if (member == ThreadGetRunning()) {
+        /* Registers of the running thread are saved below its stack pointer */
+        top = (ThreadStackGet() - CONTEXT_SAVE_SIZE) & ~7U;
+      }
+      else {
+        top = member->stk & ~7U;
+      }
+      break;
+    }
+  }
+
+  StackAttr_t stack_attr = {
+      .func_addr  = (uint32_t)ThreadRunEntry,
+      .func_param = (uint32_t)thread,
+      .func_exit  = (uint32_t)osThreadExit,
+      .stk_mem    = (uint32_t)thread->stk_mem,
+      .stk_size   = top - (uint32_t)thread->stk_mem,
+  };
+  thread->exc_return = INIT_EXC_RETURN;
+  thread->stk = StackInit(&stack_attr,
+                          (osConfig.flags & osConfigPrivilegedMode) != 0U);
+
+  thread->run_top   = top;
+  thread->run_flags = thread->thread_flags;
+  thread->run_link  = osInfo.run_list;
+  osInfo.run_list   = thread;
+}
+
+#endif
+
 /*******************************************************************************
  *  Public API
  ******************************************************************************/
@@ -895,6 +1267,47 @@ osPriority_t osThreadGetPriority(osThreadId_t thread_id)
   return (priority);
 }
 
+/**
+ * @fn          osStatus_t osThreadSetThreshold(osThreadId_t thread_id, osPriority_t threshold)
+ * @brief       Change preemption threshold of a thread.
+ * @param[in]   thread_id   thread ID obtained by \ref osThreadNew or \ref osThreadGetId.
+ * @param[in]   threshold   new preemption threshold (osPriorityNone - disabled).
+ * @return      status code that indicates the execution status of the function.
+ */
+osStatus_t osThreadSetThreshold(osThreadId_t thread_id, osPriority_t threshold)
+{
+  osStatus_t status;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    status = osErrorISR;
+  }
+  else {
+    status = (osStatus_t)SVC_2(thread_id, threshold, svcThreadSetThreshold);
+  }
+
+  return (status);
+}
+
+/**
+ * @fn          osPriority_t osThreadGetThreshold(osThreadId_t thread_id)
+ * @brief       Get preemption threshold of a thread.
+ * @param[in]   thread_id   thread ID obtained by \ref osThreadNew or \ref osThreadGetId.
+ * @return      preemption threshold of the specified thread (osPriorityNone - disabled).
+ */
+osPriority_t osThreadGetThreshold(osThreadId_t thread_id)
+{
+  osPriority_t threshold;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    threshold = osPriorityError;
+  }
+  else {
+    threshold = (osPriority_t)SVC_1(thread_id, svcThreadGetThreshold);
+  }
+
+  return (threshold);
+}
+
 /**
  * @fn          osStatus_t osThreadYield(void)
  * @brief       Pass control to next thread that is in state READY.
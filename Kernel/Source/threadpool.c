@@ -0,0 +1,332 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: mbOS real-time kernel
+ */
+
+/**
+ * @file
+ *
+ * Kernel system routines.
+ *
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include "kernel_lib.h"
+
+/*******************************************************************************
+ *  function prototypes (scope: module-local)
+ ******************************************************************************/
+
+static osStatus_t svcThreadPoolWait(osThreadPoolId_t pool_id);
+
+/*******************************************************************************
+ *  Helper functions
+ ******************************************************************************/
+
+/**
+ * @brief       Worker thread of a Thread Pool.
+ * @param[in]   argument  thread pool object.
+ */
+__NO_RETURN
+static void ThreadPoolWorker(void *argument)
+{
+  osThreadPool_t *pool = argument;
+  osThread_t     *thread;
+  osThreadFunc_t  func;
+  osStatus_t      status;
+
+  for (;;) {
+    /* Wait for a function to execute */
+    status = (osStatus_t)SVC_1(pool, svcThreadPoolWait);
+    if (status == osThreadWait) {
+      status = (osStatus_t)ThreadGetRunning()->winfo.ret_val;
+    }
+
+    if (status == osOK) {
+      thread = ThreadGetRunning();
+      func   = (osThreadFunc_t)thread->winfo.pool.func;
+      func((void *)thread->winfo.pool.argument);
+    }
+  }
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+static osThreadPoolId_t svcThreadPoolNew(uint32_t thread_count, uint32_t stack_size, const osThreadPoolAttr_t *attr)
+{
+  osThreadPool_t *pool;
+  osThread_t     *thread_mem;
+  uint8_t        *stack_mem;
+  osPriority_t    priority;
+  osThreadAttr_t  thread_attr;
+
+  /* Check parameters */
+  if ((thread_count == 0U) || (attr == NULL) ||
+      (stack_size < MIN_THREAD_STK_SIZE) || ((stack_size & 7U) != 0U) ||
+      (__CLZ(thread_count) + __CLZ(stack_size)) < 32U) {
+    return (NULL);
+  }
+
+  pool       = attr->cb_mem;
+  thread_mem = attr->thread_mem;
+  stack_mem  = attr->stack_mem;
+  priority   = attr->priority;
+
+  /* Check parameters */
+  if ((pool == NULL) || (((uint32_t)pool & 3U) != 0U) ||
+      (attr->cb_size < sizeof(osThreadPool_t))         ||
+      (thread_mem == NULL) || (((uint32_t)thread_mem & 3U) != 0U) ||
+      (attr->thread_size < (thread_count * sizeof(osThread_t))) ||
+      (stack_mem == NULL) || (((uint32_t)stack_mem & 7U) != 0U) ||
+      (attr->stack_size < (thread_count * stack_size))) {
+    return (NULL);
+  }
+
+  if (priority == osPriorityNone) {
+    priority = osPriorityNormal;
+  }
+  else if ((priority < osPriorityIdle) || (priority > osPriorityISR)) {
+    return (NULL);
+  }
+
+  /* Initialize control block */
+  pool->id           = ID_THREAD_POOL;
+  pool->flags        = 0U;
+  pool->name         = attr->name;
+  pool->thread_count = thread_count;
+  pool->idle_count   = 0U;
+
+  QueueReset(&pool->idle_queue);
+  QueueReset(&pool->wait_queue);
+  pool->post_link = NULL;
+
+  /* Create worker threads, they become idle on the first run */
+  thread_attr.name      = attr->name;
+  thread_attr.attr_bits = osThreadDetached;
+  thread_attr.cb_size   = sizeof(osThread_t);
+  thread_attr.priority  = priority;
+  thread_attr.threshold = osPriorityNone;
+
+  for (uint32_t i = 0U; i < thread_count; i++) {
+    thread_attr.cb_mem     = &thread_mem[i];
+    thread_attr.stack_mem  = &stack_mem[i * stack_size];
+    thread_attr.stack_size = stack_size;
+    if (krnThreadNew(ThreadPoolWorker, pool, &thread_attr) == NULL) {
+      /* Workers created so far have not run yet */
+      while (i != 0U) {
+        i--;
+        (void)krnThreadTerminate(&thread_mem[i]);
+      }
+      pool->id = ID_INVALID;
+      return (NULL);
+    }
+    krnObjectFlagsSet((osObject_t *)&thread_mem[i].id, FLAGS_POOL_WORKER);
+  }
+
+  return (pool);
+}
+
+static const char *svcThreadPoolGetName(osThreadPoolId_t pool_id)
+{
+  osThreadPool_t *pool = pool_id;
+
+  /* Check parameters */
+  if ((pool == NULL) || (pool->id != ID_THREAD_POOL)) {
+    return (NULL);
+  }
+
+  return (pool->name);
+}
+
+static osStatus_t svcThreadPoolDispatch(osThreadPoolId_t pool_id, osThreadFunc_t func, void *argument, uint32_t timeout)
+{
+  osThreadPool_t *pool = pool_id;
+  osThread_t     *thread;
+  winfo_pool_t   *winfo;
+  osStatus_t      status;
+
+  /* Check parameters */
+  if ((pool == NULL) || (pool->id != ID_THREAD_POOL) || (func == NULL)) {
+    return (osErrorParameter);
+  }
+
+  /* Check if a worker Thread is idle */
+  if (!isQueueEmpty(&pool->idle_queue)) {
+    thread = GetThreadByQueue(pool->idle_queue.next);
+    pool->idle_count--;
+
+    /* Pass the function and wakeup the worker Thread */
+    winfo           = &thread->winfo.pool;
+    winfo->func     = (uint32_t)func;
+    winfo->argument = (uint32_t)argument;
+    krnThreadWaitExit(thread, (uint32_t)osOK, DISPATCH_YES);
+    status = osOK;
+  }
+  else if (timeout != 0U) {
+    /* All workers are busy, wait for an idle one */
+    status = krnThreadWaitEnter(ThreadWaitingThreadPool, &pool->wait_queue, timeout);
+    if (status != osErrorTimeout) {
+      winfo           = &ThreadGetWaiter()->winfo.pool;
+      winfo->func     = (uint32_t)func;
+      winfo->argument = (uint32_t)argument;
+    }
+  }
+  else {
+    status = osErrorResource;
+  }
+
+  return (status);
+}
+
+static uint32_t svcThreadPoolGetIdleCount(osThreadPoolId_t pool_id)
+{
+  osThreadPool_t *pool = pool_id;
+
+  /* Check parameters */
+  if ((pool == NULL) || (pool->id != ID_THREAD_POOL)) {
+    return (0U);
+  }
+
+  return (pool->idle_count);
+}
+
+/**
+ * @brief       Return the running worker Thread to the pool.
+ * @param[in]   pool_id   thread pool object.
+ * @return      osOK when a function to execute was received.
+ */
+static osStatus_t svcThreadPoolWait(osThreadPoolId_t pool_id)
+{
+  osThreadPool_t *pool = pool_id;
+  osThread_t     *thread;
+  osStatus_t      status;
+
+  /* Check if a Thread is waiting for an idle worker */
+  if (!isQueueEmpty(&pool->wait_queue)) {
+    thread = GetThreadByQueue(pool->wait_queue.next);
+
+    /* Take over the function and wakeup the waiting Thread */
+    ThreadGetRunning()->winfo.pool = thread->winfo.pool;
+    krnThreadWaitExit(thread, (uint32_t)osOK, DISPATCH_YES);
+    status = osOK;
+  }
+  else {
+    pool->idle_count++;
+    status = krnThreadWaitEnter(ThreadWaitingThreadPool, &pool->idle_queue, osWaitForever);
+  }
+
+  return (status);
+}
+
+/*******************************************************************************
+ *  Public API
+ ******************************************************************************/
+
+/**
+ * @fn          osThreadPoolId_t osThreadPoolNew(uint32_t thread_count, uint32_t stack_size, const osThreadPoolAttr_t *attr)
+ * @brief       Create a Thread Pool and start its worker threads.
+ * @param[in]   thread_count  number of worker threads.
+ * @param[in]   stack_size    stack size of each worker thread in bytes.
+ * @param[in]   attr          thread pool attributes.
+ * @return      thread pool ID for reference by other functions or NULL in case of error.
+ */
+osThreadPoolId_t osThreadPoolNew(uint32_t thread_count, uint32_t stack_size, const osThreadPoolAttr_t *attr)
+{
+  osThreadPoolId_t pool_id;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    pool_id = NULL;
+  }
+  else {
+    pool_id = (osThreadPoolId_t)SVC_3(thread_count, stack_size, attr, svcThreadPoolNew);
+  }
+
+  return (pool_id);
+}
+
+/**
+ * @fn          const char *osThreadPoolGetName(osThreadPoolId_t pool_id)
+ * @brief       Get name of a Thread Pool object.
+ * @param[in]   pool_id   thread pool ID obtained by \ref osThreadPoolNew.
+ * @return      name as null-terminated string or NULL in case of an error.
+ */
+const char *osThreadPoolGetName(osThreadPoolId_t pool_id)
+{
+  const char *name;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    name = NULL;
+  }
+  else {
+    name = (const char *)SVC_1(pool_id, svcThreadPoolGetName);
+  }
+
+  return (name);
+}
+
+/**
+ * @fn          osStatus_t osThreadPoolDispatch(osThreadPoolId_t pool_id, osThreadFunc_t func, void *argument, uint32_t timeout)
+ * @brief       Run a function on an idle worker thread or timeout if all workers are busy.
+ * @param[in]   pool_id   thread pool ID obtained by \ref osThreadPoolNew.
+ * @param[in]   func      function executed by the worker thread.
+ * @param[in]   argument  pointer that is passed to the function.
+ * @param[in]   timeout   \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+ * @return      status code that indicates the execution status of the function.
+ */
+osStatus_t osThreadPoolDispatch(osThreadPoolId_t pool_id, osThreadFunc_t func, void *argument, uint32_t timeout)
+{
+  osStatus_t status;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    status = osErrorISR;
+  }
+  else {
+    status = (osStatus_t)SVC_4(pool_id, func, argument, timeout, svcThreadPoolDispatch);
+    if (status == osThreadWait) {
+      status = (osStatus_t)ThreadGetRunning()->winfo.ret_val;
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @fn          uint32_t osThreadPoolGetIdleCount(osThreadPoolId_t pool_id)
+ * @brief       Get number of idle worker threads in a Thread Pool.
+ * @param[in]   pool_id   thread pool ID obtained by \ref osThreadPoolNew.
+ * @return      number of idle worker threads or 0 in case of an error.
+ */
+uint32_t osThreadPoolGetIdleCount(osThreadPoolId_t pool_id)
+{
+  uint32_t count;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    count = svcThreadPoolGetIdleCount(pool_id);
+  }
+  else {
+    count = SVC_1(pool_id, svcThreadPoolGetIdleCount);
+  }
+
+  return (count);
+}
+
+/*------------------------------ End of file ---------------------------------*/
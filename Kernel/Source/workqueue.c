@@ -0,0 +1,442 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: mbOS real-time kernel
+ */
+
+/**
+ * @file
+ *
+ * Kernel system routines.
+ *
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include "kernel_lib.h"
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#define WorkIdle              0x00U   ///< Work item is not submitted
+#define WorkPending           0x01U   ///< Work item waits for the worker thread
+#define WorkDelayed           0x02U   ///< Work item waits for its delay to expire
+
+/*******************************************************************************
+ *  function prototypes (scope: module-local)
+ ******************************************************************************/
+
+static osStatus_t svcWorkQueueWait(osWorkQueueId_t wq_id);
+
+/*******************************************************************************
+ *  Helper functions
+ ******************************************************************************/
+
+/**
+ * @brief       Worker thread of a Work Queue.
+ * @param[in]   argument  work queue object.
+ */
+__NO_RETURN
+static void WorkQueueWorker(void *argument)
+{
+  osWorkQueue_t  *wq = argument;
+  osThread_t     *thread;
+  osThreadFunc_t  func;
+
+  for (;;) {
+    /* Wait for a work item to run */
+    if ((osStatus_t)SVC_1(wq, svcWorkQueueWait) == osOK) {
+      thread = ThreadGetRunning();
+      func   = (osThreadFunc_t)thread->winfo.pool.func;
+      func((void *)thread->winfo.pool.argument);
+    }
+  }
+}
+
+/**
+ * @brief       Add a work item to its Work Queue.
+ * @param[in]   work      work item object.
+ * @param[in]   delay     delay in ticks or 0.
+ * @param[in]   dispatch  dispatch the worker thread.
+ */
+static void WorkQueueAdd(osWork_t *work, uint32_t delay, dispatch_t dispatch)
+{
+  osWorkQueue_t *wq = work->wq;
+  queue_t       *que;
+
+  /* Merge with the pending submission */
+  if (work->state != WorkIdle) {
+    return;
+  }
+
+  if (delay == 0U) {
+    work->state = WorkPending;
+    QueueAppend(&wq->work_queue, &work->work_que);
+  }
+  else {
+    work->state = WorkDelayed;
+    work->time  = osInfo.kernel.tick + delay;
+    for (que = wq->delay_queue.next; que != &wq->delay_queue; que = que->next) {
+      if (time_before(work->time, GetWorkByQueue(que)->time)) {
+        break;
+      }
+    }
+    QueueAppend(que, &work->work_que);
+  }
+
+  /* Wakeup the worker thread to run the item or to restart its delay */
+  if (!isQueueEmpty(&wq->wait_queue)) {
+    krnThreadWaitExit(GetThreadByQueue(wq->wait_queue.next), (uint32_t)osOK, dispatch);
+  }
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+static osWorkQueueId_t svcWorkQueueNew(const osWorkQueueAttr_t *attr)
+{
+  osWorkQueue_t  *wq;
+  osPriority_t    priority;
+  osThreadAttr_t  thread_attr;
+
+  /* Check parameters */
+  if ((attr == NULL)                                  ||
+      (attr->cb_mem == NULL)                          ||
+      (((uint32_t)attr->cb_mem & 3U) != 0U)           ||
+      (attr->cb_size < sizeof(osWorkQueue_t))         ||
+      (attr->thread_mem == NULL)                      ||
+      (((uint32_t)attr->thread_mem & 3U) != 0U)       ||
+      (attr->thread_size < sizeof(osThread_t)))
+  {
+    return (NULL);
+  }
+
+  priority = attr->priority;
+  if (priority == osPriorityNone) {
+    priority = osPriorityNormal;
+  }
+  else if ((priority < osPriorityIdle) || (priority > osPriorityISR)) {
+    return (NULL);
+  }
+
+  wq = attr->cb_mem;
+
+  /* Initialize control block */
+  wq->id    = ID_WORK_QUEUE;
+  wq->flags = 0U;
+  wq->name  = attr->name;
+
+  QueueReset(&wq->work_queue);
+  QueueReset(&wq->delay_queue);
+  QueueReset(&wq->wait_queue);
+  wq->post_link = NULL;
+
+  /* Create worker thread */
+  thread_attr.name       = attr->name;
+  thread_attr.attr_bits  = osThreadDetached;
+  thread_attr.cb_mem     = attr->thread_mem;
+  thread_attr.cb_size    = attr->thread_size;
+  thread_attr.stack_mem  = attr->stack_mem;
+  thread_attr.stack_size = attr->stack_size;
+  thread_attr.priority   = priority;
+  thread_attr.threshold  = osPriorityNone;
+
+  if (krnThreadNew(WorkQueueWorker, wq, &thread_attr) == NULL) {
+    wq->id = ID_INVALID;
+    return (NULL);
+  }
+
+  return (wq);
+}
+
+static const char *svcWorkQueueGetName(osWorkQueueId_t wq_id)
+{
+  osWorkQueue_t *wq = wq_id;
+
+  /* Check parameters */
+  if ((wq == NULL) || (wq->id != ID_WORK_QUEUE)) {
+    return (NULL);
+  }
+
+  return (wq->name);
+}
+
+/**
+ * @brief       Take the next work item for the running worker thread.
+ * @param[in]   wq_id   work queue object.
+ * @return      osOK when a work item was taken, osThreadWait otherwise.
+ */
+static osStatus_t svcWorkQueueWait(osWorkQueueId_t wq_id)
+{
+  osWorkQueue_t *wq = wq_id;
+  osWork_t      *work;
+  winfo_pool_t  *winfo;
+  uint32_t       timeout;
+
+  /* Move expired delayed work items */
+  while (!isQueueEmpty(&wq->delay_queue)) {
+    work = GetWorkByQueue(wq->delay_queue.next);
+    if (time_after(work->time, osInfo.kernel.tick)) {
+      break;
+    }
+    QueueRemoveEntry(&work->work_que);
+    work->state = WorkPending;
+    QueueAppend(&wq->work_queue, &work->work_que);
+  }
+
+  if (!isQueueEmpty(&wq->work_queue)) {
+    work = GetWorkByQueue(QueueExtract(&wq->work_queue));
+
+    /* Work item may be submitted again while it runs */
+    work->state     = WorkIdle;
+    winfo           = &ThreadGetRunning()->winfo.pool;
+    winfo->func     = (uint32_t)work->func;
+    winfo->argument = (uint32_t)work->argument;
+
+    return (osOK);
+  }
+
+  /* Wait for a submission or for the first delayed work item */
+  timeout = osWaitForever;
+  if (!isQueueEmpty(&wq->delay_queue)) {
+    timeout = GetWorkByQueue(wq->delay_queue.next)->time - osInfo.kernel.tick;
+  }
+
+  return (krnThreadWaitEnter(ThreadWaitingWorkQueue, &wq->wait_queue, timeout));
+}
+
+static osWorkId_t svcWorkNew(osWorkQueueId_t wq_id, osThreadFunc_t func, void *argument, const osWorkAttr_t *attr)
+{
+  osWorkQueue_t *wq = wq_id;
+  osWork_t      *work;
+
+  /* Check parameters */
+  if ((wq == NULL) || (wq->id != ID_WORK_QUEUE) || (func == NULL) ||
+      (attr == NULL)                                              ||
+      (attr->cb_mem == NULL)                                      ||
+      (((uint32_t)attr->cb_mem & 3U) != 0U)                       ||
+      (attr->cb_size < sizeof(osWork_t)))
+  {
+    return (NULL);
+  }
+
+  work = attr->cb_mem;
+
+  /* Initialize control block */
+  work->id        = ID_WORK;
+  work->state     = WorkIdle;
+  work->flags     = 0U;
+  work->delay     = 0U;
+  work->time      = 0U;
+  work->func      = func;
+  work->argument  = argument;
+  work->wq        = wq;
+  work->name      = attr->name;
+  work->post_link = NULL;
+
+  QueueReset(&work->work_que);
+
+  return (work);
+}
+
+static osStatus_t svcWorkSubmit(osWorkId_t work_id, uint32_t delay)
+{
+  osWork_t *work = work_id;
+
+  /* Check parameters */
+  if ((work == NULL) || (work->id != ID_WORK)) {
+    return (osErrorParameter);
+  }
+
+  WorkQueueAdd(work, delay, DISPATCH_YES);
+
+  return (osOK);
+}
+
+static osStatus_t svcWorkCancel(osWorkId_t work_id)
+{
+  osWork_t *work = work_id;
+
+  /* Check parameters */
+  if ((work == NULL) || (work->id != ID_WORK)) {
+    return (osErrorParameter);
+  }
+
+  /* Check object state */
+  if (work->state == WorkIdle) {
+    return (osErrorResource);
+  }
+
+  QueueRemoveEntry(&work->work_que);
+  work->state = WorkIdle;
+
+  return (osOK);
+}
+
+/*******************************************************************************
+ *  ISR Calls
+ ******************************************************************************/
+
+__STATIC_INLINE
+osStatus_t isrWorkSubmit(osWorkId_t work_id, uint32_t delay)
+{
+  osWork_t *work = work_id;
+
+  /* Check interrupt priority */
+  if (!IsrCallAllowed()) {
+    return (osErrorISR);
+  }
+
+  /* Check parameters */
+  if ((work == NULL) || (work->id != ID_WORK)) {
+    return (osErrorParameter);
+  }
+
+  /* Register post ISR processing, a posted item is merged */
+  work->delay = delay;
+  krnPostProcess((osObject_t *)work);
+
+  return (osOK);
+}
+
+/*******************************************************************************
+ *  Post ISR processing
+ ******************************************************************************/
+
+/**
+ * @fn          void krnWorkPostProcess(osWork_t*)
+ * @brief       Work item post ISR processing.
+ * @param[in]   work  work item object.
+ */
+void krnWorkPostProcess(osWork_t *work)
+{
+  WorkQueueAdd(work, work->delay, DISPATCH_NO);
+}
+
+/*******************************************************************************
+ *  Public API
+ ******************************************************************************/
+
+/**
+ * @fn          osWorkQueueId_t osWorkQueueNew(const osWorkQueueAttr_t *attr)
+ * @brief       Create a Work Queue and start its worker thread.
+ * @param[in]   attr    work queue attributes.
+ * @return      work queue ID for reference by other functions or NULL in case of error.
+ */
+osWorkQueueId_t osWorkQueueNew(const osWorkQueueAttr_t *attr)
+{
+  osWorkQueueId_t wq_id;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    wq_id = NULL;
+  }
+  else {
+    wq_id = (osWorkQueueId_t)SVC_1(attr, svcWorkQueueNew);
+  }
+
+  return (wq_id);
+}
+
+/**
+ * @fn          const char *osWorkQueueGetName(osWorkQueueId_t wq_id)
+ * @brief       Get name of a Work Queue object.
+ * @param[in]   wq_id   work queue ID obtained by \ref osWorkQueueNew.
+ * @return      name as null-terminated string or NULL in case of an error.
+ */
+const char *osWorkQueueGetName(osWorkQueueId_t wq_id)
+{
+  const char *name;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    name = NULL;
+  }
+  else {
+    name = (const char *)SVC_1(wq_id, svcWorkQueueGetName);
+  }
+
+  return (name);
+}
+
+/**
+ * @fn          osWorkId_t osWorkNew(osWorkQueueId_t wq_id, osThreadFunc_t func, void *argument, const osWorkAttr_t *attr)
+ * @brief       Create a Work item bound to a Work Queue.
+ * @param[in]   wq_id     work queue ID obtained by \ref osWorkQueueNew.
+ * @param[in]   func      function executed by the worker thread.
+ * @param[in]   argument  pointer that is passed to the function.
+ * @param[in]   attr      work item attributes.
+ * @return      work item ID for reference by other functions or NULL in case of error.
+ */
+osWorkId_t osWorkNew(osWorkQueueId_t wq_id, osThreadFunc_t func, void *argument, const osWorkAttr_t *attr)
+{
+  osWorkId_t work_id;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    work_id = NULL;
+  }
+  else {
+    work_id = (osWorkId_t)SVC_4(wq_id, func, argument, attr, svcWorkNew);
+  }
+
+  return (work_id);
+}
+
+/**
+ * @fn          osStatus_t osWorkSubmit(osWorkId_t work_id, uint32_t delay)
+ * @brief       Submit a Work item, a submission of a pending item is merged with it.
+ * @param[in]   work_id   work item ID obtained by \ref osWorkNew.
+ * @param[in]   delay     delay in ticks before the item runs or 0 to run it at once.
+ * @return      status code that indicates the execution status of the function.
+ * @note        Can be called from Interrupt Service Routines.
+ */
+osStatus_t osWorkSubmit(osWorkId_t work_id, uint32_t delay)
+{
+  osStatus_t status;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    status = isrWorkSubmit(work_id, delay);
+  }
+  else {
+    status = (osStatus_t)SVC_2(work_id, delay, svcWorkSubmit);
+  }
+
+  return (status);
+}
+
+/**
+ * @fn          osStatus_t osWorkCancel(osWorkId_t work_id)
+ * @brief       Remove a pending Work item from its Work Queue.
+ * @param[in]   work_id   work item ID obtained by \ref osWorkNew.
+ * @return      status code that indicates the execution status of the function.
+ */
+osStatus_t osWorkCancel(osWorkId_t work_id)
+{
+  osStatus_t status;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    status = osErrorISR;
+  }
+  else {
+    status = (osStatus_t)SVC_1(work_id, svcWorkCancel);
+  }
+
+  return (status);
+}
+
+/*------------------------------ End of file ---------------------------------*/
@@ -27,15 +27,16 @@
  *  defines and macros (scope: module-local)
  ******************************************************************************/
 
-#define I2C_EVENT_ALL                 (ARM_I2C_EVENT_TRANSFER_DONE       | \
-                                       ARM_I2C_EVENT_TRANSFER_INCOMPLETE | \
-                                       ARM_I2C_EVENT_ADDRESS_NACK        | \
-                                       ARM_I2C_EVENT_ARBITRATION_LOST    | \
-                                       ARM_I2C_EVENT_BUS_ERROR              )
-
 #define I2C_ADDRESS_7BIT_MASK         (0x7FUL)
 #define I2C_ADDRESS_10BIT_MASK        (0x3FFUL)
 
+/* Transfer phases */
+#define I2C_PHASE_WRITE               (0U)
+#define I2C_PHASE_READ                (1U)
+
+/* Event flag of a blocking transfer */
+#define I2C_FLAG_DONE                 (1UL << 0)
+
 /*******************************************************************************
  *  typedefs and structures (scope: module-local)
  ******************************************************************************/
@@ -48,8 +49,16 @@ typedef struct I2C_PortStatus {
 typedef struct I2C_PortInfo {
     I2C_PortStatus_t  status;
     I2C_Com_t        *curr_com;
-    osSemaphore_t     access_sem;
-    osEventFlags_t    event_flags;
+    osSemaphore_t     access_sem;   // Bus token, held while the queue runs
+    osMessageQueue_t  queue;        // Submitted transfers
+    uint32_t          queue_mem[osMessageQueueMemSize(I2C_QUEUE_SIZE, sizeof(I2C_Transfer_t *))/4U];
+    osWork_t          timeout_cb;
+    osWorkId_t        timeout_work; // Timeout work item of the transfer on the bus
+    osWork_t          retry_cb;
+    osWorkId_t        retry_work;   // Retry work item, submitted while the bus is idle
+    I2C_Transfer_t   *active;       // Transfer on the bus
+    I2C_Transfer_t   *retry;        // Transfers waiting for a retry
+    uint32_t          seq;          // Started transfers counter
 } I2C_PortInfo_t;
 
 typedef struct I2C_PortResources {
@@ -113,6 +122,18 @@ static I2C_PortResources_t *ports[] = {
 #endif
 };
 
+/* Worker thread of the retry and timeout work items */
+static osWorkQueueId_t  work_queue;
+static osWorkQueue_t    work_queue_cb;
+static osThread_t       work_thread_cb;
+static uint64_t         work_stack[I2C_WORK_STACK_SIZE/8U];
+
+/*******************************************************************************
+ *  function prototypes (scope: module-local)
+ ******************************************************************************/
+
+static void PortEvent(I2C_PortResources_t *port, uint32_t event);
+
 /*******************************************************************************
  *  function implementations (scope: module-local)
  ******************************************************************************/
@@ -121,7 +142,7 @@ static I2C_PortResources_t *ports[] = {
 
 static void I2C0_SignalEvent(uint32_t event)
 {
-  osEventFlagsSet(&I2C0_PortInfo.event_flags, event);
+  PortEvent(&I2C0_PortResources, event);
 }
 
 #endif
@@ -130,7 +151,7 @@ static void I2C0_SignalEvent(uint32_t event)
 
 static void I2C1_SignalEvent(uint32_t event)
 {
-  osEventFlagsSet(&I2C1_PortInfo.event_flags, event);
+  PortEvent(&I2C1_PortResources, event);
 }
 
 #endif
@@ -148,34 +169,305 @@ static I2C_PortResources_t* GetPort(uint32_t port_num)
   return (port);
 }
 
-static
-int32_t WaitOperation(I2C_PortResources_t *port, int32_t err, uint32_t timeout)
+/**
+ * @brief       Report the transfer result
+ * @param[in]   xfer  Transfer descriptor
+ * @param[in]   rc    Transfer result
+ */
+static void XferComplete(I2C_Transfer_t *xfer, int32_t rc)
+{
+  osEventFlagsId_t ef_id    = xfer->ef_id;
+  uint32_t         ef_flags = xfer->ef_flags;
+
+  xfer->status = rc;
+
+  /* The descriptor may be reused or released from here on */
+  if (xfer->cb_func != NULL) {
+    xfer->cb_func(xfer);
+  }
+
+  if (ef_id != NULL) {
+    osEventFlagsSet(ef_id, ef_flags);
+  }
+}
+
+/**
+ * @brief       Complete a failed transfer or put it on the retry list
+ * @param[in]   info   I2C Port Info, the bus token is held
+ * @param[in]   xfer   Transfer descriptor
+ * @param[in]   rc     Transfer result
+ * @param[in]   retry  The failure is worth a retry
+ */
+static void XferFail(I2C_PortInfo_t *info, I2C_Transfer_t *xfer, int32_t rc, bool retry)
+{
+  uint32_t now = osKernelGetTickCount();
+
+  if (retry && (xfer->retry_cnt != 0U) && time_before(now, xfer->deadline)) {
+    xfer->retry_cnt--;
+    xfer->retry_time = now + xfer->backoff;
+
+    if (xfer->backoff < I2C_RETRY_BACKOFF_MAX) {
+      xfer->backoff <<= 1U;
+    }
+
+    xfer->next  = info->retry;
+    info->retry = xfer;
+  }
+  else {
+    XferComplete(xfer, rc);
+  }
+}
+
+/**
+ * @brief       Start a transfer on the bus
+ * @param[in]   port  I2C Port Resources, the bus token is held
+ * @param[in]   xfer  Transfer descriptor
+ * @return      ARM_DRIVER_OK or the driver error code
+ */
+static int32_t XferStart(I2C_PortResources_t *port, I2C_Transfer_t *xfer)
+{
+  I2C_PortInfo_t *info = port->info;
+  I2C_Com_t      *com  = xfer->com;
+  int32_t         err;
+
+  if (info->curr_com != com) {
+    port->driver->Control(ARM_I2C_BUS_SPEED, com->bus_speed);
+    info->curr_com = com;
+  }
+
+  info->active = xfer;
+  info->seq++;
+
+  /* Watchdog of the transfer, merged with a pending one */
+  osWorkSubmit(info->timeout_work, xfer->deadline - osKernelGetTickCount());
+
+  if (xfer->tx_size != 0U) {
+    xfer->phase = I2C_PHASE_WRITE;
+    err = port->driver->MasterTransmit(com->slave_addr, xfer->tx_buf,
+                                       xfer->tx_size, (xfer->rx_size != 0U));
+  }
+  else {
+    xfer->phase = I2C_PHASE_READ;
+    err = port->driver->MasterReceive(com->slave_addr, xfer->rx_buf,
+                                      xfer->rx_size, false);
+  }
+
+  if (err != ARM_DRIVER_OK) {
+    info->active = NULL;
+  }
+
+  return (err);
+}
+
+/**
+ * @brief       Take a transfer from the retry list whose backoff has elapsed
+ * @param[in]   info  I2C Port Info, the bus token is held
+ * @return      Transfer descriptor or NULL
+ */
+static I2C_Transfer_t* RetryGet(I2C_PortInfo_t *info)
+{
+  I2C_Transfer_t **link;
+  I2C_Transfer_t  *xfer;
+  uint32_t         now = osKernelGetTickCount();
+
+  for (link = &info->retry; (xfer = *link) != NULL; link = &xfer->next) {
+    if (time_after_eq(now, xfer->retry_time)) {
+      *link = xfer->next;
+      return (xfer);
+    }
+  }
+
+  return (NULL);
+}
+
+/**
+ * @brief       Run the next transfer or release the bus token
+ * @param[in]   port  I2C Port Resources, the bus token is held
+ */
+static void PortNext(I2C_PortResources_t *port)
 {
-  uint32_t flags;
-   int32_t rc = I2C_ERROR_RESOURCE;
-
-  if (err == ARM_DRIVER_OK) {
-    flags = osEventFlagsWait(&port->info->event_flags, I2C_EVENT_ALL,
-                             osFlagsWaitAny, timeout);
-    if ((flags & osFlagsError) != 0U && flags == osFlagsErrorTimeout) {
-        rc = I2C_ERROR_TIMEOUT;
+  I2C_PortInfo_t *info = port->info;
+  I2C_Transfer_t *xfer;
+  I2C_Transfer_t *next;
+  int32_t         err;
+  uint32_t        now;
+
+  for (;;) {
+    xfer = RetryGet(info);
+    if (xfer == NULL) {
+      if (osMessageQueueGet(&info->queue, &xfer, NULL, 0U) != osOK) {
+        xfer = NULL;
+      }
     }
-    else if (flags & ARM_I2C_EVENT_TRANSFER_DONE) {
-      if (flags & ARM_I2C_EVENT_ADDRESS_NACK) {
-        rc = I2C_ERROR_ADDRESS_NACK;
+
+    if (xfer != NULL) {
+      if (time_after_eq(osKernelGetTickCount(), xfer->deadline)) {
+        XferComplete(xfer, I2C_ERROR_TIMEOUT);
+        continue;
       }
-      else if (flags & ARM_I2C_EVENT_TRANSFER_INCOMPLETE) {
-        rc = I2C_ERROR;
+
+      err = XferStart(port, xfer);
+      if (err == ARM_DRIVER_OK) {
+        return;
       }
-      else {
-        rc = I2C_OK;
+
+      XferFail(info, xfer, (err == ARM_DRIVER_ERROR_BUSY) ? I2C_ERROR_TIMEOUT : I2C_ERROR,
+               (err == ARM_DRIVER_ERROR_BUSY));
+      continue;
+    }
+
+    /*
+     * Bus idle, wake up for the earliest retry. The retry work item has its
+     * own delay, a pending watchdog does not hold the backoff back.
+     */
+    if (info->retry != NULL) {
+      now  = osKernelGetTickCount();
+      next = info->retry;
+      for (xfer = next->next; xfer != NULL; xfer = xfer->next) {
+        if (time_before(xfer->retry_time, next->retry_time)) {
+          next = xfer;
+        }
       }
+      osWorkSubmit(info->retry_work, time_after(next->retry_time, now) ? (next->retry_time - now) : 1U);
+    }
+
+    osSemaphoreRelease(&info->access_sem);
+
+    /* A transfer submitted meanwhile found the bus token taken */
+    if ((osMessageQueueGetCount(&info->queue) == 0U) ||
+        (osSemaphoreAcquire(&info->access_sem, 0U) != osOK)) {
+      return;
+    }
+  }
+}
+
+/**
+ * @brief       Driver event of the transfer on the bus
+ * @param[in]   port   I2C Port Resources
+ * @param[in]   event  \ref ARM_I2C_EVENT
+ */
+static void PortEvent(I2C_PortResources_t *port, uint32_t event)
+{
+  I2C_PortInfo_t *info = port->info;
+  I2C_Transfer_t *xfer = info->active;
+  int32_t         err;
+
+  if ((xfer == NULL) || ((event & ARM_I2C_EVENT_TRANSFER_DONE) == 0U)) {
+    return;
+  }
+
+  if ((event & ARM_I2C_EVENT_ADDRESS_NACK) != 0U) {
+    info->active = NULL;
+    XferFail(info, xfer, I2C_ERROR_ADDRESS_NACK, true);
+  }
+  else if ((event & (ARM_I2C_EVENT_ARBITRATION_LOST | ARM_I2C_EVENT_BUS_ERROR)) != 0U) {
+    info->active = NULL;
+    XferFail(info, xfer, I2C_ERROR, true);
+  }
+  else if ((event & ARM_I2C_EVENT_TRANSFER_INCOMPLETE) != 0U) {
+    info->active = NULL;
+    XferComplete(xfer, I2C_ERROR);
+  }
+  else if ((xfer->phase == I2C_PHASE_WRITE) && (xfer->rx_size != 0U)) {
+    /* Read after the repeated start */
+    xfer->phase = I2C_PHASE_READ;
+    err = port->driver->MasterReceive(xfer->com->slave_addr, xfer->rx_buf,
+                                      xfer->rx_size, false);
+    if (err == ARM_DRIVER_OK) {
+      return;
     }
+
+    info->active = NULL;
+    XferFail(info, xfer, I2C_ERROR, true);
+  }
+  else {
+    info->active = NULL;
+    XferComplete(xfer, I2C_OK);
+  }
+
+  PortNext(port);
+}
+
+/**
+ * @brief       Timeout work of the transfer on the bus (worker thread)
+ * @param[in]   argument  I2C Port Resources
+ */
+static void PortTimeout(void *argument)
+{
+  I2C_PortResources_t *port = argument;
+  I2C_PortInfo_t      *info = port->info;
+  I2C_Transfer_t      *xfer = info->active;
+  uint32_t             seq  = info->seq;
+  uint32_t             now  = osKernelGetTickCount();
+
+  if (xfer == NULL) {
+    return;
+  }
+
+  /* Watchdog of an earlier transfer, wait for the deadline of this one */
+  if (time_before(now, xfer->deadline)) {
+    osWorkSubmit(info->timeout_work, xfer->deadline - now);
+    return;
+  }
+
+  port->driver->Control(ARM_I2C_ABORT_TRANSFER, 0U);
+  port->driver->Control(ARM_I2C_BUS_CLEAR, 0U);
+
+  /* The driver may have completed the transfer before the abort */
+  if ((info->seq == seq) && (info->active == xfer)) {
+    info->active = NULL;
+    XferComplete(xfer, I2C_ERROR_TIMEOUT);
+    PortNext(port);
+  }
+}
+
+/**
+ * @brief       Retry work of a port (worker thread)
+ * @param[in]   argument  I2C Port Resources
+ * @note        A transfer on the bus holds the bus token, the retries then
+ *              run from its completion.
+ */
+static void PortRetry(void *argument)
+{
+  I2C_PortResources_t *port = argument;
+
+  if (osSemaphoreAcquire(&port->info->access_sem, 0U) == osOK) {
+    PortNext(port);
+  }
+}
+
+/**
+ * @brief       Submit a transfer and wait for its completion
+ * @param[in]   xfer  Transfer descriptor
+ * @return      Transfer result
+ */
+static int32_t XferWait(I2C_Transfer_t *xfer)
+{
+  osEventFlags_t ef;
+  int32_t        rc;
+
+  osEventFlagsAttr_t evf_attr = {
+    .name      = NULL,
+    .attr_bits = 0U,
+    .cb_mem    = &ef,
+    .cb_size   = sizeof(ef),
+  };
+
+  xfer->ef_id = osEventFlagsNew(&evf_attr);
+  if (xfer->ef_id == NULL) {
+    return (I2C_ERROR_RESOURCE);
   }
-  else if (err == ARM_DRIVER_ERROR_BUSY) {
-    rc = I2C_ERROR_TIMEOUT;
+  xfer->ef_flags = I2C_FLAG_DONE;
+
+  rc = I2C_Submit(xfer);
+  if (rc == I2C_OK) {
+    /* The port completes the transfer by the COM timeout */
+    osEventFlagsWait(xfer->ef_id, I2C_FLAG_DONE, osFlagsWaitAny, osWaitForever);
+    rc = xfer->status;
   }
 
+  osEventFlagsDelete(xfer->ef_id);
+
   return (rc);
 }
 
@@ -204,6 +496,53 @@ int32_t I2C_PortOpen(uint32_t port_num)
     return (I2C_OK);
   }
 
+  /* Create Worker Thread of all ports */
+  if (work_queue == NULL) {
+    osWorkQueueAttr_t wq_attr = {
+      .name        = "I2C",
+      .attr_bits   = 0U,
+      .cb_mem      = &work_queue_cb,
+      .cb_size     = sizeof(work_queue_cb),
+      .thread_mem  = &work_thread_cb,
+      .thread_size = sizeof(work_thread_cb),
+      .stack_mem   = &work_stack[0],
+      .stack_size  = sizeof(work_stack),
+      .priority    = I2C_WORK_PRIORITY,
+    };
+    work_queue = osWorkQueueNew(&wq_attr);
+    if (work_queue == NULL) {
+      return (I2C_ERROR_RESOURCE);
+    }
+  }
+
+  /* Create Timeout Work */
+  if (port->info->timeout_work == NULL) {
+    osWorkAttr_t work_attr = {
+      .name      = NULL,
+      .attr_bits = 0U,
+      .cb_mem    = &port->info->timeout_cb,
+      .cb_size   = sizeof(port->info->timeout_cb),
+    };
+    port->info->timeout_work = osWorkNew(work_queue, PortTimeout, (void *)port, &work_attr);
+    if (port->info->timeout_work == NULL) {
+      return (I2C_ERROR_RESOURCE);
+    }
+  }
+
+  /* Create Retry Work */
+  if (port->info->retry_work == NULL) {
+    osWorkAttr_t work_attr = {
+      .name      = NULL,
+      .attr_bits = 0U,
+      .cb_mem    = &port->info->retry_cb,
+      .cb_size   = sizeof(port->info->retry_cb),
+    };
+    port->info->retry_work = osWorkNew(work_queue, PortRetry, (void *)port, &work_attr);
+    if (port->info->retry_work == NULL) {
+      return (I2C_ERROR_RESOURCE);
+    }
+  }
+
   /* Create Access Semaphore */
   osSemaphoreAttr_t sem_attr = {
     .name      = NULL,
@@ -215,14 +554,17 @@ int32_t I2C_PortOpen(uint32_t port_num)
     return (I2C_ERROR_RESOURCE);
   }
 
-  /* Create Event Flags */
-  osEventFlagsAttr_t evf_attr = {
+  /* Create Transfer Queue */
+  osMessageQueueAttr_t mq_attr = {
     .name      = NULL,
     .attr_bits = 0U,
-    .cb_mem    = &port->info->event_flags,
-    .cb_size   = sizeof(port->info->event_flags),
+    .cb_mem    = &port->info->queue,
+    .cb_size   = sizeof(port->info->queue),
+    .mq_mem    = &port->info->queue_mem[0],
+    .mq_size   = sizeof(port->info->queue_mem),
   };
-  if (osEventFlagsNew(&evf_attr) == NULL) {
+  if (osMessageQueueNew(I2C_QUEUE_SIZE, sizeof(I2C_Transfer_t *), &mq_attr) == NULL) {
+    osSemaphoreDelete(&port->info->access_sem);
     return (I2C_ERROR_RESOURCE);
   }
 
@@ -230,6 +572,8 @@ int32_t I2C_PortOpen(uint32_t port_num)
   port->driver->PowerControl(ARM_POWER_FULL);
 
   port->info->curr_com    = NULL;
+  port->info->active      = NULL;
+  port->info->retry       = NULL;
   port->info->status.open = 1U;
 
   osSemaphoreRelease(&port->info->access_sem);
@@ -242,10 +586,13 @@ int32_t I2C_PortOpen(uint32_t port_num)
  * @param[in]   port_num  port number (hardware specific)
  * @return      I2C_OK              - Operation succeeded
  *              I2C_ERROR_PARAMETER - Parameter error
+ * @note        Waits for the transfer on the bus, the queued transfers are
+ *              completed with I2C_ERROR_RESOURCE.
  */
 int32_t I2C_PortClose(uint32_t port_num)
 {
   I2C_PortResources_t *port;
+  I2C_Transfer_t      *xfer;
 
   port = GetPort(port_num);
   if (port == NULL) {
@@ -257,12 +604,25 @@ int32_t I2C_PortClose(uint32_t port_num)
     return (I2C_OK);
   }
 
+  /* Stop submissions and wait until the bus is free */
+  port->info->status.open = 0U;
+  osSemaphoreAcquire(&port->info->access_sem, osWaitForever);
+  osWorkCancel(port->info->timeout_work);
+  osWorkCancel(port->info->retry_work);
+
+  while ((xfer = port->info->retry) != NULL) {
+    port->info->retry = xfer->next;
+    XferComplete(xfer, I2C_ERROR_RESOURCE);
+  }
+  while (osMessageQueueGet(&port->info->queue, &xfer, NULL, 0U) == osOK) {
+    XferComplete(xfer, I2C_ERROR_RESOURCE);
+  }
+
   port->driver->PowerControl(ARM_POWER_OFF);
   port->driver->Uninitialize();
 
-  osEventFlagsDelete(&port->info->event_flags);
+  osMessageQueueDelete(&port->info->queue);
   osSemaphoreDelete(&port->info->access_sem);
-  port->info->status.open = 0U;
 
   return (I2C_OK);
 }
@@ -298,10 +658,6 @@ int32_t I2C_ComCreate(I2C_Com_t      *com,
     return (I2C_ERROR);
   }
 
-  if (osSemaphoreAcquire(&port->info->access_sem, osWaitForever) != osOK) {
-    return (I2C_ERROR_RESOURCE);
-  }
-
   /* Create Access Semaphore */
   osSemaphoreAttr_t sem_attr = {
       .name      = NULL,
@@ -332,8 +688,6 @@ int32_t I2C_ComCreate(I2C_Com_t      *com,
     rc = I2C_ERROR_RESOURCE;
   }
 
-  osSemaphoreRelease(&port->info->access_sem);
-
   return (rc);
 }
 
@@ -384,49 +738,17 @@ int32_t I2C_ComUnLock(I2C_Com_t *com)
  */
 int32_t I2C_Write(I2C_Com_t *com, const uint8_t *buf, uint32_t buf_size)
 {
-   int32_t rc;
-   int32_t err;
-  uint32_t timeout;
-
   if (com == NULL || buf == NULL || buf_size == 0U) {
     return (I2C_ERROR_PARAMETER);
   }
 
-  I2C_PortResources_t *port = GetPort(com->port_num);
-  if (port == NULL) {
-    return (I2C_ERROR_RESOURCE);
-  }
-
-  if (osSemaphoreAcquire(&port->info->access_sem, osWaitForever) == osOK) {
-    if (port->info->curr_com != com) {
-      port->driver->Control(ARM_I2C_BUS_SPEED, com->bus_speed);
-      port->info->curr_com = com;
-    }
-
-    timeout = osKernelGetTickCount() + com->timeout;
-
-    do {
-      err = port->driver->MasterTransmit(com->slave_addr, buf, buf_size, false);
-      rc = WaitOperation(port, err, com->timeout);
-      if (rc == I2C_ERROR_TIMEOUT) {
-        osDelay(1U);
-      }
-      else {
-        break;
-      }
-    } while (time_before(osKernelGetTickCount(), timeout));
-
-    if (rc == I2C_ERROR_TIMEOUT) {
-      port->driver->Control(ARM_I2C_ABORT_TRANSFER, 0U);
-    }
-
-    osSemaphoreRelease(&port->info->access_sem);
-  }
-  else {
-    rc = I2C_ERROR_RESOURCE;
-  }
+  I2C_Transfer_t xfer = {
+    .com     = com,
+    .tx_buf  = buf,
+    .tx_size = buf_size,
+  };
 
-  return (rc);
+  return (XferWait(&xfer));
 }
 
 /**
@@ -448,63 +770,62 @@ int32_t I2C_Read(I2C_Com_t *com,
                  uint8_t   *buf,
                  uint32_t   buf_size)
 {
-   int32_t rc;
-   int32_t err;
-  uint32_t timeout;
-
-
   if (com == NULL || buf == NULL || buf_size == 0U || addr_size > 4U) {
     return (I2C_ERROR_PARAMETER);
   }
 
-  I2C_PortResources_t *port = GetPort(com->port_num);
-  if (port == NULL) {
-    return (I2C_ERROR);
-  }
+  /* Address write and data read are one transfer with a repeated start */
+  I2C_Transfer_t xfer = {
+    .com     = com,
+    .tx_buf  = (const uint8_t *)&addr,
+    .tx_size = addr_size,
+    .rx_buf  = buf,
+    .rx_size = buf_size,
+  };
 
-  if (osSemaphoreAcquire(&port->info->access_sem, osWaitForever) == osOK) {
-    if (port->info->curr_com != com) {
-      port->driver->Control(ARM_I2C_BUS_SPEED, com->bus_speed);
-      port->info->curr_com = com;
-    }
+  return (XferWait(&xfer));
+}
 
-    timeout = osKernelGetTickCount() + com->timeout;
+/**
+ * @brief       Queue a transfer on I2C COM
+ * @param[in]   xfer  Transfer descriptor
+ * @return      I2C_OK              - Transfer queued
+ *              I2C_ERROR_RESOURCE  - Port closed or queue full
+ *              I2C_ERROR_PARAMETER - Parameter error
+ */
+int32_t I2C_Submit(I2C_Transfer_t *xfer)
+{
+  I2C_PortResources_t *port;
 
-    do {
-      if (addr_size != 0U) {
-        err = port->driver->MasterTransmit(com->slave_addr, (uint8_t *)&addr,
-                                           addr_size, true);
-        rc = WaitOperation(port, err, com->timeout);
-        if (rc == I2C_ERROR_TIMEOUT) {
-          osDelay(1U);
-          continue;
-        }
+  if ((xfer == NULL) || (xfer->com == NULL) ||
+      ((xfer->tx_size == 0U) && (xfer->rx_size == 0U)) ||
+      ((xfer->tx_size != 0U) && (xfer->tx_buf == NULL)) ||
+      ((xfer->rx_size != 0U) && (xfer->rx_buf == NULL))) {
+    return (I2C_ERROR_PARAMETER);
+  }
 
-        if (rc != I2C_OK) {
-          break;
-        }
-      }
+  port = GetPort(xfer->com->port_num);
+  if (port == NULL) {
+    return (I2C_ERROR_PARAMETER);
+  }
 
-      err = port->driver->MasterReceive(com->slave_addr, buf, buf_size, false);
-      rc = WaitOperation(port, err, com->timeout);
-      if (rc == I2C_ERROR_TIMEOUT) {
-        osDelay(1U);
-      }
-      else {
-        break;
-      }
-    } while (time_before(osKernelGetTickCount(), timeout));
+  if (port->info->status.open == 0U) {
+    return (I2C_ERROR_RESOURCE);
+  }
 
-    if (rc == I2C_ERROR_TIMEOUT) {
-      port->driver->Control(ARM_I2C_ABORT_TRANSFER, 0U);
-      port->driver->Control(ARM_I2C_BUS_CLEAR, 0U);
-    }
+  xfer->status    = I2C_BUSY;
+  xfer->deadline  = osKernelGetTickCount() + xfer->com->timeout;
+  xfer->retry_cnt = xfer->retries;
+  xfer->backoff   = I2C_RETRY_BACKOFF;
 
-    osSemaphoreRelease(&port->info->access_sem);
+  if (osMessageQueuePut(&port->info->queue, &xfer, 0U, 0U) != osOK) {
+    return (I2C_ERROR_RESOURCE);
   }
-  else {
-    rc = I2C_ERROR;
+
+  /* Run the queue unless it is already running */
+  if (osSemaphoreAcquire(&port->info->access_sem, 0U) == osOK) {
+    PortNext(port);
   }
 
-  return (rc);
+  return (I2C_OK);
 }
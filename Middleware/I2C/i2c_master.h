@@ -39,6 +39,27 @@ extern "C" {
 #define USE_I2C0
 #define USE_I2C1
 
+/* Transfer queue configuration */
+#ifndef I2C_QUEUE_SIZE
+#define I2C_QUEUE_SIZE                (8U)        // Transfers waiting per port
+#endif
+
+#ifndef I2C_RETRY_BACKOFF
+#define I2C_RETRY_BACKOFF             (1U)        // First retry delay in ticks, doubled per retry
+#endif
+
+#ifndef I2C_RETRY_BACKOFF_MAX
+#define I2C_RETRY_BACKOFF_MAX         (32U)       // Retry delay limit in ticks
+#endif
+
+#ifndef I2C_WORK_STACK_SIZE
+#define I2C_WORK_STACK_SIZE           (512U)      // Stack of the retry/timeout worker thread
+#endif
+
+#ifndef I2C_WORK_PRIORITY
+#define I2C_WORK_PRIORITY             osPriorityHigh
+#endif
+
 /* I2C return codes */
 #define I2C_OK                        0
 #define I2C_ERROR                    -1
@@ -46,6 +67,7 @@ extern "C" {
 #define I2C_ERROR_RESOURCE           -3
 #define I2C_ERROR_PARAMETER          -4
 #define I2C_ERROR_ADDRESS_NACK       -5
+#define I2C_BUSY                      1           // Transfer queued or running
 
 /* I2C Address Flags */
 #define I2C_ADDRESS_7BIT_FORMAT       (0x0000UL)  // 7-bit address flag
@@ -71,6 +93,40 @@ typedef struct i2c_com {
     osSemaphore_t  access_sem;
 } I2C_Com_t;
 
+typedef struct I2C_Transfer I2C_Transfer_t;
+
+/**
+ * @brief       Transfer completion callback, called from the I2C driver
+ *              interrupt or from the I2C worker thread.
+ * @param[in]   xfer  Transfer descriptor, xfer->status holds the result
+ */
+typedef void (*I2C_TransferCallback_t)(I2C_Transfer_t *xfer);
+
+/*
+ * Transfer descriptor: the data is written first and then read after a
+ * repeated start. The descriptor must stay valid until it is completed.
+ */
+struct I2C_Transfer {
+    I2C_Com_t              *com;        // COM handle pointer
+    const uint8_t          *tx_buf;     // Data to write, NULL - read only
+    uint32_t                tx_size;    // Bytes to write
+    uint8_t                *rx_buf;     // Buffer for data to read, NULL - write only
+    uint32_t                rx_size;    // Bytes to read
+    uint32_t                retries;    // Retries after address NACK, arbitration lost or bus error
+    I2C_TransferCallback_t  cb_func;    // Completion callback, NULL - not used
+    void                   *cb_arg;     // Completion callback argument
+    osEventFlagsId_t        ef_id;      // Event flags set on completion, NULL - not used
+    uint32_t                ef_flags;   // Event flags to set
+    volatile int32_t        status;     // I2C_BUSY or the transfer result
+    /* Internal */
+    I2C_Transfer_t         *next;
+    uint32_t                deadline;
+    uint32_t                retry_time;
+    uint32_t                retry_cnt;
+    uint32_t                backoff;
+    uint32_t                phase;
+};
+
 /*******************************************************************************
  *  exported function prototypes
  ******************************************************************************/
@@ -158,6 +214,19 @@ int32_t I2C_Read(I2C_Com_t *com,
                  uint8_t   *buf,
                  uint32_t   buf_size);
 
+/**
+ * @brief       Queue a transfer on I2C COM
+ * @param[in]   xfer  Transfer descriptor
+ * @return      I2C_OK              - Transfer queued
+ *              I2C_ERROR_RESOURCE  - Port closed or queue full
+ *              I2C_ERROR_PARAMETER - Parameter error
+ * @note        The transfers of a port run back-to-back from the driver
+ *              callback. The COM timeout limits the time from submission to
+ *              completion including the retries. Can be called from
+ *              Interrupt Service Routines and from the completion callback.
+ */
+int32_t I2C_Submit(I2C_Transfer_t *xfer);
+
 
 #ifdef  __cplusplus
 }
@@ -0,0 +1,746 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Description: Ethernet MAC stand-in for running the network stack without
+ *              hardware.
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <Kernel/kernel.h>
+
+#include "eth_mac_loop.h"
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#define ARM_ETH_MAC_DRV_VERSION       ARM_DRIVER_VERSION_MAJOR_MINOR(1,0)
+#define ARM_ETH_PHY_DRV_VERSION       ARM_DRIVER_VERSION_MAJOR_MINOR(1,0)
+
+/* Driver status flags */
+#define LOOP_FLAG_INIT                (1U << 0)
+#define LOOP_FLAG_POWER               (1U << 1)
+#define LOOP_FLAG_TX                  (1U << 2)   // Transmitter enabled
+#define LOOP_FLAG_RX                  (1U << 3)   // Receiver enabled
+#define LOOP_FLAG_RX_POLL             (1U << 4)   // Polled receive mode
+#define LOOP_FLAG_RX_MASKED           (1U << 5)   // Receive event masked until the ring is drained
+#define LOOP_FLAG_RX_FULL             (1U << 6)   // Receive ring ran full
+
+/* Receive buffer states */
+#define LOOP_RX_FREE                  (0U)
+#define LOOP_RX_READY                 (1U)
+#define LOOP_RX_BORROWED              (2U)
+
+#if (ETH_LOOP_NUM_RX_RESERVE < 1U) || (ETH_LOOP_NUM_RX_RESERVE >= ETH_LOOP_NUM_RX_BUF)
+  #error ETH_LOOP_NUM_RX_RESERVE must be in range 1..ETH_LOOP_NUM_RX_BUF-1
+#endif
+
+#if (ETH_LOOP_NUM_TX_DESC < 1U)
+  #error ETH_LOOP_NUM_TX_DESC must be at least 1
+#endif
+
+#define LOOPx_EXPORT_DRIVER(x)                                                                                                                                   \
+static int32_t  Loop##x##_Initialize       (ARM_ETH_MAC_SignalEvent_t cb_event)                  { return (LoopInitialize      (&Loop##x, cb_event));          } \
+static int32_t  Loop##x##_Uninitialize     (void)                                                { return (LoopUninitialize    (&Loop##x));                    } \
+static int32_t  Loop##x##_PowerControl     (ARM_POWER_STATE state)                               { return (LoopPowerControl    (&Loop##x, state));             } \
+static int32_t  Loop##x##_GetMacAddress    (      ARM_ETH_MAC_ADDR *ptr_addr)                    { return (LoopGetMacAddress   (&Loop##x, ptr_addr));          } \
+static int32_t  Loop##x##_SetMacAddress    (const ARM_ETH_MAC_ADDR *ptr_addr)                    { return (LoopSetMacAddress   (&Loop##x, ptr_addr));          } \
+static int32_t  Loop##x##_SetAddressFilter (const ARM_ETH_MAC_ADDR *ptr_addr, uint32_t num_addr) { return (LoopSetAddressFilter(&Loop##x, ptr_addr, num_addr)); } \
+static int32_t  Loop##x##_SendFrame        (const uint8_t *frame, uint32_t len, uint32_t flags)  { return (LoopSendFrame       (&Loop##x, frame, len, flags)); } \
+static int32_t  Loop##x##_ReadFrame        (      uint8_t *frame, uint32_t len)                  { return (LoopReadFrame       (&Loop##x, frame, len));        } \
+static uint32_t Loop##x##_GetRxFrameSize   (void)                                                { return (LoopGetRxFrameSize  (&Loop##x));                    } \
+static int32_t  Loop##x##_Control          (uint32_t control, uint32_t arg)                      { return (LoopControl         (&Loop##x, control, arg));      } \
+                                                                                                                                                                 \
+ARM_DRIVER_ETH_MAC Driver_ETH_MAC_Loop##x = {                                                                                                                    \
+  LoopGetVersion,                                                                                                                                                \
+  LoopGetCapabilities,                                                                                                                                           \
+  Loop##x##_Initialize,                                                                                                                                          \
+  Loop##x##_Uninitialize,                                                                                                                                        \
+  Loop##x##_PowerControl,                                                                                                                                        \
+  Loop##x##_GetMacAddress,                                                                                                                                       \
+  Loop##x##_SetMacAddress,                                                                                                                                       \
+  Loop##x##_SetAddressFilter,                                                                                                                                    \
+  Loop##x##_SendFrame,                                                                                                                                           \
+  Loop##x##_ReadFrame,                                                                                                                                           \
+  Loop##x##_GetRxFrameSize,                                                                                                                                      \
+  LoopGetFrameTime,                                                                                                                                              \
+  LoopGetFrameTime,                                                                                                                                              \
+  LoopControlTimer,                                                                                                                                              \
+  Loop##x##_Control,                                                                                                                                             \
+  LoopPhyRead,                                                                                                                                                   \
+  LoopPhyWrite                                                                                                                                                   \
+}
+
+/*******************************************************************************
+ *  typedefs and structures (scope: module-local)
+ ******************************************************************************/
+
+typedef struct LoopRxBuf_s {
+  uint32_t                  data[ETH_LOOP_BUF_SIZE / 4U];
+  uint32_t                  len;
+  uint32_t                  state;
+} LoopRxBuf_t;
+
+typedef struct LoopMac_s {
+  struct LoopMac_s         *peer;
+  ARM_ETH_MAC_SignalEvent_t cb_event;
+  uint32_t                  flags;
+  uint32_t                  mode;       // ARM_ETH_MAC_CONFIGURE argument
+  ARM_ETH_MAC_ADDR          addr;
+  ARM_ETH_MAC_ADDR          mcast[ETH_LOOP_NUM_MCAST];
+  uint32_t                  num_mcast;
+  LoopRxBuf_t               rx[ETH_LOOP_NUM_RX_BUF];
+  uint32_t                  rx_wr;      // Next buffer to fill
+  uint32_t                  rx_rd;      // Next buffer to read
+  uint32_t                  rx_batch;   // Frames read in the current poll batch
+  uint32_t                  rx_lent;    // Buffers borrowed by the application
+  ETH_MAC_RX_STATS          rx_stats;
+  uint32_t                  tx_buf[ETH_LOOP_BUF_SIZE / 4U];
+  uint32_t                  tx_len;     // Frame assembly in progress
+  uint32_t                  tx_frags;   // Fragments of the frame being assembled
+  uint32_t                  tx_done;    // Frames sent since the last reclaim
+} LoopMac_t;
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static LoopMac_t Loop0;
+static LoopMac_t Loop1;
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+static ARM_DRIVER_VERSION LoopGetVersion(void)
+{
+  const ARM_DRIVER_VERSION version = {
+    ARM_ETH_MAC_API_VERSION,
+    ARM_ETH_MAC_DRV_VERSION
+  };
+
+  return (version);
+}
+
+static ARM_ETH_MAC_CAPABILITIES LoopGetCapabilities(void)
+{
+  /* No checksum offload, the stack calculates all checksums */
+  const ARM_ETH_MAC_CAPABILITIES capabilities = {
+    .media_interface = ARM_ETH_INTERFACE_MII,
+    .event_rx_frame  = 1U,
+    .event_tx_frame  = 1U,
+  };
+
+  return (capabilities);
+}
+
+static int32_t LoopGetFrameTime(ARM_ETH_MAC_TIME *time)
+{
+  (void)time;
+
+  return (ARM_DRIVER_ERROR_UNSUPPORTED);
+}
+
+static int32_t LoopControlTimer(uint32_t control, ARM_ETH_MAC_TIME *time)
+{
+  (void)control;
+  (void)time;
+
+  return (ARM_DRIVER_ERROR_UNSUPPORTED);
+}
+
+static int32_t LoopPhyRead(uint8_t phy_addr, uint8_t reg_addr, uint16_t *data)
+{
+  (void)phy_addr;
+  (void)reg_addr;
+  (void)data;
+
+  return (ARM_DRIVER_ERROR_UNSUPPORTED);
+}
+
+static int32_t LoopPhyWrite(uint8_t phy_addr, uint8_t reg_addr, uint16_t data)
+{
+  (void)phy_addr;
+  (void)reg_addr;
+  (void)data;
+
+  return (ARM_DRIVER_ERROR_UNSUPPORTED);
+}
+
+/**
+ * @fn          bool LoopAccept(const LoopMac_t *mac, const uint8_t *frame)
+ * @brief       Address filter of the receiver.
+ * @param[in]   mac    Receiving MAC
+ * @param[in]   frame  Frame, starting with the destination address
+ * @return      true - frame accepted.
+ */
+static bool LoopAccept(const LoopMac_t *mac, const uint8_t *frame)
+{
+  static const uint8_t bcast[6] = { 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU };
+  uint32_t i;
+
+  if ((mac->mode & ARM_ETH_MAC_ADDRESS_ALL) != 0U) {
+    return (true);
+  }
+
+  if (memcmp(frame, bcast, 6U) == 0) {
+    return ((mac->mode & ARM_ETH_MAC_ADDRESS_BROADCAST) != 0U);
+  }
+
+  if ((frame[0] & 1U) != 0U) {
+    if ((mac->mode & ARM_ETH_MAC_ADDRESS_MULTICAST) != 0U) {
+      return (true);
+    }
+    for (i = 0U; i < mac->num_mcast; i++) {
+      if (memcmp(frame, mac->mcast[i].b, 6U) == 0) {
+        return (true);
+      }
+    }
+    return (false);
+  }
+
+  return (memcmp(frame, mac->addr.b, 6U) == 0);
+}
+
+/**
+ * @fn          void LoopDeliver(LoopMac_t *mac, const uint8_t *frame, uint32_t len)
+ * @brief       Put a frame into the receive ring.
+ * @param[in]   mac    Receiving MAC
+ * @param[in]   frame  Frame data
+ * @param[in]   len    Frame length
+ */
+static void LoopDeliver(LoopMac_t *mac, const uint8_t *frame, uint32_t len)
+{
+  LoopRxBuf_t *buf;
+  bool         signal = false;
+  int32_t      lock;
+
+  lock = osKernelLock();
+
+  if (((mac->flags & LOOP_FLAG_RX) != 0U) && (len >= 6U) && LoopAccept(mac, frame)) {
+    buf = &mac->rx[mac->rx_wr];
+    if (buf->state == LOOP_RX_FREE) {
+      memcpy(buf->data, frame, len);
+      buf->len   = len;
+      buf->state = LOOP_RX_READY;
+      if (++mac->rx_wr == ETH_LOOP_NUM_RX_BUF) {
+        mac->rx_wr = 0U;
+      }
+      if ((mac->flags & LOOP_FLAG_RX_MASKED) == 0U) {
+        /* Stand-in for the receive interrupt */
+        mac->rx_stats.interrupts++;
+        if ((mac->flags & LOOP_FLAG_RX_POLL) != 0U) {
+          mac->flags |= LOOP_FLAG_RX_MASKED;
+        }
+        signal = true;
+      }
+    }
+    else {
+      /* Ring full, the frame is dropped */
+      if ((mac->flags & LOOP_FLAG_RX_FULL) == 0U) {
+        mac->flags |= LOOP_FLAG_RX_FULL;
+        mac->rx_stats.rbus++;
+      }
+      mac->rx_stats.missed++;
+    }
+  }
+
+  (void)osKernelRestoreLock(lock);
+
+  if (signal && (mac->cb_event != NULL)) {
+    mac->cb_event(ARM_ETH_MAC_EVENT_RX_FRAME);
+  }
+}
+
+/**
+ * @fn          void LoopRxNext(LoopMac_t *mac, uint32_t state)
+ * @brief       Move on to the next received frame.
+ * @param[in]   mac    MAC
+ * @param[in]   state  New state of the current buffer
+ */
+static void LoopRxNext(LoopMac_t *mac, uint32_t state)
+{
+  mac->rx[mac->rx_rd].state = state;
+  if (state == LOOP_RX_FREE) {
+    mac->flags &= ~LOOP_FLAG_RX_FULL;
+  }
+  if (++mac->rx_rd == ETH_LOOP_NUM_RX_BUF) {
+    mac->rx_rd = 0U;
+  }
+
+  mac->rx_stats.frames++;
+  if ((mac->flags & LOOP_FLAG_RX_POLL) != 0U) {
+    mac->rx_batch++;
+  }
+}
+
+static int32_t LoopInitialize(LoopMac_t *mac, ARM_ETH_MAC_SignalEvent_t cb_event)
+{
+  if ((mac->flags & LOOP_FLAG_INIT) != 0U) {
+    return (ARM_DRIVER_OK);
+  }
+
+  mac->peer     = (mac == &Loop0) ? &Loop1 : &Loop0;
+  mac->cb_event = cb_event;
+  mac->flags    = LOOP_FLAG_INIT;
+
+  /* Locally administered address */
+  memset(&mac->addr, 0, sizeof(mac->addr));
+  mac->addr.b[0] = 0x02U;
+  mac->addr.b[5] = (mac == &Loop0) ? 0x01U : 0x02U;
+
+  return (ARM_DRIVER_OK);
+}
+
+static int32_t LoopUninitialize(LoopMac_t *mac)
+{
+  mac->flags    = 0U;
+  mac->cb_event = NULL;
+
+  return (ARM_DRIVER_OK);
+}
+
+static int32_t LoopPowerControl(LoopMac_t *mac, ARM_POWER_STATE state)
+{
+  int32_t  lock;
+  uint32_t i;
+
+  switch (state) {
+    case ARM_POWER_OFF:
+      mac->flags &= LOOP_FLAG_INIT;
+      break;
+
+    case ARM_POWER_LOW:
+      return (ARM_DRIVER_ERROR_UNSUPPORTED);
+
+    case ARM_POWER_FULL:
+      if ((mac->flags & LOOP_FLAG_INIT) == 0U) {
+        return (ARM_DRIVER_ERROR);
+      }
+      if ((mac->flags & LOOP_FLAG_POWER) != 0U) {
+        break;
+      }
+      lock = osKernelLock();
+      for (i = 0U; i < ETH_LOOP_NUM_RX_BUF; i++) {
+        mac->rx[i].state = LOOP_RX_FREE;
+      }
+      mac->rx_wr     = 0U;
+      mac->rx_rd     = 0U;
+      mac->rx_batch  = 0U;
+      mac->rx_lent   = 0U;
+      mac->tx_len    = 0U;
+      mac->tx_frags  = 0U;
+      mac->tx_done   = 0U;
+      mac->mode      = 0U;
+      mac->num_mcast = 0U;
+      memset(&mac->rx_stats, 0, sizeof(mac->rx_stats));
+      mac->flags     = LOOP_FLAG_INIT | LOOP_FLAG_POWER;
+      (void)osKernelRestoreLock(lock);
+      break;
+
+    default:
+      return (ARM_DRIVER_ERROR_PARAMETER);
+  }
+
+  return (ARM_DRIVER_OK);
+}
+
+static int32_t LoopGetMacAddress(LoopMac_t *mac, ARM_ETH_MAC_ADDR *ptr_addr)
+{
+  if (ptr_addr == NULL) {
+    return (ARM_DRIVER_ERROR_PARAMETER);
+  }
+
+  *ptr_addr = mac->addr;
+
+  return (ARM_DRIVER_OK);
+}
+
+static int32_t LoopSetMacAddress(LoopMac_t *mac, const ARM_ETH_MAC_ADDR *ptr_addr)
+{
+  if (ptr_addr == NULL) {
+    return (ARM_DRIVER_ERROR_PARAMETER);
+  }
+
+  mac->addr = *ptr_addr;
+
+  return (ARM_DRIVER_OK);
+}
+
+static int32_t LoopSetAddressFilter(LoopMac_t *mac, const ARM_ETH_MAC_ADDR *ptr_addr, uint32_t num_addr)
+{
+  int32_t lock;
+
+  if ((ptr_addr == NULL) && (num_addr != 0U)) {
+    return (ARM_DRIVER_ERROR_PARAMETER);
+  }
+
+  if (num_addr > ETH_LOOP_NUM_MCAST) {
+    return (ARM_DRIVER_ERROR_UNSUPPORTED);
+  }
+
+  lock = osKernelLock();
+  if (num_addr != 0U) {
+    memcpy(mac->mcast, ptr_addr, num_addr * sizeof(ARM_ETH_MAC_ADDR));
+  }
+  mac->num_mcast = num_addr;
+  (void)osKernelRestoreLock(lock);
+
+  return (ARM_DRIVER_OK);
+}
+
+static int32_t LoopSendFrame(LoopMac_t *mac, const uint8_t *frame, uint32_t len, uint32_t flags)
+{
+  LoopMac_t *dst;
+  uint8_t   *buf = (uint8_t *)mac->tx_buf;
+
+  if ((frame == NULL) || (len == 0U)) {
+    return (ARM_DRIVER_ERROR_PARAMETER);
+  }
+
+  if ((mac->flags & LOOP_FLAG_POWER) == 0U) {
+    return (ARM_DRIVER_ERROR);
+  }
+
+  if (++mac->tx_frags > ETH_LOOP_NUM_TX_DESC) {
+    /* More fragments than descriptors, the frame is dropped */
+    mac->tx_len   = 0U;
+    mac->tx_frags = 0U;
+    return (ARM_DRIVER_ERROR);
+  }
+
+  if ((frame == buf) && (mac->tx_len == 0U)) {
+    /* Filled in place (ETH_MAC_TX_BUFFER_GET) */
+    mac->tx_len = len;
+  }
+  else {
+    if ((mac->tx_len + len) > ETH_LOOP_BUF_SIZE) {
+      mac->tx_len   = 0U;
+      mac->tx_frags = 0U;
+      return (ARM_DRIVER_ERROR_PARAMETER);
+    }
+    /* The wire is synchronous, ETH_MAC_TX_FRAME_NOCOPY fragments are copied too */
+    memcpy(&buf[mac->tx_len], frame, len);
+    mac->tx_len += len;
+  }
+
+  if ((flags & ARM_ETH_MAC_TX_FRAME_FRAGMENT) != 0U) {
+    return (ARM_DRIVER_OK);
+  }
+
+  if ((mac->flags & LOOP_FLAG_TX) != 0U) {
+    dst = ((mac->mode & ARM_ETH_MAC_LOOPBACK) != 0U) ? mac : mac->peer;
+    LoopDeliver(dst, buf, mac->tx_len);
+  }
+
+  mac->tx_len   = 0U;
+  mac->tx_frags = 0U;
+  mac->tx_done++;
+
+  if (((flags & ARM_ETH_MAC_TX_FRAME_EVENT) != 0U) && (mac->cb_event != NULL)) {
+    mac->cb_event(ARM_ETH_MAC_EVENT_TX_FRAME);
+  }
+
+  return (ARM_DRIVER_OK);
+}
+
+static uint32_t LoopGetRxFrameSize(LoopMac_t *mac)
+{
+  const LoopRxBuf_t *buf = &mac->rx[mac->rx_rd];
+
+  if (((mac->flags & LOOP_FLAG_POWER) == 0U) || (buf->state != LOOP_RX_READY)) {
+    return (0U);
+  }
+
+  return (buf->len);
+}
+
+static int32_t LoopReadFrame(LoopMac_t *mac, uint8_t *frame, uint32_t len)
+{
+  LoopRxBuf_t *buf = &mac->rx[mac->rx_rd];
+  int32_t      lock;
+
+  if ((frame == NULL) && (len != 0U)) {
+    return (ARM_DRIVER_ERROR_PARAMETER);
+  }
+
+  if (((mac->flags & LOOP_FLAG_POWER) == 0U) || (buf->state != LOOP_RX_READY)) {
+    return (ARM_DRIVER_ERROR);
+  }
+
+  if (len > buf->len) {
+    len = buf->len;
+  }
+  if (len != 0U) {
+    memcpy(frame, buf->data, len);
+  }
+
+  lock = osKernelLock();
+  LoopRxNext(mac, LOOP_RX_FREE);
+  (void)osKernelRestoreLock(lock);
+
+  return ((int32_t)len);
+}
+
+static int32_t LoopControl(LoopMac_t *mac, uint32_t control, uint32_t arg)
+{
+  ETH_MAC_FRAME_BUF *fb;
+  LoopRxBuf_t       *buf;
+  int32_t            lock;
+  int32_t            ret = ARM_DRIVER_OK;
+  uint32_t           i;
+
+  if ((mac->flags & LOOP_FLAG_POWER) == 0U) {
+    return (ARM_DRIVER_ERROR);
+  }
+
+  lock = osKernelLock();
+
+  switch (control) {
+    case ARM_ETH_MAC_CONFIGURE:
+      if ((arg & (ARM_ETH_MAC_CHECKSUM_OFFLOAD_RX | ARM_ETH_MAC_CHECKSUM_OFFLOAD_TX)) != 0U) {
+        ret = ARM_DRIVER_ERROR_UNSUPPORTED;
+        break;
+      }
+      mac->mode = arg;
+      break;
+
+    case ARM_ETH_MAC_CONTROL_TX:
+      if (arg != 0U) {
+        mac->flags |= LOOP_FLAG_TX;
+      }
+      else {
+        mac->flags &= ~LOOP_FLAG_TX;
+      }
+      break;
+
+    case ARM_ETH_MAC_CONTROL_RX:
+      if (arg != 0U) {
+        mac->flags |= LOOP_FLAG_RX;
+      }
+      else {
+        mac->flags &= ~LOOP_FLAG_RX;
+      }
+      break;
+
+    case ARM_ETH_MAC_FLUSH:
+      if ((arg & ARM_ETH_MAC_FLUSH_RX) != 0U) {
+        /* Borrowed buffers stay with the application */
+        for (i = 0U; i < ETH_LOOP_NUM_RX_BUF; i++) {
+          if (mac->rx[i].state == LOOP_RX_READY) {
+            mac->rx[i].state = LOOP_RX_FREE;
+          }
+        }
+        mac->rx_rd  = mac->rx_wr;
+        mac->flags &= ~LOOP_FLAG_RX_FULL;
+      }
+      if ((arg & ARM_ETH_MAC_FLUSH_TX) != 0U) {
+        mac->tx_len   = 0U;
+        mac->tx_frags = 0U;
+      }
+      break;
+
+    case ETH_MAC_RX_FRAME_BORROW:
+      fb  = (ETH_MAC_FRAME_BUF *)arg;
+      buf = &mac->rx[mac->rx_rd];
+      if (fb == NULL) {
+        ret = ARM_DRIVER_ERROR_PARAMETER;
+      }
+      else if ((buf->state != LOOP_RX_READY) ||
+               (mac->rx_lent >= (ETH_LOOP_NUM_RX_BUF - ETH_LOOP_NUM_RX_RESERVE))) {
+        /* Nothing received, or the reserve is reached and the frame is read with ReadFrame */
+        ret = ARM_DRIVER_ERROR_BUSY;
+      }
+      else {
+        fb->data = (uint8_t *)buf->data;
+        fb->len  = buf->len;
+        mac->rx_lent++;
+        LoopRxNext(mac, LOOP_RX_BORROWED);
+      }
+      break;
+
+    case ETH_MAC_RX_FRAME_RETURN:
+      for (i = 0U; i < ETH_LOOP_NUM_RX_BUF; i++) {
+        if ((uint32_t)mac->rx[i].data == arg) {
+          break;
+        }
+      }
+      if ((i == ETH_LOOP_NUM_RX_BUF) || (mac->rx[i].state != LOOP_RX_BORROWED)) {
+        ret = ARM_DRIVER_ERROR_PARAMETER;
+      }
+      else {
+        mac->rx[i].state = LOOP_RX_FREE;
+        mac->rx_lent--;
+        mac->flags &= ~LOOP_FLAG_RX_FULL;
+      }
+      break;
+
+    case ETH_MAC_TX_BUFFER_GET:
+      fb = (ETH_MAC_FRAME_BUF *)arg;
+      if (fb == NULL) {
+        ret = ARM_DRIVER_ERROR_PARAMETER;
+      }
+      else if (mac->tx_len != 0U) {
+        /* Frame assembly in progress */
+        ret = ARM_DRIVER_ERROR;
+      }
+      else {
+        fb->data = (uint8_t *)mac->tx_buf;
+        fb->len  = ETH_LOOP_BUF_SIZE;
+      }
+      break;
+
+    case ETH_MAC_TX_RECLAIM:
+      ret = (int32_t)mac->tx_done;
+      mac->tx_done = 0U;
+      break;
+
+    case ETH_MAC_CONTROL_RX_POLL:
+      if (arg != 0U) {
+        mac->flags |= LOOP_FLAG_RX_POLL;
+      }
+      else {
+        mac->flags &= ~(LOOP_FLAG_RX_POLL | LOOP_FLAG_RX_MASKED);
+      }
+      mac->rx_batch = 0U;
+      break;
+
+    case ETH_MAC_RX_POLL_COMPLETE:
+      if (mac->rx[mac->rx_rd].state == LOOP_RX_READY) {
+        /* Frame arrived in the meantime, keep polling */
+        ret = ARM_DRIVER_ERROR_BUSY;
+        break;
+      }
+      if (mac->rx_batch != 0U) {
+        mac->rx_stats.batches++;
+        if (mac->rx_batch > mac->rx_stats.batch_max) {
+          mac->rx_stats.batch_max = mac->rx_batch;
+        }
+        mac->rx_batch = 0U;
+      }
+      mac->flags &= ~LOOP_FLAG_RX_MASKED;
+      break;
+
+    case ETH_MAC_GET_RX_STATS:
+      if (arg == 0U) {
+        ret = ARM_DRIVER_ERROR_PARAMETER;
+      }
+      else {
+        memcpy((void *)arg, &mac->rx_stats, sizeof(ETH_MAC_RX_STATS));
+      }
+      break;
+
+    case ETH_MAC_GET_TX_DESC_NUM:
+      ret = (int32_t)ETH_LOOP_NUM_TX_DESC;
+      break;
+
+    default:
+      ret = ARM_DRIVER_ERROR_UNSUPPORTED;
+      break;
+  }
+
+  (void)osKernelRestoreLock(lock);
+
+  return (ret);
+}
+
+/* PHY stand-in */
+
+static ARM_DRIVER_VERSION PhyGetVersion(void)
+{
+  const ARM_DRIVER_VERSION version = {
+    ARM_ETH_PHY_API_VERSION,
+    ARM_ETH_PHY_DRV_VERSION
+  };
+
+  return (version);
+}
+
+static int32_t PhyInitialize(ARM_ETH_PHY_Read_t fn_read, ARM_ETH_PHY_Write_t fn_write)
+{
+  (void)fn_read;
+  (void)fn_write;
+
+  return (ARM_DRIVER_OK);
+}
+
+static int32_t PhyUninitialize(void)
+{
+  return (ARM_DRIVER_OK);
+}
+
+static int32_t PhyPowerControl(ARM_POWER_STATE state)
+{
+  return ((state == ARM_POWER_LOW) ? ARM_DRIVER_ERROR_UNSUPPORTED : ARM_DRIVER_OK);
+}
+
+static int32_t PhySetInterface(uint32_t interface)
+{
+  (void)interface;
+
+  return (ARM_DRIVER_OK);
+}
+
+static int32_t PhySetMode(uint32_t mode)
+{
+  (void)mode;
+
+  return (ARM_DRIVER_OK);
+}
+
+static ARM_ETH_LINK_STATE PhyGetLinkState(void)
+{
+  return (ARM_ETH_LINK_UP);
+}
+
+static ARM_ETH_LINK_INFO PhyGetLinkInfo(void)
+{
+  ARM_ETH_LINK_INFO info = {
+    .speed  = ARM_ETH_SPEED_100M,
+    .duplex = ARM_ETH_DUPLEX_FULL,
+  };
+
+  return (info);
+}
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-exported)
+ ******************************************************************************/
+
+LOOPx_EXPORT_DRIVER(0);
+LOOPx_EXPORT_DRIVER(1);
+
+ARM_DRIVER_ETH_PHY Driver_ETH_PHY_Loop = {
+  PhyGetVersion,
+  PhyInitialize,
+  PhyUninitialize,
+  PhyPowerControl,
+  PhySetInterface,
+  PhySetMode,
+  PhyGetLinkState,
+  PhyGetLinkInfo
+};
+
+/* ----------------------------- End of file ---------------------------------*/
@@ -0,0 +1,707 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Description: lwIP network interface over a CMSIS Ethernet MAC driver.
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "lwip/opt.h"
+#include "lwip/memp.h"
+#include "lwip/stats.h"
+#include "lwip/snmp.h"
+#include "lwip/tcpip.h"
+#include "lwip/etharp.h"
+#include "netif/ethernet.h"
+#if LWIP_IPV6
+#include "lwip/ethip6.h"
+#endif
+
+#include "eth_netif.h"
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#if (ETH_PAD_SIZE != 0)
+  #error ETH_PAD_SIZE must be 0, frames are received into the MAC buffers
+#endif
+
+#if (ETH_NETIF_MAX < 1U) || (ETH_NETIF_MAX > 2U)
+  #error ETH_NETIF_MAX must be in range 1..2
+#endif
+
+/* Interface status flags */
+#define NETIF_FLAG_EXT                (1U << 0)   // Driver extensions of Driver_ETH_MAC_Ext.h
+#define NETIF_FLAG_RX_POLL            (1U << 1)   // Polled receive mode
+
+/* GetRxFrameSize result for a frame with errors */
+#define ETH_RX_FRAME_ERROR            (0xFFFFFFFFU)
+
+/*******************************************************************************
+ *  typedefs and structures (scope: module-local)
+ ******************************************************************************/
+
+#if LWIP_SUPPORT_CUSTOM_PBUF
+/* pbuf referencing a borrowed receive buffer of the MAC */
+typedef struct EthRxPbuf_s {
+  struct pbuf_custom        p;
+  EthNetif_t               *ctx;
+  uint8_t                  *buf;
+} EthRxPbuf_t;
+#endif
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+#if LWIP_SUPPORT_CUSTOM_PBUF
+LWIP_MEMPOOL_DECLARE(ETH_RX_PBUF, ETH_NETIF_RX_BORROW_MAX, sizeof(EthRxPbuf_t), "ETH RX borrowed")
+#endif
+
+static EthNetif_t *eth_ctx[ETH_NETIF_MAX];
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+static void EthLock(EthNetif_t *ctx)
+{
+  (void)osMutexAcquire(ctx->lock, osWaitForever);
+}
+
+static void EthUnlock(EthNetif_t *ctx)
+{
+  (void)osMutexRelease(ctx->lock);
+}
+
+static void EthEvent(EthNetif_t *ctx, uint32_t event)
+{
+  if ((event & ARM_ETH_MAC_EVENT_RX_FRAME) != 0U) {
+    (void)osSemaphoreRelease(ctx->rx_sem);
+  }
+}
+
+/* The driver callback has no context, one trampoline per interface */
+static void EthEvent0(uint32_t event)
+{
+  EthEvent(eth_ctx[0], event);
+}
+
+#if (ETH_NETIF_MAX > 1U)
+static void EthEvent1(uint32_t event)
+{
+  EthEvent(eth_ctx[1], event);
+}
+#endif
+
+static const ARM_ETH_MAC_SignalEvent_t eth_event[ETH_NETIF_MAX] = {
+  EthEvent0,
+#if (ETH_NETIF_MAX > 1U)
+  EthEvent1,
+#endif
+};
+
+/**
+ * @fn          void EthTxReclaim(EthNetif_t *ctx)
+ * @brief       Release the pbufs of transmitted frames, called with the lock held.
+ * @param[in]   ctx  Interface context
+ */
+static void EthTxReclaim(EthNetif_t *ctx)
+{
+  struct pbuf *p;
+  int32_t      done;
+
+  if ((ctx->flags & NETIF_FLAG_EXT) == 0U) {
+    return;
+  }
+
+  done = ctx->mac->Control(ETH_MAC_TX_RECLAIM, 0U);
+
+  while ((done > 0) && (ctx->tx_count != 0U)) {
+    p = ctx->tx_pend[ctx->tx_head];
+    ctx->tx_pend[ctx->tx_head] = NULL;
+    if (++ctx->tx_head == ETH_NETIF_TX_PENDING) {
+      ctx->tx_head = 0U;
+    }
+    ctx->tx_count--;
+    done--;
+    if (p != NULL) {
+      (void)pbuf_free(p);
+    }
+  }
+}
+
+/**
+ * @fn          void EthTxPending(EthNetif_t *ctx, struct pbuf *p)
+ * @brief       Record a frame handed to the driver, p is NULL for a copied frame.
+ * @param[in]   ctx  Interface context
+ * @param[in]   p    Frame read by DMA in place
+ */
+static void EthTxPending(EthNetif_t *ctx, struct pbuf *p)
+{
+  uint32_t idx = ctx->tx_head + ctx->tx_count;
+
+  if (idx >= ETH_NETIF_TX_PENDING) {
+    idx -= ETH_NETIF_TX_PENDING;
+  }
+
+  if (p != NULL) {
+    pbuf_ref(p);
+  }
+  ctx->tx_pend[idx] = p;
+  ctx->tx_count++;
+}
+
+/**
+ * @fn          bool EthTxWait(EthNetif_t *ctx, uint32_t *ticks)
+ * @brief       Wait one tick for the transmitter, called with the lock held.
+ * @param[in]   ctx    Interface context
+ * @param[in]   ticks  Ticks waited so far
+ * @return      false - ETH_NETIF_TX_WAIT is used up.
+ */
+static bool EthTxWait(EthNetif_t *ctx, uint32_t *ticks)
+{
+  if (*ticks >= ctx->tx_wait) {
+    return (false);
+  }
+  (*ticks)++;
+
+  EthUnlock(ctx);
+  (void)osDelay(1U);
+  EthLock(ctx);
+  EthTxReclaim(ctx);
+
+  return (true);
+}
+
+/**
+ * @fn          int32_t EthTxSend(EthNetif_t *ctx, const uint8_t *data, uint32_t len, uint32_t flags)
+ * @brief       Send a frame or fragment, wait for a free descriptor.
+ * @param[in]   ctx    Interface context
+ * @param[in]   data   Frame data
+ * @param[in]   len    Frame length
+ * @param[in]   flags  Transmit flags
+ * @return      Driver status.
+ */
+static int32_t EthTxSend(EthNetif_t *ctx, const uint8_t *data, uint32_t len, uint32_t flags)
+{
+  uint32_t ticks = 0U;
+  int32_t  ret;
+
+  do {
+    ret = ctx->mac->SendFrame(data, len, flags);
+  } while ((ret == ARM_DRIVER_ERROR_BUSY) && EthTxWait(ctx, &ticks));
+
+  return (ret);
+}
+
+/**
+ * @fn          err_t EthLinkOutput(struct netif *netif, struct pbuf *p)
+ * @brief       Transmit a frame.
+ * @param[in]   netif  Interface
+ * @param[in]   p      Frame
+ * @return      ERR_OK on success.
+ */
+static err_t EthLinkOutput(struct netif *netif, struct pbuf *p)
+{
+  EthNetif_t        *ctx = (EthNetif_t *)netif->state;
+  ETH_MAC_FRAME_BUF  fb;
+  struct pbuf       *q;
+  uint32_t           frags = 0U;
+  uint32_t           flags;
+  uint32_t           ticks = 0U;
+  bool               nocopy = false;
+  int32_t            ret = ARM_DRIVER_OK;
+
+  EthLock(ctx);
+
+  if ((ctx->flags & NETIF_FLAG_EXT) != 0U) {
+    EthTxReclaim(ctx);
+    while ((ctx->tx_count == ETH_NETIF_TX_PENDING) && EthTxWait(ctx, &ticks)) {
+      /* Transmitted frames are released while waiting */
+    }
+
+    for (q = p; q != NULL; q = q->next) {
+      frags++;
+    }
+
+    /* Zero-copy for large frames of stable memory that the driver can chain */
+    nocopy = (p->tot_len > ETH_NETIF_TX_COPY_MAX) && (frags <= ctx->tx_frags) &&
+             !PBUF_NEEDS_COPY(p);
+
+    if (ctx->tx_count == ETH_NETIF_TX_PENDING) {
+      /* Transmitter stalled, e.g. the link is down, drop the frame */
+      ret = ARM_DRIVER_ERROR_BUSY;
+    }
+    else if (!nocopy) {
+      /* Copy once, straight into the DMA buffer */
+      do {
+        ret = ctx->mac->Control(ETH_MAC_TX_BUFFER_GET, (uint32_t)&fb);
+      } while ((ret == ARM_DRIVER_ERROR_BUSY) && EthTxWait(ctx, &ticks));
+      if ((ret == ARM_DRIVER_OK) && (fb.len >= p->tot_len)) {
+        (void)pbuf_copy_partial(p, fb.data, p->tot_len, 0U);
+        ret = EthTxSend(ctx, fb.data, p->tot_len, 0U);
+      }
+      else if (ret == ARM_DRIVER_OK) {
+        ret = ARM_DRIVER_ERROR_PARAMETER;
+      }
+    }
+    else {
+      for (q = p; q != NULL; q = q->next) {
+        flags = (q->next != NULL) ? ARM_ETH_MAC_TX_FRAME_FRAGMENT : 0U;
+        if (q->len >= ETH_NETIF_TX_COPY_MAX) {
+          flags |= ETH_MAC_TX_FRAME_NOCOPY;
+        }
+        ret = EthTxSend(ctx, q->payload, q->len, flags);
+        if (ret != ARM_DRIVER_OK) {
+          break;
+        }
+      }
+      if ((ret != ARM_DRIVER_OK) && (q != p)) {
+        /* Drop the fragments the driver already took */
+        (void)ctx->mac->Control(ARM_ETH_MAC_FLUSH, ARM_ETH_MAC_FLUSH_TX);
+      }
+    }
+
+    if (ret == ARM_DRIVER_OK) {
+      EthTxPending(ctx, nocopy ? p : NULL);
+    }
+  }
+  else {
+    /* Plain driver, fragments are copied by the driver */
+    for (q = p; q != NULL; q = q->next) {
+      flags = (q->next != NULL) ? ARM_ETH_MAC_TX_FRAME_FRAGMENT : 0U;
+      ret = EthTxSend(ctx, q->payload, q->len, flags);
+      if (ret != ARM_DRIVER_OK) {
+        break;
+      }
+    }
+    if ((ret != ARM_DRIVER_OK) && (q != p)) {
+      (void)ctx->mac->Control(ARM_ETH_MAC_FLUSH, ARM_ETH_MAC_FLUSH_TX);
+    }
+  }
+
+  EthUnlock(ctx);
+
+  if (ret != ARM_DRIVER_OK) {
+    LINK_STATS_INC(link.drop);
+    MIB2_STATS_NETIF_INC(netif, ifoutdiscards);
+    return (ERR_IF);
+  }
+
+  LINK_STATS_INC(link.xmit);
+  MIB2_STATS_NETIF_ADD(netif, ifoutoctets, p->tot_len);
+
+  return (ERR_OK);
+}
+
+#if LWIP_SUPPORT_CUSTOM_PBUF
+/**
+ * @fn          void EthRxPbufFree(struct pbuf *p)
+ * @brief       Give a borrowed receive buffer back to the driver.
+ * @param[in]   p  Custom pbuf
+ */
+static void EthRxPbufFree(struct pbuf *p)
+{
+  EthRxPbuf_t *rp  = (EthRxPbuf_t *)p;
+  EthNetif_t  *ctx = rp->ctx;
+
+  /* The lock is recursive, a received frame may be freed during transmit */
+  EthLock(ctx);
+  (void)ctx->mac->Control(ETH_MAC_RX_FRAME_RETURN, (uint32_t)rp->buf);
+  EthUnlock(ctx);
+
+  LWIP_MEMPOOL_FREE(ETH_RX_PBUF, rp);
+}
+#endif
+
+/**
+ * @fn          bool EthRxFrame(EthNetif_t *ctx)
+ * @brief       Receive one frame and pass it to the stack.
+ * @param[in]   ctx  Interface context
+ * @return      false - no frame available.
+ */
+static bool EthRxFrame(EthNetif_t *ctx)
+{
+  struct netif *netif = ctx->netif;
+  struct pbuf  *p = NULL;
+  uint32_t      size;
+#if LWIP_SUPPORT_CUSTOM_PBUF
+  ETH_MAC_FRAME_BUF fb;
+  EthRxPbuf_t      *rp;
+#endif
+
+  EthLock(ctx);
+
+  size = ctx->mac->GetRxFrameSize();
+  if (size == 0U) {
+    EthUnlock(ctx);
+    return (false);
+  }
+
+  if (size == ETH_RX_FRAME_ERROR) {
+    (void)ctx->mac->ReadFrame(NULL, 0U);
+    EthUnlock(ctx);
+    LINK_STATS_INC(link.err);
+    return (true);
+  }
+
+#if LWIP_SUPPORT_CUSTOM_PBUF
+  /* Zero-copy: the pbuf references the DMA buffer until it is freed */
+  if ((ctx->flags & NETIF_FLAG_EXT) != 0U) {
+    rp = (EthRxPbuf_t *)LWIP_MEMPOOL_ALLOC(ETH_RX_PBUF);
+    if (rp != NULL) {
+      if (ctx->mac->Control(ETH_MAC_RX_FRAME_BORROW, (uint32_t)&fb) == ARM_DRIVER_OK) {
+        rp->p.custom_free_function = EthRxPbufFree;
+        rp->ctx = ctx;
+        rp->buf = fb.data;
+        p = pbuf_alloced_custom(PBUF_RAW, (u16_t)fb.len, PBUF_REF, &rp->p, fb.data, (u16_t)fb.len);
+      }
+      else {
+        LWIP_MEMPOOL_FREE(ETH_RX_PBUF, rp);
+      }
+    }
+  }
+#endif
+
+  if (p == NULL) {
+    /* No buffer to borrow, copy into a pbuf of the heap */
+    p = pbuf_alloc(PBUF_RAW, (u16_t)size, PBUF_RAM);
+    if (p != NULL) {
+      (void)ctx->mac->ReadFrame(p->payload, size);
+    }
+    else {
+      (void)ctx->mac->ReadFrame(NULL, 0U);
+    }
+  }
+
+  EthUnlock(ctx);
+
+  if (p == NULL) {
+    LINK_STATS_INC(link.memerr);
+    LINK_STATS_INC(link.drop);
+    MIB2_STATS_NETIF_INC(netif, ifindiscards);
+    return (true);
+  }
+
+  LINK_STATS_INC(link.recv);
+  MIB2_STATS_NETIF_ADD(netif, ifinoctets, p->tot_len);
+
+  if (netif->input(p, netif) != ERR_OK) {
+    (void)pbuf_free(p);
+  }
+
+  return (true);
+}
+
+static void EthLinkUp(void *arg)
+{
+  netif_set_link_up((struct netif *)arg);
+}
+
+static void EthLinkDown(void *arg)
+{
+  netif_set_link_down((struct netif *)arg);
+}
+
+/**
+ * @fn          void EthLinkPoll(EthNetif_t *ctx)
+ * @brief       Follow the PHY link state, configure the MAC on link up.
+ * @param[in]   ctx  Interface context
+ */
+static void EthLinkPoll(EthNetif_t *ctx)
+{
+  ARM_DRIVER_ETH_MAC *mac = ctx->mac;
+  ARM_ETH_LINK_STATE  link;
+  ARM_ETH_LINK_INFO   info;
+  uint32_t            mode;
+
+  if (ctx->phy != NULL) {
+    link = ctx->phy->GetLinkState();
+  }
+  else {
+    link = ARM_ETH_LINK_UP;
+  }
+
+  if (link == ctx->link) {
+    return;
+  }
+  ctx->link = link;
+
+  EthLock(ctx);
+
+  if (link == ARM_ETH_LINK_UP) {
+    if (ctx->phy != NULL) {
+      info = ctx->phy->GetLinkInfo();
+      mode = ((uint32_t)info.speed  << ARM_ETH_MAC_SPEED_Pos) |
+             ((uint32_t)info.duplex << ARM_ETH_MAC_DUPLEX_Pos);
+    }
+    else {
+      mode = ARM_ETH_MAC_SPEED_100M | ARM_ETH_MAC_DUPLEX_FULL;
+    }
+    (void)mac->Control(ARM_ETH_MAC_CONFIGURE, mode | ctx->mode);
+    (void)mac->Control(ARM_ETH_MAC_CONTROL_TX, 1U);
+    (void)mac->Control(ARM_ETH_MAC_CONTROL_RX, 1U);
+  }
+  else {
+    (void)mac->Control(ARM_ETH_MAC_CONTROL_RX, 0U);
+    (void)mac->Control(ARM_ETH_MAC_CONTROL_TX, 0U);
+  }
+
+  EthUnlock(ctx);
+
+  (void)tcpip_callback((link == ARM_ETH_LINK_UP) ? EthLinkUp : EthLinkDown, ctx->netif);
+}
+
+/**
+ * @fn          void EthThread(void *argument)
+ * @brief       Receive thread, also follows the link state.
+ * @param[in]   argument  Interface context
+ */
+static void EthThread(void *argument)
+{
+  EthNetif_t *ctx = (EthNetif_t *)argument;
+  uint32_t    poll = (ETH_NETIF_LINK_POLL * osKernelGetTickFreq() + 999U) / 1000U;
+  uint32_t    n;
+  bool        more;
+
+  ctx->link_tick = osKernelGetTickCount();
+  EthLinkPoll(ctx);
+
+  for (;;) {
+    (void)osSemaphoreAcquire(ctx->rx_sem, poll);
+
+    do {
+      for (n = 0U; n < ETH_NETIF_RX_BUDGET; n++) {
+        if (!EthRxFrame(ctx)) {
+          break;
+        }
+      }
+
+      if (n == ETH_NETIF_RX_BUDGET) {
+        /* Budget used up, let other threads of this priority run */
+        (void)osThreadYield();
+        more = true;
+      }
+      else if ((ctx->flags & NETIF_FLAG_RX_POLL) != 0U) {
+        EthLock(ctx);
+        more = (ctx->mac->Control(ETH_MAC_RX_POLL_COMPLETE, 0U) == ARM_DRIVER_ERROR_BUSY);
+        EthUnlock(ctx);
+      }
+      else {
+        more = false;
+      }
+    } while (more);
+
+    if (time_after_eq(osKernelGetTickCount(), ctx->link_tick + poll)) {
+      ctx->link_tick = osKernelGetTickCount();
+      EthLinkPoll(ctx);
+      /* Frames sent before the traffic stopped */
+      EthLock(ctx);
+      EthTxReclaim(ctx);
+      EthUnlock(ctx);
+    }
+  }
+}
+
+/**
+ * @fn          void EthChecksumOffload(EthNetif_t *ctx)
+ * @brief       Move the checksums the MAC can handle from the stack to the MAC.
+ * @param[in]   ctx  Interface context
+ */
+static void EthChecksumOffload(EthNetif_t *ctx)
+{
+#if (EMAC_CHECKSUM_OFFLOAD != 0)
+  ARM_ETH_MAC_CAPABILITIES cap = ctx->mac->GetCapabilities();
+  uint16_t                 chksum = NETIF_CHECKSUM_ENABLE_ALL;
+
+  if ((cap.checksum_offload_rx_ip4  != 0U) && (cap.checksum_offload_rx_udp  != 0U) &&
+      (cap.checksum_offload_rx_tcp  != 0U) && (cap.checksum_offload_rx_icmp != 0U)) {
+    /* Frames with wrong checksums are dropped by the MAC */
+    ctx->mode |= ARM_ETH_MAC_CHECKSUM_OFFLOAD_RX;
+    chksum &= (uint16_t)~(NETIF_CHECKSUM_CHECK_IP | NETIF_CHECKSUM_CHECK_UDP |
+                          NETIF_CHECKSUM_CHECK_TCP | NETIF_CHECKSUM_CHECK_ICMP);
+  }
+
+  if ((cap.checksum_offload_tx_ip4  != 0U) && (cap.checksum_offload_tx_udp  != 0U) &&
+      (cap.checksum_offload_tx_tcp  != 0U) && (cap.checksum_offload_tx_icmp != 0U)) {
+    ctx->mode |= ARM_ETH_MAC_CHECKSUM_OFFLOAD_TX;
+    chksum &= (uint16_t)~(NETIF_CHECKSUM_GEN_IP | NETIF_CHECKSUM_GEN_UDP |
+                          NETIF_CHECKSUM_GEN_TCP | NETIF_CHECKSUM_GEN_ICMP);
+  }
+
+#if LWIP_CHECKSUM_CTRL_PER_NETIF
+  NETIF_SET_CHECKSUM_CTRL(ctx->netif, chksum);
+#else
+  /* Without per-interface control the CHECKSUM_GEN_x and CHECKSUM_CHECK_x options apply */
+  (void)chksum;
+#endif
+#else
+  (void)ctx;
+#endif
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+err_t EthNetif_Init(struct netif *netif)
+{
+  EthNetif_t         *ctx;
+  ARM_DRIVER_ETH_MAC *mac;
+  ARM_ETH_MAC_ADDR    addr;
+  uint32_t            idx;
+  int32_t             ret;
+
+  LWIP_ASSERT("EthNetif_Init: netif != NULL", netif != NULL);
+  ctx = (EthNetif_t *)netif->state;
+  if ((ctx == NULL) || (ctx->mac == NULL)) {
+    return (ERR_ARG);
+  }
+  mac = ctx->mac;
+
+  for (idx = 0U; idx < ETH_NETIF_MAX; idx++) {
+    if (eth_ctx[idx] == NULL) {
+      break;
+    }
+  }
+  if (idx == ETH_NETIF_MAX) {
+    return (ERR_IF);
+  }
+
+#if LWIP_SUPPORT_CUSTOM_PBUF
+  if (idx == 0U) {
+    LWIP_MEMPOOL_INIT(ETH_RX_PBUF);
+  }
+#endif
+
+  ctx->netif    = netif;
+  ctx->flags    = 0U;
+  ctx->mode     = ARM_ETH_MAC_ADDRESS_BROADCAST;
+  ctx->link     = ARM_ETH_LINK_DOWN;
+  ctx->tx_head  = 0U;
+  ctx->tx_count = 0U;
+  ctx->tx_frags = ETH_NETIF_TX_FRAG_MAX;
+  ctx->tx_wait  = (ETH_NETIF_TX_WAIT * osKernelGetTickFreq() + 999U) / 1000U;
+#if LWIP_IGMP || LWIP_IPV6_MLD
+  /* Multicast groups are not tracked, accept all multicast frames */
+  ctx->mode    |= ARM_ETH_MAC_ADDRESS_MULTICAST;
+#endif
+
+  const osSemaphoreAttr_t sem_attr = {
+    .name    = NULL,
+    .cb_mem  = &ctx->rx_sem_cb,
+    .cb_size = sizeof(ctx->rx_sem_cb),
+  };
+  const osMutexAttr_t mutex_attr = {
+    .name      = NULL,
+    .attr_bits = osMutexRecursive | osMutexPrioInherit,
+    .cb_mem    = &ctx->lock_cb,
+    .cb_size   = sizeof(ctx->lock_cb),
+  };
+
+  ctx->rx_sem = osSemaphoreNew(1U, 0U, &sem_attr);
+  ctx->lock   = osMutexNew(&mutex_attr);
+  if ((ctx->rx_sem == NULL) || (ctx->lock == NULL)) {
+    return (ERR_IF);
+  }
+
+  eth_ctx[idx] = ctx;
+
+  /* MAC */
+  if ((mac->Initialize(eth_event[idx]) != ARM_DRIVER_OK) ||
+      (mac->PowerControl(ARM_POWER_FULL) != ARM_DRIVER_OK)) {
+    eth_ctx[idx] = NULL;
+    return (ERR_IF);
+  }
+
+  if (mac->Control(ETH_MAC_TX_RECLAIM, 0U) >= 0) {
+    ctx->flags |= NETIF_FLAG_EXT;
+    /* Stay below the descriptors so a zero-copy frame never waits for the whole ring */
+    ret = mac->Control(ETH_MAC_GET_TX_DESC_NUM, 0U);
+    if ((ret > 0) && ((uint32_t)ret <= ctx->tx_frags)) {
+      ctx->tx_frags = (uint32_t)ret - 1U;
+    }
+    if (mac->Control(ETH_MAC_CONTROL_RX_POLL, 1U) == ARM_DRIVER_OK) {
+      ctx->flags |= NETIF_FLAG_RX_POLL;
+    }
+  }
+
+  /* PHY */
+  if (ctx->phy != NULL) {
+    if ((ctx->phy->Initialize(mac->PHY_Read, mac->PHY_Write) != ARM_DRIVER_OK) ||
+        (ctx->phy->PowerControl(ARM_POWER_FULL) != ARM_DRIVER_OK) ||
+        (ctx->phy->SetInterface(mac->GetCapabilities().media_interface) != ARM_DRIVER_OK) ||
+        (ctx->phy->SetMode(ARM_ETH_PHY_AUTO_NEGOTIATE) != ARM_DRIVER_OK)) {
+      (void)mac->PowerControl(ARM_POWER_OFF);
+      (void)mac->Uninitialize();
+      eth_ctx[idx] = NULL;
+      return (ERR_IF);
+    }
+  }
+
+  /* Interface */
+  (void)mac->GetMacAddress(&addr);
+  netif->hwaddr_len = ETH_HWADDR_LEN;
+  memcpy(netif->hwaddr, addr.b, ETH_HWADDR_LEN);
+
+  netif->name[0]    = 'e';
+  netif->name[1]    = 'n';
+  netif->mtu        = 1500U;
+  netif->flags      = NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP | NETIF_FLAG_ETHERNET;
+#if LWIP_IGMP
+  netif->flags     |= NETIF_FLAG_IGMP;
+#endif
+#if LWIP_IPV4
+  netif->output     = etharp_output;
+#endif
+#if LWIP_IPV6
+  netif->output_ip6 = ethip6_output;
+  netif->flags     |= NETIF_FLAG_MLD6;
+#endif
+  netif->linkoutput = EthLinkOutput;
+
+  MIB2_INIT_NETIF(netif, snmp_ifType_ethernet_csmacd, 100000000U);
+
+  EthChecksumOffload(ctx);
+
+  /* Receive thread */
+  const osThreadAttr_t thread_attr = {
+    .name       = "eth",
+    .cb_mem     = &ctx->thread_cb,
+    .cb_size    = sizeof(ctx->thread_cb),
+    .stack_mem  = ctx->stack,
+    .stack_size = sizeof(ctx->stack),
+    .priority   = ctx->priority,
+  };
+
+  ctx->thread = osThreadNew(EthThread, ctx, &thread_attr);
+  if (ctx->thread == NULL) {
+    return (ERR_IF);
+  }
+
+  return (ERR_OK);
+}
+
+/* ----------------------------- End of file ---------------------------------*/
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Description: lwIP compiler and platform definitions.
+ */
+
+#ifndef LWIP_ARCH_CC_H_
+#define LWIP_ARCH_CC_H_
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+#include <Debug/debug.h>
+
+/*******************************************************************************
+ *  defines and macros
+ ******************************************************************************/
+
+/* errno and struct timeval of the C library */
+#define LWIP_ERRNO_STDINCLUDE         1
+#define LWIP_TIMEVAL_PRIVATE          0
+
+/* All supported cores are little endian */
+#define BYTE_ORDER                    LITTLE_ENDIAN
+
+#if defined(__GNUC__) || defined(__clang__)
+#define PACK_STRUCT_BEGIN
+#define PACK_STRUCT_STRUCT            __attribute__((packed))
+#define PACK_STRUCT_END
+#define PACK_STRUCT_FIELD(x)          x
+#endif
+
+#define LWIP_RAND()                   ((uint32_t)rand())
+
+#define LWIP_PLATFORM_DIAG(x)         do { DEBUG_LOG x; } while (0)
+
+#define LWIP_PLATFORM_ASSERT(x)       do { DEBUG_LOG("lwIP assertion \"%s\" failed at line %d in %s\n", \
+                                                     x, __LINE__, __FILE__); \
+                                           for (;;) {} } while (0)
+
+#endif /* LWIP_ARCH_CC_H_ */
+
+/* ----------------------------- End of file ---------------------------------*/
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Description: lwIP operating system emulation layer types.
+ */
+
+#ifndef LWIP_ARCH_SYS_ARCH_H_
+#define LWIP_ARCH_SYS_ARCH_H_
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <Kernel/kernel.h>
+
+/*******************************************************************************
+ *  defines and macros
+ ******************************************************************************/
+
+#define SYS_MBOX_NULL                 NULL
+#define SYS_SEM_NULL                  NULL
+
+/*
+ * The kernel objects are embedded in the lwIP types, the kernel has no
+ * dynamic allocation. A valid object is identified by its id.
+ */
+#define sys_sem_valid(sem)            ((sem)->id != NULL)
+#define sys_sem_set_invalid(sem)      ((sem)->id = NULL)
+#define sys_mutex_valid(mutex)        ((mutex)->id != NULL)
+#define sys_mutex_set_invalid(mutex)  ((mutex)->id = NULL)
+#define sys_mbox_valid(mbox)          ((mbox)->id != NULL)
+#define sys_mbox_set_invalid(mbox)    ((mbox)->id = NULL)
+
+/*******************************************************************************
+ *  typedefs and structures
+ ******************************************************************************/
+
+typedef struct sys_sem_s {
+  osSemaphoreId_t     id;
+  osSemaphore_t       cb;
+} sys_sem_t;
+
+typedef struct sys_mutex_s {
+  osMutexId_t         id;
+  osMutex_t           cb;
+} sys_mutex_t;
+
+typedef struct sys_mbox_s {
+  osMessageQueueId_t  id;
+  osMessageQueue_t    cb;
+  void               *mem;          // Message storage, taken from the lwIP heap
+} sys_mbox_t;
+
+typedef osThreadId_t sys_thread_t;
+
+/* Previous scheduler lock state */
+typedef int32_t sys_prot_t;
+
+#endif /* LWIP_ARCH_SYS_ARCH_H_ */
+
+/* ----------------------------- End of file ---------------------------------*/
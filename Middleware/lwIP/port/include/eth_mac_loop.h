@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Description: Ethernet MAC stand-in for running the network stack without
+ *              hardware.
+ */
+
+#ifndef ETH_MAC_LOOP_H_
+#define ETH_MAC_LOOP_H_
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <Driver/Driver_ETH_MAC_Ext.h>
+#include <Driver/Driver_ETH_PHY.h>
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ *  defines and macros
+ ******************************************************************************/
+
+#ifndef ETH_LOOP_NUM_RX_BUF
+#define ETH_LOOP_NUM_RX_BUF           (8U)        // Receive ring size per MAC
+#endif
+
+#ifndef ETH_LOOP_NUM_RX_RESERVE
+#define ETH_LOOP_NUM_RX_RESERVE       (1U)        // Receive buffers never lent by ETH_MAC_RX_FRAME_BORROW
+#endif
+
+#ifndef ETH_LOOP_NUM_TX_DESC
+#define ETH_LOOP_NUM_TX_DESC          (4U)        // Transmit descriptors, one per fragment
+#endif
+
+#ifndef ETH_LOOP_BUF_SIZE
+#define ETH_LOOP_BUF_SIZE             (1536U)     // Frame buffer size
+#endif
+
+#ifndef ETH_LOOP_NUM_MCAST
+#define ETH_LOOP_NUM_MCAST            (8U)        // Multicast addresses of the address filter
+#endif
+
+/*******************************************************************************
+ *  exported variables
+ ******************************************************************************/
+
+/*
+ * Two MACs wired back to back: a frame sent on one of them is received by the
+ * other, or by the sender itself with ARM_ETH_MAC_LOOPBACK. The frame is
+ * copied into the receive ring of the peer during SendFrame, a full ring drops
+ * it. The driver extensions of Driver_ETH_MAC_Ext.h are supported, so the
+ * zero-copy and polled receive paths of a network interface run unchanged.
+ * The drivers use the kernel scheduler lock and are called from threads only.
+ */
+extern ARM_DRIVER_ETH_MAC Driver_ETH_MAC_Loop0;
+extern ARM_DRIVER_ETH_MAC Driver_ETH_MAC_Loop1;
+
+/* PHY with a permanent 100 Mbit full duplex link */
+extern ARM_DRIVER_ETH_PHY Driver_ETH_PHY_Loop;
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* ETH_MAC_LOOP_H_ */
+
+/* ----------------------------- End of file ---------------------------------*/
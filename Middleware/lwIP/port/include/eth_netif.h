@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Description: lwIP network interface over a CMSIS Ethernet MAC driver.
+ */
+
+#ifndef ETH_NETIF_H_
+#define ETH_NETIF_H_
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdint.h>
+
+#include <Kernel/kernel.h>
+#include <Driver/Driver_ETH_MAC_Ext.h>
+#include <Driver/Driver_ETH_PHY.h>
+
+#include "lwip/err.h"
+#include "lwip/netif.h"
+#include "lwip/pbuf.h"
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ *  defines and macros
+ ******************************************************************************/
+
+#ifndef ETH_NETIF_MAX
+#define ETH_NETIF_MAX                 (2U)        // Number of interfaces, 1..2
+#endif
+
+#ifndef ETH_NETIF_STACK_SIZE
+#define ETH_NETIF_STACK_SIZE          (1024U)     // Stack size of the receive thread
+#endif
+
+#ifndef ETH_NETIF_RX_BUDGET
+#define ETH_NETIF_RX_BUDGET           (8U)        // Frames received in one batch
+#endif
+
+#ifndef ETH_NETIF_RX_BORROW_MAX
+#define ETH_NETIF_RX_BORROW_MAX       (8U)        // Receive buffers lent to the stack, all interfaces, the MAC keeps its own reserve
+#endif
+
+#ifndef ETH_NETIF_TX_COPY_MAX
+#define ETH_NETIF_TX_COPY_MAX         (128U)      // Frames and fragments up to this size are copied
+#endif
+
+#ifndef ETH_NETIF_TX_FRAG_MAX
+#define ETH_NETIF_TX_FRAG_MAX         (4U)        // Longer pbuf chains are copied, also capped below the MAC descriptors
+#endif
+
+#ifndef ETH_NETIF_TX_WAIT
+#define ETH_NETIF_TX_WAIT             (10U)       // Wait for a transmit descriptor in ms, the frame is dropped after it
+#endif
+
+#ifndef ETH_NETIF_TX_PENDING
+#define ETH_NETIF_TX_PENDING          (16U)       // Frames in flight, at least the transmit descriptors
+#endif
+
+#ifndef ETH_NETIF_LINK_POLL
+#define ETH_NETIF_LINK_POLL           (100U)      // Link state poll interval in ms
+#endif
+
+/* Use the checksum offload of the MAC when its capabilities report it */
+#ifndef EMAC_CHECKSUM_OFFLOAD
+#define EMAC_CHECKSUM_OFFLOAD         (1)
+#endif
+
+/*******************************************************************************
+ *  typedefs and structures
+ ******************************************************************************/
+
+/*
+ * Interface context, passed as state to netif_add. The application fills in
+ * the drivers and the priority of the receive thread, the rest belongs to the
+ * interface.
+ */
+typedef struct EthNetif_s {
+  ARM_DRIVER_ETH_MAC       *mac;
+  ARM_DRIVER_ETH_PHY       *phy;        // NULL - link is always up
+  osPriority_t              priority;   // Receive thread priority
+
+  /* Private */
+  struct netif             *netif;
+  uint32_t                  flags;
+  uint32_t                  mode;       // ARM_ETH_MAC_CONFIGURE argument without the link
+  ARM_ETH_LINK_STATE        link;
+  uint32_t                  link_tick;
+  osSemaphoreId_t           rx_sem;
+  osSemaphore_t             rx_sem_cb;
+  osMutexId_t               lock;       // Serializes the driver calls
+  osMutex_t                 lock_cb;
+  osThreadId_t              thread;
+  osThread_t                thread_cb;
+  uint64_t                  stack[ETH_NETIF_STACK_SIZE / 8U];
+  uint32_t                  tx_frags;   // Fragments of a zero-copy frame
+  uint32_t                  tx_wait;    // ETH_NETIF_TX_WAIT in ticks
+  struct pbuf              *tx_pend[ETH_NETIF_TX_PENDING];
+  uint32_t                  tx_head;
+  uint32_t                  tx_count;
+} EthNetif_t;
+
+/*******************************************************************************
+ *  exported function prototypes
+ ******************************************************************************/
+
+/**
+ * @fn          err_t EthNetif_Init(struct netif *netif)
+ * @brief       Interface initialization function for netif_add.
+ * @param[in]   netif  Interface, netif->state points to an EthNetif_t
+ * @return      ERR_OK on success, ERR_ARG or ERR_IF otherwise.
+ */
+err_t EthNetif_Init(struct netif *netif);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* ETH_NETIF_H_ */
+
+/* ----------------------------- End of file ---------------------------------*/
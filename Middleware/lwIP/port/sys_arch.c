@@ -0,0 +1,333 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Description: lwIP operating system emulation layer.
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include "lwip/opt.h"
+#include "lwip/sys.h"
+#include "lwip/mem.h"
+#include "lwip/stats.h"
+
+#if !NO_SYS
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+/* Mailbox size used when lwIP asks for a mailbox of size 0 */
+#ifndef SYS_MBOX_SIZE_DEFAULT
+#define SYS_MBOX_SIZE_DEFAULT         (16)
+#endif
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+/**
+ * @fn          uint32_t MsToTicks(u32_t ms)
+ * @brief       Convert an lwIP timeout to kernel ticks.
+ * @param[in]   ms  Timeout in milliseconds, 0 - wait forever
+ * @return      Timeout in ticks.
+ */
+static uint32_t MsToTicks(u32_t ms)
+{
+  uint64_t ticks;
+
+  if (ms == 0U) {
+    return (osWaitForever);
+  }
+
+  ticks = ((uint64_t)ms * osKernelGetTickFreq() + 999U) / 1000U;
+  if (ticks >= osWaitForever) {
+    ticks = osWaitForever - 1U;
+  }
+
+  return ((uint32_t)ticks);
+}
+
+/**
+ * @fn          u32_t TicksToMs(uint32_t ticks)
+ * @brief       Convert kernel ticks to milliseconds.
+ * @param[in]   ticks  Number of ticks
+ * @return      Time in milliseconds.
+ */
+static u32_t TicksToMs(uint32_t ticks)
+{
+  return ((u32_t)(((uint64_t)ticks * 1000U) / osKernelGetTickFreq()));
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+void sys_init(void)
+{
+}
+
+/*
+ * With a tick frequency other than 1 kHz the time jumps when the tick counter
+ * wraps around, lwIP only uses differences of a few minutes at most.
+ */
+u32_t sys_now(void)
+{
+  return (TicksToMs(osKernelGetTickCount()));
+}
+
+/*
+ * Lightweight protection locks the scheduler, lwIP must not be called from
+ * interrupt handlers besides the *_fromisr functions.
+ */
+sys_prot_t sys_arch_protect(void)
+{
+  return ((sys_prot_t)osKernelLock());
+}
+
+void sys_arch_unprotect(sys_prot_t pval)
+{
+  /* Negative - called before the kernel was started */
+  if (pval >= 0) {
+    (void)osKernelRestoreLock(pval);
+  }
+}
+
+/* Semaphores */
+
+err_t sys_sem_new(sys_sem_t *sem, u8_t count)
+{
+  const osSemaphoreAttr_t attr = {
+    .name    = NULL,
+    .cb_mem  = &sem->cb,
+    .cb_size = sizeof(sem->cb),
+  };
+
+  sem->id = osSemaphoreNew(0xFFFFU, count, &attr);
+  if (sem->id == NULL) {
+    SYS_STATS_INC(sem.err);
+    return (ERR_MEM);
+  }
+  SYS_STATS_INC_USED(sem);
+
+  return (ERR_OK);
+}
+
+void sys_sem_signal(sys_sem_t *sem)
+{
+  (void)osSemaphoreRelease(sem->id);
+}
+
+u32_t sys_arch_sem_wait(sys_sem_t *sem, u32_t timeout)
+{
+  uint32_t start = osKernelGetTickCount();
+
+  if (osSemaphoreAcquire(sem->id, MsToTicks(timeout)) != osOK) {
+    return (SYS_ARCH_TIMEOUT);
+  }
+
+  return (TicksToMs(osKernelGetTickCount() - start));
+}
+
+void sys_sem_free(sys_sem_t *sem)
+{
+  (void)osSemaphoreDelete(sem->id);
+  SYS_STATS_DEC(sem.used);
+}
+
+/* Mutexes */
+
+err_t sys_mutex_new(sys_mutex_t *mutex)
+{
+  const osMutexAttr_t attr = {
+    .name      = NULL,
+    .attr_bits = osMutexPrioInherit,
+    .cb_mem    = &mutex->cb,
+    .cb_size   = sizeof(mutex->cb),
+  };
+
+  mutex->id = osMutexNew(&attr);
+  if (mutex->id == NULL) {
+    SYS_STATS_INC(mutex.err);
+    return (ERR_MEM);
+  }
+  SYS_STATS_INC_USED(mutex);
+
+  return (ERR_OK);
+}
+
+void sys_mutex_lock(sys_mutex_t *mutex)
+{
+  (void)osMutexAcquire(mutex->id, osWaitForever);
+}
+
+void sys_mutex_unlock(sys_mutex_t *mutex)
+{
+  (void)osMutexRelease(mutex->id);
+}
+
+void sys_mutex_free(sys_mutex_t *mutex)
+{
+  (void)osMutexDelete(mutex->id);
+  SYS_STATS_DEC(mutex.used);
+}
+
+/* Mailboxes */
+
+err_t sys_mbox_new(sys_mbox_t *mbox, int size)
+{
+  osMessageQueueAttr_t attr = {
+    .name    = NULL,
+    .cb_mem  = &mbox->cb,
+    .cb_size = sizeof(mbox->cb),
+  };
+
+  if (size <= 0) {
+    size = SYS_MBOX_SIZE_DEFAULT;
+  }
+
+  /* Message storage comes from the lwIP heap, aligned to MEM_ALIGNMENT */
+  attr.mq_size = osMessageQueueMemSize((uint32_t)size, sizeof(void *));
+  attr.mq_mem  = mem_malloc((mem_size_t)attr.mq_size);
+  mbox->mem    = attr.mq_mem;
+  mbox->id     = NULL;
+
+  if (attr.mq_mem != NULL) {
+    mbox->id = osMessageQueueNew((uint32_t)size, sizeof(void *), &attr);
+    if (mbox->id == NULL) {
+      mem_free(attr.mq_mem);
+    }
+  }
+
+  if (mbox->id == NULL) {
+    SYS_STATS_INC(mbox.err);
+    return (ERR_MEM);
+  }
+  SYS_STATS_INC_USED(mbox);
+
+  return (ERR_OK);
+}
+
+void sys_mbox_post(sys_mbox_t *mbox, void *msg)
+{
+  (void)osMessageQueuePut(mbox->id, &msg, 0U, osWaitForever);
+}
+
+err_t sys_mbox_trypost(sys_mbox_t *mbox, void *msg)
+{
+  if (osMessageQueuePut(mbox->id, &msg, 0U, 0U) != osOK) {
+    SYS_STATS_INC(mbox.err);
+    return (ERR_MEM);
+  }
+
+  return (ERR_OK);
+}
+
+err_t sys_mbox_trypost_fromisr(sys_mbox_t *mbox, void *msg)
+{
+  /* Statistics are not updated, they are not protected against interrupts */
+  if (osMessageQueuePut(mbox->id, &msg, 0U, 0U) != osOK) {
+    return (ERR_MEM);
+  }
+
+  return (ERR_OK);
+}
+
+u32_t sys_arch_mbox_fetch(sys_mbox_t *mbox, void **msg, u32_t timeout)
+{
+  uint32_t start = osKernelGetTickCount();
+  void    *dummy;
+
+  if (msg == NULL) {
+    msg = &dummy;
+  }
+
+  if (osMessageQueueGet(mbox->id, msg, NULL, MsToTicks(timeout)) != osOK) {
+    *msg = NULL;
+    return (SYS_ARCH_TIMEOUT);
+  }
+
+  return (TicksToMs(osKernelGetTickCount() - start));
+}
+
+u32_t sys_arch_mbox_tryfetch(sys_mbox_t *mbox, void **msg)
+{
+  void *dummy;
+
+  if (msg == NULL) {
+    msg = &dummy;
+  }
+
+  if (osMessageQueueGet(mbox->id, msg, NULL, 0U) != osOK) {
+    *msg = NULL;
+    return (SYS_MBOX_EMPTY);
+  }
+
+  return (0U);
+}
+
+void sys_mbox_free(sys_mbox_t *mbox)
+{
+  LWIP_ASSERT("sys_mbox_free: mailbox not empty", osMessageQueueGetCount(mbox->id) == 0U);
+
+  (void)osMessageQueueDelete(mbox->id);
+  mem_free(mbox->mem);
+  SYS_STATS_DEC(mbox.used);
+}
+
+/* Threads */
+
+sys_thread_t sys_thread_new(const char *name, lwip_thread_fn thread, void *arg, int stacksize, int prio)
+{
+  osThreadAttr_t attr = {
+    .name    = name,
+    .cb_size = sizeof(osThread_t),
+  };
+  uint8_t      *mem;
+  osThreadId_t  id;
+
+  /*
+   * lwIP threads run forever, control block and stack are taken from the
+   * lwIP heap once. The kernel needs an 8-byte aligned stack.
+   */
+  stacksize = (stacksize + 7) & ~7;
+  mem = mem_malloc((mem_size_t)(sizeof(osThread_t) + (uint32_t)stacksize + 7U));
+  LWIP_ASSERT("sys_thread_new: out of memory", mem != NULL);
+  if (mem == NULL) {
+    return (NULL);
+  }
+
+  attr.cb_mem     = mem;
+  attr.stack_mem  = (void *)(((uintptr_t)mem + sizeof(osThread_t) + 7U) & ~(uintptr_t)7U);
+  attr.stack_size = (uint32_t)stacksize;
+  attr.priority   = (osPriority_t)prio;
+
+  id = osThreadNew(thread, arg, &attr);
+  LWIP_ASSERT("sys_thread_new: thread not created", id != NULL);
+  if (id == NULL) {
+    mem_free(mem);
+  }
+
+  return (id);
+}
+
+#endif /* !NO_SYS */
+
+/* ----------------------------- End of file ---------------------------------*/
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2024 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Description: lwIP options template for the kernel port, copy it into the
+ *              application and adjust.
+ */
+
+#ifndef LWIPOPTS_H_
+#define LWIPOPTS_H_
+
+/*******************************************************************************
+ *  defines and macros
+ ******************************************************************************/
+
+/* Operating system */
+#define NO_SYS                        0
+#define SYS_LIGHTWEIGHT_PROT          1
+#define LWIP_TCPIP_CORE_LOCKING       1
+#define LWIP_NETCONN                  1
+#define LWIP_SOCKET                   0
+
+#define TCPIP_THREAD_NAME             "tcpip"
+#ifndef TCPIP_THREAD_STACKSIZE
+#define TCPIP_THREAD_STACKSIZE        2048
+#endif
+#define TCPIP_THREAD_PRIO             osPriorityAboveNormal
+#define TCPIP_MBOX_SIZE               16
+#ifndef DEFAULT_THREAD_STACKSIZE
+#define DEFAULT_THREAD_STACKSIZE      1024
+#endif
+#define DEFAULT_THREAD_PRIO           osPriorityNormal
+#define DEFAULT_RAW_RECVMBOX_SIZE     8
+#define DEFAULT_UDP_RECVMBOX_SIZE     16
+#define DEFAULT_TCP_RECVMBOX_SIZE     16
+#define DEFAULT_ACCEPTMBOX_SIZE       4
+
+/* Memory, thread stacks and mailboxes of sys_arch.c are taken from the heap */
+#define MEM_ALIGNMENT                 8
+#ifndef MEM_SIZE
+#define MEM_SIZE                      (24 * 1024)
+#endif
+#define MEMP_NUM_PBUF                 16
+#define MEMP_NUM_UDP_PCB              4
+#define MEMP_NUM_TCP_PCB              4
+#define MEMP_NUM_TCP_SEG              16
+#define MEMP_NUM_NETBUF               16
+#define MEMP_NUM_NETCONN              8
+#define PBUF_POOL_SIZE                16
+#define LWIP_SUPPORT_CUSTOM_PBUF      1
+
+/* Ethernet, frames are received into the MAC buffers without padding */
+#define LWIP_ARP                      1
+#define LWIP_ETHERNET                 1
+#define ETH_PAD_SIZE                  0
+#define ARP_QUEUEING                  1
+
+/* Protocols */
+#define LWIP_IPV4                     1
+#define LWIP_IPV6                     0
+#define LWIP_ICMP                     1
+#define LWIP_UDP                      1
+#define LWIP_TCP                      1
+#define LWIP_DHCP                     0
+#define LWIP_IGMP                     0
+#define TCP_MSS                       1460
+#define TCP_WND                       (4 * TCP_MSS)
+#define TCP_SND_BUF                   (4 * TCP_MSS)
+
+/* Checksums, the interface hands the ones the MAC calculates over to it */
+#define LWIP_CHECKSUM_CTRL_PER_NETIF  1
+#define EMAC_CHECKSUM_OFFLOAD         1
+
+/* Link state follows the PHY */
+#define LWIP_NETIF_LINK_CALLBACK      1
+
+#define LWIP_STATS                    0
+
+#endif /* LWIPOPTS_H_ */
+
+/* ----------------------------- End of file ---------------------------------*/